@@ -43,11 +43,49 @@ AC_DEFUN([AX_LIBCDIRECTORY_CHECK_LOCAL],
   [AS_IF(
     [test "x$ac_cv_enable_winapi" = xno],
     [dnl Headers included in libcdirectory/libcdirectory_directory.h
-    AC_CHECK_HEADERS([dirent.h errno.h sys/stat.h])
+    AC_CHECK_HEADERS([dirent.h errno.h fcntl.h sys/stat.h sys/syscall.h unistd.h])
 
     dnl Directory functions used in libcdirectory/libcdirectory_directory.h
     AC_CHECK_FUNCS([closedir opendir readdir readdir_r])
 
+    dnl Directory functions used to open a directory relative to another directory
+    AC_CHECK_FUNCS([dirfd fdopendir openat])
+
+    dnl Directory functions used to rewind a directory and to retrieve and set the position
+    AC_CHECK_FUNCS([rewinddir seekdir telldir])
+
+    dnl Headers and functions used to retrieve directory entry file statistics
+    AC_CHECK_HEADERS([linux/stat.h])
+
+    AC_CHECK_FUNCS([fstatat])
+
+    AC_CHECK_MEMBERS([struct stat.st_mtim.tv_nsec, struct stat.st_mtimespec.tv_nsec, struct stat.st_birthtimespec.tv_nsec], [], [], [
+#include <sys/types.h>
+#include <sys/stat.h>])
+
+    dnl Headers and functions used by the parallel walker
+    AC_CHECK_HEADERS([pthread.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_pthread_h" = xyes],
+      [AC_SEARCH_LIBS(
+        [pthread_create],
+        [pthread])
+      AC_CHECK_FUNCS([pthread_create])
+
+      AS_IF(
+        [test "x$ac_cv_search_pthread_create" != "xnone required" && test "x$ac_cv_search_pthread_create" != xno],
+        [AC_SUBST(
+          [ax_libcdirectory_pc_libs_private],
+          [$ac_cv_search_pthread_create])
+        ])
+      ])
+
+    dnl Headers and functions used to map a tree snapshot into memory
+    AC_CHECK_HEADERS([sys/mman.h])
+
+    AC_CHECK_FUNCS([mmap munmap])
+
     AS_IF(
       [test "x$ac_cv_func_closedir" != xyes],
       [AC_MSG_FAILURE(
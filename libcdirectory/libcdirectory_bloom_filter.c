@@ -0,0 +1,415 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdirectory_bloom_filter.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_libuna.h"
+#include "libcdirectory_name_index.h"
+
+/* Creates a Bloom filter
+ * Make sure the value bloom_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_bloom_filter_initialize(
+     libcdirectory_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_bloom_filter_initialize";
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bloom_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Bloom filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bloom_filter = memory_allocate_structure(
+	                 libcdirectory_bloom_filter_t );
+
+	if( *bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bloom_filter,
+	     0,
+	     sizeof( libcdirectory_bloom_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *bloom_filter != NULL )
+	{
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Bloom filter
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_bloom_filter_free(
+     libcdirectory_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_bloom_filter_free";
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bloom_filter != NULL )
+	{
+		if( ( *bloom_filter )->key != NULL )
+		{
+			memory_free(
+			 ( *bloom_filter )->key );
+		}
+		if( ( *bloom_filter )->bitmap != NULL )
+		{
+			memory_free(
+			 ( *bloom_filter )->bitmap );
+		}
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes and clears a Bloom filter for a number of entries
+ * The number of hash functions is bits per entry * ln(2), which minimizes
+ * the false positive rate, and is limited to 16 to bound the cost of a look up
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_bloom_filter_resize(
+     libcdirectory_bloom_filter_t *bloom_filter,
+     int number_of_entries,
+     uint8_t bits_per_entry,
+     libcerror_error_t **error )
+{
+	uint8_t *resized_bitmap = NULL;
+	static char *function   = "libcdirectory_bloom_filter_resize";
+	uint64_t number_of_bits = 0;
+	size_t bitmap_size      = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bits_per_entry == 0 )
+	 || ( bits_per_entry > LIBCDIRECTORY_BLOOM_FILTER_MAXIMUM_BITS_PER_ENTRY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bits per entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = (uint64_t) number_of_entries * bits_per_entry;
+
+	if( number_of_bits < LIBCDIRECTORY_BLOOM_FILTER_MINIMUM_NUMBER_OF_BITS )
+	{
+		number_of_bits = LIBCDIRECTORY_BLOOM_FILTER_MINIMUM_NUMBER_OF_BITS;
+	}
+	if( number_of_bits > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE * 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_size = (size_t) ( ( number_of_bits + 7 ) / 8 );
+
+	if( bitmap_size > bloom_filter->allocated_bitmap_size )
+	{
+		resized_bitmap = (uint8_t *) memory_reallocate(
+		                              bloom_filter->bitmap,
+		                              sizeof( uint8_t ) * bitmap_size );
+
+		if( resized_bitmap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize bitmap.",
+			 function );
+
+			return( -1 );
+		}
+		bloom_filter->bitmap                = resized_bitmap;
+		bloom_filter->allocated_bitmap_size = bitmap_size;
+	}
+	if( memory_set(
+	     bloom_filter->bitmap,
+	     0,
+	     sizeof( uint8_t ) * bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	bloom_filter->bitmap_size              = bitmap_size;
+	bloom_filter->number_of_bits           = number_of_bits;
+	bloom_filter->number_of_hash_functions = (uint8_t) ( ( (uint16_t) bits_per_entry * 69 + 50 ) / 100 );
+
+	if( bloom_filter->number_of_hash_functions == 0 )
+	{
+		bloom_filter->number_of_hash_functions = 1;
+	}
+	else if( bloom_filter->number_of_hash_functions > 16 )
+	{
+		bloom_filter->number_of_hash_functions = 16;
+	}
+	return( 1 );
+}
+
+/* Calculates the 64-bit hash of a case folded key
+ * The hash is a 64-bit FNV-1a hash followed by the MurmurHash3 finalizer,
+ * so that both 32-bit halves can be used as independent hash values
+ * Returns the hash
+ */
+uint64_t libcdirectory_bloom_filter_calculate_hash(
+          const libuna_unicode_character_t *key,
+          size_t key_length )
+{
+	size_t key_index = 0;
+	uint64_t hash    = 0xcbf29ce484222325ULL;
+
+	for( key_index = 0;
+	     key_index < key_length;
+	     key_index++ )
+	{
+		hash ^= (uint64_t) key[ key_index ];
+		hash *= 0x00000100000001b3ULL;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	return( hash );
+}
+
+/* Retrieves the hash of a name
+ * The hash is calculated over the case folded key of the name, hence
+ * names that only differ in case have the same hash
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_bloom_filter_get_name_hash(
+     libcdirectory_bloom_filter_t *bloom_filter,
+     const char *name,
+     size_t name_length,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_bloom_filter_get_name_hash";
+	size_t key_length     = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_name_index_resize_unicode_buffer(
+	     &( bloom_filter->key ),
+	     &( bloom_filter->allocated_key_length ),
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_name_index_get_case_folded_key(
+	     name,
+	     name_length,
+	     bloom_filter->key,
+	     bloom_filter->allocated_key_length,
+	     &key_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve case folded key.",
+		 function );
+
+		return( -1 );
+	}
+	*hash = libcdirectory_bloom_filter_calculate_hash(
+	         bloom_filter->key,
+	         key_length );
+
+	return( 1 );
+}
+
+/* Inserts a hash into a Bloom filter
+ * The bit indexes are derived from the hash using double hashing
+ * The Bloom filter is expected to be validated and sized by the caller
+ */
+void libcdirectory_bloom_filter_insert_hash(
+      libcdirectory_bloom_filter_t *bloom_filter,
+      uint64_t hash )
+{
+	uint64_t bit_index     = 0;
+	uint64_t first_hash    = hash & 0xffffffffUL;
+	uint64_t second_hash   = ( hash >> 32 ) | 1;
+	uint8_t function_index = 0;
+
+	for( function_index = 0;
+	     function_index < bloom_filter->number_of_hash_functions;
+	     function_index++ )
+	{
+		bit_index = ( first_hash + ( function_index * second_hash ) ) % bloom_filter->number_of_bits;
+
+		bloom_filter->bitmap[ bit_index >> 3 ] |= (uint8_t) ( 1 << ( bit_index & 0x07 ) );
+	}
+}
+
+/* Determines if a Bloom filter contains a hash
+ * The Bloom filter is expected to be validated and sized by the caller
+ * Returns 1 if the hash is possibly contained or 0 if definitely not
+ */
+int libcdirectory_bloom_filter_contains_hash(
+     const libcdirectory_bloom_filter_t *bloom_filter,
+     uint64_t hash )
+{
+	uint64_t bit_index     = 0;
+	uint64_t first_hash    = hash & 0xffffffffUL;
+	uint64_t second_hash   = ( hash >> 32 ) | 1;
+	uint8_t function_index = 0;
+
+	for( function_index = 0;
+	     function_index < bloom_filter->number_of_hash_functions;
+	     function_index++ )
+	{
+		bit_index = ( first_hash + ( function_index * second_hash ) ) % bloom_filter->number_of_bits;
+
+		if( ( bloom_filter->bitmap[ bit_index >> 3 ] & (uint8_t) ( 1 << ( bit_index & 0x07 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
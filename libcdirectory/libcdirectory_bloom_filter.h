@@ -0,0 +1,115 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_BLOOM_FILTER_H )
+#define _LIBCDIRECTORY_BLOOM_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default and maximum number of bits per entry
+ */
+#define LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY	10
+#define LIBCDIRECTORY_BLOOM_FILTER_MAXIMUM_BITS_PER_ENTRY	64
+
+/* The minimum number of bits
+ */
+#define LIBCDIRECTORY_BLOOM_FILTER_MINIMUM_NUMBER_OF_BITS	64
+
+typedef struct libcdirectory_bloom_filter libcdirectory_bloom_filter_t;
+
+struct libcdirectory_bloom_filter
+{
+	/* The bitmap
+	 */
+	uint8_t *bitmap;
+
+	/* The bitmap size
+	 */
+	size_t bitmap_size;
+
+	/* The allocated bitmap size
+	 */
+	size_t allocated_bitmap_size;
+
+	/* The number of bits in the bitmap
+	 */
+	uint64_t number_of_bits;
+
+	/* The number of hash functions
+	 */
+	uint8_t number_of_hash_functions;
+
+	/* The case folded key of the name that is hashed
+	 */
+	libuna_unicode_character_t *key;
+
+	/* The number of allocated Unicode characters in the key
+	 */
+	size_t allocated_key_length;
+};
+
+int libcdirectory_bloom_filter_initialize(
+     libcdirectory_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error );
+
+int libcdirectory_bloom_filter_free(
+     libcdirectory_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error );
+
+int libcdirectory_bloom_filter_resize(
+     libcdirectory_bloom_filter_t *bloom_filter,
+     int number_of_entries,
+     uint8_t bits_per_entry,
+     libcerror_error_t **error );
+
+uint64_t libcdirectory_bloom_filter_calculate_hash(
+          const libuna_unicode_character_t *key,
+          size_t key_length );
+
+int libcdirectory_bloom_filter_get_name_hash(
+     libcdirectory_bloom_filter_t *bloom_filter,
+     const char *name,
+     size_t name_length,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+void libcdirectory_bloom_filter_insert_hash(
+      libcdirectory_bloom_filter_t *bloom_filter,
+      uint64_t hash );
+
+int libcdirectory_bloom_filter_contains_hash(
+     const libcdirectory_bloom_filter_t *bloom_filter,
+     uint64_t hash );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_BLOOM_FILTER_H ) */
+
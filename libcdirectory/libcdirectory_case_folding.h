@@ -0,0 +1,42 @@
+/*
+ * Case folding functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_CASE_FOLDING_H )
+#define _LIBCDIRECTORY_CASE_FOLDING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+libuna_unicode_character_t libcdirectory_case_folding_get_character(
+                            libuna_unicode_character_t unicode_character );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_CASE_FOLDING_H ) */
+
@@ -0,0 +1,221 @@
+/*
+ * Checkpoint functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdirectory_checkpoint.h"
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_libcerror.h"
+
+/* The checkpoint data is stored in little-endian as:
+ * offset  0, size 4: the signature "cdcp"
+ * offset  4, size 4: the format version
+ * offset  8, size 8: the device number
+ * offset 16, size 8: the inode number
+ * offset 24, size 8: the modification time
+ * offset 32, size 8: the position
+ */
+static const uint8_t libcdirectory_checkpoint_signature[ 4 ] = {
+	'c', 'd', 'c', 'p' };
+
+/* Reads a checkpoint from data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_checkpoint_read_data(
+     libcdirectory_checkpoint_t *checkpoint,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcdirectory_checkpoint_read_data";
+	uint64_t value_64bit    = 0;
+	uint32_t format_version = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBCDIRECTORY_CHECKPOINT_DATA_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     libcdirectory_checkpoint_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 format_version );
+
+	if( format_version != LIBCDIRECTORY_CHECKPOINT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 checkpoint->device_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 checkpoint->inode_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 value_64bit );
+
+	checkpoint->modification_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 32 ] ),
+	 checkpoint->position );
+
+	return( 1 );
+}
+
+/* Writes a checkpoint to data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_checkpoint_write_data(
+     const libcdirectory_checkpoint_t *checkpoint,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_checkpoint_write_data";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBCDIRECTORY_CHECKPOINT_DATA_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     libcdirectory_checkpoint_signature,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 LIBCDIRECTORY_CHECKPOINT_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 checkpoint->device_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 checkpoint->inode_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 (uint64_t) checkpoint->modification_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 32 ] ),
+	 checkpoint->position );
+
+	return( 1 );
+}
+
@@ -0,0 +1,76 @@
+/*
+ * Checkpoint functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_CHECKPOINT_H )
+#define _LIBCDIRECTORY_CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The checkpoint format version
+ */
+#define LIBCDIRECTORY_CHECKPOINT_FORMAT_VERSION		1
+
+typedef struct libcdirectory_checkpoint libcdirectory_checkpoint_t;
+
+struct libcdirectory_checkpoint
+{
+	/* The device number of the directory
+	 */
+	uint64_t device_number;
+
+	/* The inode number of the directory
+	 */
+	uint64_t inode_number;
+
+	/* The modification time of the directory, which is used as its generation
+	 */
+	int64_t modification_time;
+
+	/* The position
+	 */
+	uint64_t position;
+};
+
+int libcdirectory_checkpoint_read_data(
+     libcdirectory_checkpoint_t *checkpoint,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdirectory_checkpoint_write_data(
+     const libcdirectory_checkpoint_t *checkpoint,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_CHECKPOINT_H ) */
+
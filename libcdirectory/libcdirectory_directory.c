@@ -42,6 +42,10 @@
 #include <dirent.h>
 #endif
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #if defined( HAVE_FCNTL_H )
 #include <fcntl.h>
 #endif
@@ -50,12 +54,34 @@
 #include <unistd.h>
 #endif
 
+#include <time.h>
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC	0
+#endif
+
+#if !defined( O_DIRECTORY )
+#define O_DIRECTORY	0
+#endif
+
+#if !defined( IFTODT )
+#define IFTODT( mode )	( ( ( mode ) & 0170000 ) >> 12 )
+#endif
+
+#if !defined( DTTOIF )
+#define DTTOIF( type )	( ( type ) << 12 )
+#endif
+
+#include "libcdirectory_checkpoint.h"
 #include "libcdirectory_definitions.h"
 #include "libcdirectory_directory.h"
 #include "libcdirectory_directory_entry.h"
 #include "libcdirectory_libcerror.h"
+#include "libcdirectory_pattern.h"
+#include "libcdirectory_string_compare.h"
 #include "libcdirectory_system_string.h"
 #include "libcdirectory_types.h"
+#include "libcdirectory_unused.h"
 #include "libcdirectory_wide_string.h"
 
 /* Creates a directory
@@ -119,8 +145,13 @@ int libcdirectory_directory_initialize(
 
 		goto on_error;
 	}
+	internal_directory->filter_entry_type_flags     = LIBCDIRECTORY_ENTRY_TYPE_FLAG_ALL;
+	internal_directory->bloom_filter_bits_per_entry = LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY;
+
 #if defined( WINAPI )
 	internal_directory->handle = INVALID_HANDLE_VALUE;
+#elif defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	internal_directory->descriptor = -1;
 #endif
 
 	*directory = (libcdirectory_directory_t *) internal_directory;
@@ -164,6 +195,9 @@ int libcdirectory_directory_free(
 
 #if defined( WINAPI )
 		if( internal_directory->handle != INVALID_HANDLE_VALUE )
+#elif defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+		if( ( internal_directory->stream != NULL )
+		 || ( internal_directory->descriptor != -1 ) )
 #else
 		if( internal_directory->stream != NULL )
 #endif
@@ -182,7 +216,7 @@ int libcdirectory_directory_free(
 				result = -1;
 			}
 		}
-#if defined( HAVE_DIRENT_H ) && !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 		if( internal_directory->path != NULL )
 		{
 			memory_free(
@@ -191,6 +225,22 @@ int libcdirectory_directory_free(
 			internal_directory->path = NULL;
 		}
 #endif
+		if( internal_directory->filter_pattern != NULL )
+		{
+			if( libcdirectory_pattern_free(
+			     &( internal_directory->filter_pattern ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filter pattern.",
+				 function );
+
+				result = -1;
+			}
+		}
 		*directory = NULL;
 
 		memory_free(
@@ -396,8 +446,10 @@ int libcdirectory_directory_open(
 
 		goto on_error;
 	}
-	memory_free(
-	 system_directory_name );
+	/* The search path is retained to open subdirectories
+	 */
+	internal_directory->path      = system_directory_name;
+	internal_directory->path_size = system_directory_name_size;
 
 	return( 1 );
 
@@ -435,7 +487,7 @@ int libcdirectory_directory_open(
 	libcdirectory_internal_directory_t *internal_directory = NULL;
 	static char *function                                  = "libcdirectory_directory_open";
 
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 	char *system_directory_name                            = NULL;
 	size_t directory_name_length                           = 0;
 	size_t system_directory_name_size                      = 0;
@@ -476,22 +528,58 @@ int libcdirectory_directory_open(
 
 		return( -1 );
 	}
-	internal_directory->stream = opendir(
-	                              directory_name );
-
-	if( internal_directory->stream == NULL )
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 errno,
-		 "%s: unable to open directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - descriptor value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+#endif
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->read_buffer_size != 0 )
+	{
+		if( libcdirectory_internal_directory_open_descriptor(
+		     internal_directory,
+		     AT_FDCWD,
+		     directory_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		internal_directory->stream = opendir(
+		                              directory_name );
+
+		if( internal_directory->stream == NULL )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 	directory_name_length = narrow_string_length(
 	                         directory_name );
 
@@ -548,12 +636,12 @@ int libcdirectory_directory_open(
 	internal_directory->path      = system_directory_name;
 	internal_directory->path_size = system_directory_name_size;
 
-#endif /* !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE ) */
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH ) */
 
 	return( 1 );
 
 on_error:
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 	if( system_directory_name != NULL )
 	{
 		memory_free(
@@ -766,8 +854,10 @@ int libcdirectory_directory_open_wide(
 
 		goto on_error;
 	}
-	memory_free(
-	 system_directory_name );
+	/* The search path is retained to open subdirectories
+	 */
+	internal_directory->path      = system_directory_name;
+	internal_directory->path_size = system_directory_name_size;
 
 	return( 1 );
 
@@ -843,7 +933,20 @@ int libcdirectory_directory_open_wide(
 
 		return( -1 );
 	}
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 	if( internal_directory->path != NULL )
 	{
 		libcerror_error_set(
@@ -904,22 +1007,45 @@ int libcdirectory_directory_open_wide(
 
 		goto on_error;
 	}
-	internal_directory->stream = opendir(
-	                              system_directory_name );
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->read_buffer_size != 0 )
+	{
+		if( libcdirectory_internal_directory_open_descriptor(
+		     internal_directory,
+		     AT_FDCWD,
+		     system_directory_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open directory.",
+			 function );
 
-	if( internal_directory->stream == NULL )
+			goto on_error;
+		}
+	}
+	else
+#endif
 	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 errno,
-		 "%s: unable to open directory.",
-		 function );
+		internal_directory->stream = opendir(
+		                              system_directory_name );
 
-		goto on_error;
+		if( internal_directory->stream == NULL )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open directory.",
+			 function );
+
+			goto on_error;
+		}
 	}
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 	internal_directory->path      = system_directory_name;
 	internal_directory->path_size = system_directory_name_size;
 #else
@@ -945,22 +1071,21 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-#if defined( WINAPI ) && ( WINVER >= 0x0400 )
+#if defined( LIBCDIRECTORY_HAVE_DIRFD )
 
-/* Closes a directory
- * This function uses the WINAPI function for Windows XP or later
- * Returns 0 if successful or -1 on error
+/* Retrieves the file descriptor of an open directory
+ * The file descriptor remains owned by the directory
+ * Returns 1 if successful or -1 on error
  */
-int libcdirectory_directory_close(
-     libcdirectory_directory_t *directory,
+int libcdirectory_internal_directory_get_descriptor(
+     libcdirectory_internal_directory_t *internal_directory,
+     int *descriptor,
      libcerror_error_t **error )
 {
-	libcdirectory_internal_directory_t *internal_directory = NULL;
-	static char *function                                  = "libcdirectory_directory_close";
-	int result                                             = 0;
-	DWORD error_code                                       = 0;
+	static char *function = "libcdirectory_internal_directory_get_descriptor";
+	int safe_descriptor   = -1;
 
-	if( directory == NULL )
+	if( internal_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -971,312 +1096,281 @@ int libcdirectory_directory_close(
 
 		return( -1 );
 	}
-	internal_directory = (libcdirectory_internal_directory_t *) directory;
-
-	if( internal_directory->handle != INVALID_HANDLE_VALUE )
+	if( descriptor == NULL )
 	{
-		if( FindClose(
-		     internal_directory->handle ) == 0 )
-		{
-			error_code = GetLastError();
-
-			libcerror_system_set_error(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 error_code,
-			 "%s: unable to close directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
 
-			result = -1;
-		}
-		internal_directory->handle = INVALID_HANDLE_VALUE;
+		return( -1 );
 	}
-	if( internal_directory->first_entry != NULL )
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
 	{
-		if( libcdirectory_directory_entry_free(
-		     &( internal_directory->first_entry ),
-		     error ) != 1 )
+		safe_descriptor = internal_directory->descriptor;
+	}
+	else
+#endif
+	{
+		if( internal_directory->stream == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free first entry.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid directory - missing stream.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-	}
-	return( result );
-}
-
-#elif defined( WINAPI )
-
-/* TODO */
-#error WINAPI close directory for Windows earlier than NT4 not implemented
-
-#elif defined( HAVE_CLOSEDIR )
-
-/* Closes a directory
- * This function uses the POSIX closedir function
- * Returns 0 if successful or -1 on error
- */
-int libcdirectory_directory_close(
-     libcdirectory_directory_t *directory,
-     libcerror_error_t **error )
-{
-	libcdirectory_internal_directory_t *internal_directory = NULL;
-	static char *function                                  = "libcdirectory_directory_close";
-	int result                                             = 0;
-
-	if( directory == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
-		 function );
-
-		return( -1 );
-	}
-	internal_directory = (libcdirectory_internal_directory_t *) directory;
+		safe_descriptor = dirfd(
+		                   internal_directory->stream );
 
-	if( internal_directory->stream != NULL )
-	{
-		if( closedir(
-		     internal_directory->stream ) != 0 )
+		if( safe_descriptor == -1 )
 		{
 			libcerror_system_set_error(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 errno,
-			 "%s: unable to close directory.",
+			 "%s: unable to retrieve descriptor from stream.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-		internal_directory->stream = NULL;
 	}
-	return( result );
+	*descriptor = safe_descriptor;
+
+	return( 1 );
 }
 
-#else
-#error Missing close directory function
-#endif
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRFD ) */
 
-#if defined( WINAPI ) && ( WINVER >= 0x0400 )
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
 
-/* Reads a directory
- * This function uses the WINAPI function for Windows XP or later
- * Returns 1 if successful, 0 if no such entry or -1 on error
+/* Retrieves the device and inode number of an open directory
+ * Returns 1 if successful or -1 on error
  */
-int libcdirectory_directory_read_entry(
-     libcdirectory_directory_t *directory,
-     libcdirectory_directory_entry_t *directory_entry,
+int libcdirectory_internal_directory_get_file_identifier(
+     libcdirectory_internal_directory_t *internal_directory,
+     uint64_t *device_number,
+     uint64_t *inode_number,
      libcerror_error_t **error )
 {
-	libcdirectory_internal_directory_t *internal_directory             = NULL;
-	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
-	static char *function                                              = "libcdirectory_directory_read_entry";
-	DWORD error_code                                                   = 0;
+	struct stat file_statistics;
 
-	if( directory == NULL )
+	static char *function = "libcdirectory_internal_directory_get_file_identifier";
+	int descriptor        = -1;
+
+	if( device_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
+		 "%s: invalid device number.",
 		 function );
 
 		return( -1 );
 	}
-	internal_directory = (libcdirectory_internal_directory_t *) directory;
-
-	if( directory_entry == NULL )
+	if( inode_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 "%s: invalid inode number.",
 		 function );
 
 		return( -1 );
 	}
-	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
-
-	if( internal_directory->handle == INVALID_HANDLE_VALUE )
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid directory - missing handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_directory->first_entry != NULL )
+	if( fstat(
+	     descriptor,
+	     &file_statistics ) != 0 )
 	{
-		if( libcdirectory_directory_entry_copy(
-		     directory_entry,
-		     internal_directory->first_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy first directory entry.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdirectory_directory_entry_free(
-		     (libcdirectory_directory_t **) &( internal_directory->first_entry ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free first entry.",
-			 function );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve directory file statistics.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	else
-	{
-#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( internal_directory_entry->narrow_name != NULL )
-		{
-			memory_free(
-			 internal_directory_entry->narrow_name );
-
-			internal_directory_entry->narrow_name = NULL;
-		}
-#else
-		if( internal_directory_entry->wide_name != NULL )
-		{
-			memory_free(
-			 internal_directory_entry->wide_name );
-
-			internal_directory_entry->wide_name = NULL;
-		}
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-		if( FindNextFile(
-		     internal_directory->handle,
-		     &( internal_directory_entry->find_data ) ) == 0 )
-		{
-			error_code = GetLastError();
+	*device_number = (uint64_t) file_statistics.st_dev;
+	*inode_number  = (uint64_t) file_statistics.st_ino;
 
-			if( error_code == ERROR_NO_MORE_FILES )
-			{
-				return( 0 );
-			}
-			else
-			{
-				libcerror_system_set_error(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 error_code,
-				 "%s: unable to read from directory.",
-				 function );
-			}
-			return( -1 );
-		}
-	}
 	return( 1 );
 }
 
-#elif defined( WINAPI )
-
-/* TODO */
-#error WINAPI read directory entry for Windows earlier than NT4 not implemented
-
-#elif defined( HAVE_READDIR ) || defined( HAVE_READDIR_R )
-
-/* Reads a directory
- * This function uses the POSIX readdir or readdir_r function
- * Returns 1 if successful, 0 if no such entry or -1 on error
+/* Retrieves the values of an open directory that change when its entries change
+ * These are the device and inode number, which identify the directory, and
+ * the modification and inode change time in POSIX time in nanoseconds
+ * Returns 1 if successful or -1 on error
  */
-int libcdirectory_directory_read_entry(
-     libcdirectory_directory_t *directory,
-     libcdirectory_directory_entry_t *directory_entry,
+int libcdirectory_internal_directory_get_change_values(
+     libcdirectory_internal_directory_t *internal_directory,
+     uint64_t *device_number,
+     uint64_t *inode_number,
+     int64_t *modification_time,
+     int64_t *inode_change_time,
      libcerror_error_t **error )
 {
-	libcdirectory_internal_directory_t *internal_directory             = NULL;
-	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
-	struct dirent *result_directory_entry                              = NULL;
-	static char *function                                              = "libcdirectory_directory_read_entry";
-	int result                                                         = 0;
-
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
 	struct stat file_statistics;
 
-	system_character_t *system_directory_entry_path                    = NULL;
-	size_t directory_entry_name_length                                 = 0;
-	size_t system_directory_entry_path_index                           = 0;
-	size_t system_directory_entry_path_size                            = 0;
-#endif
+	static char *function = "libcdirectory_internal_directory_get_change_values";
+	int descriptor        = -1;
 
-	if( directory == NULL )
+	if( device_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
+		 "%s: invalid device number.",
 		 function );
 
 		return( -1 );
 	}
-	internal_directory = (libcdirectory_internal_directory_t *) directory;
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
 
-	if( directory_entry == NULL )
+		return( -1 );
+	}
+	if( modification_time == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 "%s: invalid modification time.",
 		 function );
 
 		return( -1 );
 	}
-	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+	if( inode_change_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode change time.",
+		 function );
 
-	if( internal_directory->stream == NULL )
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid directory - missing stream.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
-	if( internal_directory->path == NULL )
+	if( fstat(
+	     descriptor,
+	     &file_statistics ) != 0 )
 	{
-		libcerror_error_set(
+		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid directory - missing path.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve directory file statistics.",
 		 function );
 
 		return( -1 );
 	}
+	*device_number = (uint64_t) file_statistics.st_dev;
+	*inode_number  = (uint64_t) file_statistics.st_ino;
+
+#if defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	*modification_time = ( (int64_t) file_statistics.st_mtim.tv_sec * 1000000000 )
+	                   + file_statistics.st_mtim.tv_nsec;
+	*inode_change_time = ( (int64_t) file_statistics.st_ctim.tv_sec * 1000000000 )
+	                   + file_statistics.st_ctim.tv_nsec;
+#elif defined( HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC )
+	*modification_time = ( (int64_t) file_statistics.st_mtimespec.tv_sec * 1000000000 )
+	                   + file_statistics.st_mtimespec.tv_nsec;
+	*inode_change_time = ( (int64_t) file_statistics.st_ctimespec.tv_sec * 1000000000 )
+	                   + file_statistics.st_ctimespec.tv_nsec;
+#else
+	*modification_time = (int64_t) file_statistics.st_mtime * 1000000000;
+	*inode_change_time = (int64_t) file_statistics.st_ctime * 1000000000;
 #endif
+	return( 1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER ) */
+
+#if defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) || defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+
+/* Sets the values of a directory entry that was looked up by name
+ * The name of the directory entry must have been copied before
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_set_entry_values(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint64_t inode_number,
+     uint16_t file_mode,
+     int descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_set_entry_values";
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( internal_directory_entry->narrow_name != NULL )
 	{
@@ -1295,190 +1389,5286 @@ int libcdirectory_directory_read_entry(
 	}
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 
-#if defined( HAVE_READDIR ) && ( !defined( HAVE_READDIR_R ) || defined( HAVE_DEPRECATED_READDIR_R ) )
+	internal_directory_entry->entry.d_ino = (ino_t) inode_number;
 
-	errno = 0;
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	internal_directory_entry->entry.d_type = (unsigned char) IFTODT( file_mode );
+#else
+	internal_directory_entry->st_mode = (mode_t) file_mode;
+#endif
+	internal_directory_entry->view_name                         = NULL;
+	internal_directory_entry->flags                             = internal_directory->flags;
+	internal_directory_entry->file_statistics_flags             = 0;
+	internal_directory_entry->file_statistics_unavailable_flags = 0;
 
-	result_directory_entry = readdir(
-	                          internal_directory->stream );
+	libcdirectory_internal_directory_entry_attach(
+	 internal_directory_entry,
+	 &( internal_directory->first_attached_entry ),
+	 descriptor );
 
-	if( ( result_directory_entry == NULL )
-	  && ( errno != 0 ) )
-	{
-		result = -1;
-	}
-#else
-	result = readdir_r(
-	          internal_directory->stream,
-	          &( internal_directory_entry->entry ),
-	          &result_directory_entry );
+	return( 1 );
+}
 
-#endif /* defined( HAVE_READDIR ) && ( !defined( HAVE_READDIR_R ) || defined( HAVE_DEPRECATED_READDIR_R ) ) */
+#endif /* defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) || defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
 
-	if( result != 0 )
+#if defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE )
+
+/* Looks up a directory entry by name without reading the directory
+ * The entry is looked up with fstatat relative to the directory descriptor
+ * If the entry is found the name of the directory entry is set to the name that
+ * was looked up, which on a case insensitive mount can differ in case from the
+ * name stored in the directory
+ * Returns 1 if the entry was looked up, 0 if the entry cannot be looked up
+ * without reading the directory or -1 on error
+ */
+int libcdirectory_internal_directory_probe_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *entry_name,
+     size_t entry_name_length,
+     int *entry_found,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libcdirectory_internal_directory_probe_entry";
+	int descriptor        = -1;
+
+	if( internal_directory == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 errno,
-		 "%s: unable to read from directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( result_directory_entry == NULL )
+	if( internal_directory_entry == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_READDIR ) && ( !defined( HAVE_READDIR_R ) || defined( HAVE_DEPRECATED_READDIR_R ) )
-	if( memory_copy(
-	     &( internal_directory_entry->entry ),
-	     result_directory_entry,
-	     sizeof( struct dirent ) ) == NULL )
+	if( entry_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
-	directory_entry_name_length = narrow_string_length(
-	                               (char *) internal_directory_entry->entry.d_name );
-
-	if( ( directory_entry_name_length == 1 )
-	 && ( internal_directory_entry->entry.d_name[ 0 ] == '.' ) )
+	if( entry_found == NULL )
 	{
-		file_statistics.st_mode = S_IFDIR;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry found.",
+		 function );
+
+		return( -1 );
 	}
-	else if( ( directory_entry_name_length == 2 )
-	      && ( internal_directory_entry->entry.d_name[ 0 ] == '.' )
-	      && ( internal_directory_entry->entry.d_name[ 1 ] == '.' ) )
+	*entry_found = 0;
+
+	/* A name that cannot be stored in a directory entry cannot match an entry of the directory
+	 */
+	if( ( entry_name_length == 0 )
+	 || ( entry_name_length >= sizeof( internal_directory_entry->entry.d_name ) ) )
 	{
-		file_statistics.st_mode = S_IFDIR;
+		return( 1 );
 	}
-	else
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
 	{
-		system_directory_entry_path_size = internal_directory->path_size + directory_entry_name_length + 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
+		 function );
 
-		system_directory_entry_path = system_string_allocate(
-		                               system_directory_entry_path_size );
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_entry_copy_name(
+	     internal_directory_entry,
+	     entry_name,
+	     entry_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
 
-		if( system_directory_entry_path == NULL )
+		return( -1 );
+	}
+	/* A name that contains an end-of-string character or that would be resolved
+	 * as a path cannot match an entry of the directory
+	 */
+	if( ( narrow_string_length(
+	       internal_directory_entry->entry.d_name ) != entry_name_length )
+	 || ( narrow_string_search_character(
+	       internal_directory_entry->entry.d_name,
+	       '/',
+	       entry_name_length ) != NULL ) )
+	{
+		return( 1 );
+	}
+	if( fstatat(
+	     descriptor,
+	     internal_directory_entry->entry.d_name,
+	     &file_statistics,
+	     AT_SYMLINK_NOFOLLOW ) != 0 )
+	{
+		if( ( errno == ENOENT )
+		 || ( errno == ENOTDIR )
+		 || ( errno == ENAMETOOLONG ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create system character directory entry path.",
-			 function );
-
-			goto on_error;
+			return( 1 );
 		}
-		if( system_string_copy(
-		     system_directory_entry_path,
-		     internal_directory->path,
-		     internal_directory->path_size - 1 ) == NULL )
+		/* Without search permission on the directory the entry can still be
+		 * looked up by reading the directory
+		 */
+		if( ( errno == EACCES )
+		 || ( errno == EPERM ) )
 		{
-			libcerror_error_set(
-			 error,
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve entry file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_set_entry_values(
+	     internal_directory,
+	     internal_directory_entry,
+	     (uint64_t) file_statistics.st_ino,
+	     (uint16_t) file_statistics.st_mode,
+	     descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory entry values.",
+		 function );
+
+		return( -1 );
+	}
+
+	libcdirectory_internal_directory_entry_set_file_statistics(
+	 internal_directory_entry,
+	 &file_statistics );
+
+	*entry_found = 1;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+
+/* Retrieves the modification time of an open directory
+ * The modification time is stored in POSIX time in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_get_modification_time(
+     libcdirectory_internal_directory_t *internal_directory,
+     int64_t *modification_time,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libcdirectory_internal_directory_get_modification_time";
+	int descriptor        = -1;
+
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve directory file statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	*modification_time = ( (int64_t) file_statistics.st_mtim.tv_sec * 1000000000 )
+	                   + file_statistics.st_mtim.tv_nsec;
+#elif defined( HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC )
+	*modification_time = ( (int64_t) file_statistics.st_mtimespec.tv_sec * 1000000000 )
+	                   + file_statistics.st_mtimespec.tv_nsec;
+#else
+	*modification_time = (int64_t) file_statistics.st_mtime * 1000000000;
+#endif
+	return( 1 );
+}
+
+/* Determines if a modification time of a directory is within the racy interval
+ * of the current time, in which case a subsequent change of the directory does
+ * not necessarily change the modification time
+ * Returns 1 if racy or 0 if not
+ */
+int libcdirectory_internal_directory_is_racy_modification_time(
+     int64_t modification_time )
+{
+	time_t current_time = 0;
+
+	current_time = time(
+	                NULL );
+
+	/* A current time that cannot be determined makes every modification time racy
+	 */
+	if( current_time == (time_t) -1 )
+	{
+		return( 1 );
+	}
+	if( modification_time >= ( ( (int64_t) current_time * 1000000000 ) - LIBCDIRECTORY_DIRECTORY_RACY_INTERVAL ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Builds the name index
+ * The entries are read using a separate directory that is opened relative
+ * to the directory, so that the read position of the directory is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_build_name_index(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *directory_entry                   = NULL;
+	libcdirectory_directory_t *index_directory                         = NULL;
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	libcdirectory_internal_directory_t *internal_index_directory       = NULL;
+	char *entry_name                                                   = NULL;
+	static char *function                                              = "libcdirectory_internal_directory_build_name_index";
+	int64_t modification_time                                          = 0;
+	uint16_t file_mode                                                 = 0;
+	uint8_t entry_type                                                 = 0;
+	int is_racy                                                        = 0;
+	int result                                                         = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	/* The modification time is retrieved before the entries are read
+	 * so that changes made while reading invalidate the name index
+	 */
+	if( libcdirectory_internal_directory_get_modification_time(
+	     internal_directory,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory modification time.",
+		 function );
+
+		goto on_error;
+	}
+	is_racy = libcdirectory_internal_directory_is_racy_modification_time(
+	           modification_time );
+
+	if( internal_directory->name_index == NULL )
+	{
+		if( libcdirectory_name_index_initialize(
+		     &( internal_directory->name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libcdirectory_name_index_empty(
+	          internal_directory->name_index,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_initialize(
+	     &index_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_index_directory = (libcdirectory_internal_directory_t *) index_directory;
+
+	internal_index_directory->read_buffer_size = internal_directory->read_buffer_size;
+	internal_index_directory->flags            = internal_directory->flags & LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE;
+
+	if( libcdirectory_internal_directory_open_at(
+	     internal_index_directory,
+	     internal_directory,
+	     _SYSTEM_STRING( "." ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	do
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          internal_index_directory,
+		          internal_directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     directory_entry,
+		     &entry_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		/* Store the resolved file type if the entry type was resolved on demand
+		 */
+		if( ( internal_directory_entry->file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE ) != 0 )
+		{
+			file_mode = internal_directory_entry->file_mode & S_IFMT;
+		}
+		else
+		{
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+			file_mode = (uint16_t) DTTOIF( internal_directory_entry->entry.d_type );
+#else
+			file_mode = (uint16_t) ( internal_directory_entry->st_mode & S_IFMT );
+#endif
+		}
+		if( libcdirectory_name_index_append_entry(
+		     internal_directory->name_index,
+		     entry_name,
+		     narrow_string_length(
+		      entry_name ),
+		     entry_type,
+		     file_mode,
+		     (uint64_t) internal_directory_entry->entry.d_ino,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &index_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_name_index_build(
+	     internal_directory->name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name index.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory->name_index_modification_time = modification_time;
+	internal_directory->name_index_is_racy           = (uint8_t) is_racy;
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( index_directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &index_directory,
+		 NULL );
+	}
+	if( internal_directory->name_index != NULL )
+	{
+		libcdirectory_name_index_free(
+		 &( internal_directory->name_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Looks up a directory entry by name using the name index
+ * The name index is built on the first look up and rebuilt when
+ * the modification time of the directory has changed or when the name
+ * index was built within the racy interval of the modification time
+ * Returns 1 if found, 0 if not or -1 on error
+ */
+int libcdirectory_internal_directory_get_indexed_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *entry_name,
+     size_t entry_name_length,
+     uint8_t entry_type,
+     uint8_t compare_flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_name_index_entry_t *name_index_entry = NULL;
+	const char *index_entry_name                       = NULL;
+	static char *function                              = "libcdirectory_internal_directory_get_indexed_entry";
+	int64_t modification_time                          = 0;
+	int descriptor                                     = -1;
+	int rebuild_name_index                             = 0;
+	int result                                         = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->name_index != NULL )
+	{
+		if( libcdirectory_internal_directory_get_modification_time(
+		     internal_directory,
+		     &modification_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory modification time.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( modification_time != internal_directory->name_index_modification_time )
+		 || ( internal_directory->name_index_is_racy != 0 ) )
+		{
+			rebuild_name_index = 1;
+		}
+	}
+	if( ( internal_directory->name_index == NULL )
+	 || ( rebuild_name_index != 0 ) )
+	{
+		if( libcdirectory_internal_directory_build_name_index(
+		     internal_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build name index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcdirectory_name_index_get_entry_by_name(
+	          internal_directory->name_index,
+	          entry_name,
+	          entry_name_length,
+	          entry_type,
+	          compare_flags,
+	          &name_index_entry,
+	          &index_entry_name,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name index entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_entry_copy_name(
+	     internal_directory_entry,
+	     index_entry_name,
+	     name_index_entry->name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_set_entry_values(
+	     internal_directory,
+	     internal_directory_entry,
+	     name_index_entry->inode_number,
+	     name_index_entry->file_mode,
+	     descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory entry values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the Bloom filter
+ * The entries are read using a separate directory that is opened relative
+ * to the directory, so that the read position of the directory is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_build_bloom_filter(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *directory_entry              = NULL;
+	libcdirectory_directory_t *filter_directory                   = NULL;
+	libcdirectory_internal_directory_t *internal_filter_directory = NULL;
+	char *entry_name                                              = NULL;
+	static char *function                                         = "libcdirectory_internal_directory_build_bloom_filter";
+	uint64_t *name_hashes                                         = NULL;
+	uint64_t *resized_name_hashes                                 = NULL;
+	int64_t modification_time                                     = 0;
+	int hash_index                                                = 0;
+	int number_of_allocated_name_hashes                           = 0;
+	int number_of_name_hashes                                     = 0;
+	int is_racy                                                   = 0;
+	int result                                                    = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	/* The modification time is retrieved before the entries are read
+	 * so that changes made while reading invalidate the Bloom filter
+	 */
+	if( libcdirectory_internal_directory_get_modification_time(
+	     internal_directory,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory modification time.",
+		 function );
+
+		goto on_error;
+	}
+	is_racy = libcdirectory_internal_directory_is_racy_modification_time(
+	           modification_time );
+
+	if( internal_directory->bloom_filter == NULL )
+	{
+		if( libcdirectory_bloom_filter_initialize(
+		     &( internal_directory->bloom_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Bloom filter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdirectory_directory_initialize(
+	     &filter_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filter directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_filter_directory = (libcdirectory_internal_directory_t *) filter_directory;
+
+	internal_filter_directory->read_buffer_size = internal_directory->read_buffer_size;
+
+	if( libcdirectory_internal_directory_open_at(
+	     internal_filter_directory,
+	     internal_directory,
+	     _SYSTEM_STRING( "." ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open filter directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	/* The names are hashed while reading since the size of the Bloom filter
+	 * depends on the number of entries
+	 */
+	do
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          internal_filter_directory,
+		          (libcdirectory_internal_directory_entry_t *) directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     directory_entry,
+		     &entry_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_name_hashes >= number_of_allocated_name_hashes )
+		{
+			if( number_of_allocated_name_hashes == 0 )
+			{
+				number_of_allocated_name_hashes = 256;
+			}
+			else if( number_of_allocated_name_hashes > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of name hashes value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			else
+			{
+				number_of_allocated_name_hashes *= 2;
+			}
+			if( (size_t) number_of_allocated_name_hashes > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of name hashes value exceeds maximum allocation size.",
+				 function );
+
+				goto on_error;
+			}
+			resized_name_hashes = (uint64_t *) memory_reallocate(
+			                                    name_hashes,
+			                                    sizeof( uint64_t ) * number_of_allocated_name_hashes );
+
+			if( resized_name_hashes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize name hashes.",
+				 function );
+
+				goto on_error;
+			}
+			name_hashes = resized_name_hashes;
+		}
+		if( libcdirectory_bloom_filter_get_name_hash(
+		     internal_directory->bloom_filter,
+		     entry_name,
+		     narrow_string_length(
+		      entry_name ),
+		     &( name_hashes[ number_of_name_hashes ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name hash.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_name_hashes++;
+	}
+	while( result != 0 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &filter_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filter directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_bloom_filter_resize(
+	     internal_directory->bloom_filter,
+	     number_of_name_hashes,
+	     internal_directory->bloom_filter_bits_per_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	for( hash_index = 0;
+	     hash_index < number_of_name_hashes;
+	     hash_index++ )
+	{
+		libcdirectory_bloom_filter_insert_hash(
+		 internal_directory->bloom_filter,
+		 name_hashes[ hash_index ] );
+	}
+	if( name_hashes != NULL )
+	{
+		memory_free(
+		 name_hashes );
+	}
+	internal_directory->bloom_filter_modification_time = modification_time;
+	internal_directory->bloom_filter_is_racy           = (uint8_t) is_racy;
+
+	return( 1 );
+
+on_error:
+	if( name_hashes != NULL )
+	{
+		memory_free(
+		 name_hashes );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( filter_directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &filter_directory,
+		 NULL );
+	}
+	if( internal_directory->bloom_filter != NULL )
+	{
+		libcdirectory_bloom_filter_free(
+		 &( internal_directory->bloom_filter ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if the Bloom filter contains a name
+ * The Bloom filter is built on the first look up and rebuilt when
+ * the modification time of the directory has changed or when the Bloom
+ * filter was built within the racy interval of the modification time.
+ * A Bloom filter built within the racy interval is not used to rule out names
+ * Returns 1 if the directory possibly contains the name, 0 if definitely not or -1 on error
+ */
+int libcdirectory_internal_directory_bloom_filter_contains_name(
+     libcdirectory_internal_directory_t *internal_directory,
+     const char *entry_name,
+     size_t entry_name_length,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcdirectory_internal_directory_bloom_filter_contains_name";
+	uint64_t name_hash        = 0;
+	int64_t modification_time = 0;
+	int rebuild_bloom_filter  = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_modification_time(
+	     internal_directory,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory modification time.",
+		 function );
+
+		return( -1 );
+	}
+	/* A Bloom filter built now would not be used, hence it is not built
+	 * until the modification time is outside the racy interval
+	 */
+	if( libcdirectory_internal_directory_is_racy_modification_time(
+	     modification_time ) != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_directory->bloom_filter != NULL )
+	{
+		if( ( modification_time != internal_directory->bloom_filter_modification_time )
+		 || ( internal_directory->bloom_filter_is_racy != 0 ) )
+		{
+			rebuild_bloom_filter = 1;
+		}
+	}
+	if( ( internal_directory->bloom_filter == NULL )
+	 || ( rebuild_bloom_filter != 0 ) )
+	{
+		if( libcdirectory_internal_directory_build_bloom_filter(
+		     internal_directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_directory->bloom_filter_is_racy != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libcdirectory_bloom_filter_get_name_hash(
+	     internal_directory->bloom_filter,
+	     entry_name,
+	     entry_name_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcdirectory_bloom_filter_contains_hash(
+	         internal_directory->bloom_filter,
+	         name_hash ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 )
+
+/* Opens a directory relative to a parent directory
+ * This function uses the WINAPI function for Windows XP or later
+ * WINAPI does not provide a handle relative open hence the search path of the parent directory is used
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_open_at(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_t *internal_parent_directory,
+     const system_character_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_first_directory_entry = NULL;
+	system_character_t *system_directory_name                                = NULL;
+	static char *function                                                    = "libcdirectory_internal_directory_open_at";
+	size_t system_directory_name_index                                       = 0;
+	size_t system_directory_name_size                                        = 0;
+	DWORD error_code                                                         = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->handle != INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->first_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - first entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parent_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_parent_directory->path == NULL )
+	 || ( internal_parent_directory->path_size < 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parent directory - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - internal_parent_directory->path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The search path of the parent directory ends with \* where the * is replaced by the directory name
+	 */
+	system_directory_name_size = ( internal_parent_directory->path_size - 2 ) + directory_name_length + 3;
+
+	system_directory_name = system_string_allocate(
+	                         system_directory_name_size );
+
+	if( system_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create system character directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     system_directory_name,
+	     internal_parent_directory->path,
+	     internal_parent_directory->path_size - 2 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy parent directory path.",
+		 function );
+
+		goto on_error;
+	}
+	system_directory_name_index = internal_parent_directory->path_size - 2;
+
+	if( system_string_copy(
+	     &( system_directory_name[ system_directory_name_index ] ),
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	system_directory_name_index += directory_name_length;
+
+	system_directory_name[ system_directory_name_index++ ] = (system_character_t) '\\';
+	system_directory_name[ system_directory_name_index++ ] = (system_character_t) '*';
+	system_directory_name[ system_directory_name_index ]   = 0;
+
+	if( libcdirectory_directory_entry_initialize(
+	     &( internal_directory->first_entry ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create first entry.",
+		 function );
+
+		goto on_error;
+	}
+	internal_first_directory_entry = (libcdirectory_internal_directory_entry_t *) internal_directory->first_entry;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	internal_directory->handle = FindFirstFileW(
+	                              (LPCWSTR) system_directory_name,
+	                              &( internal_first_directory_entry->find_data ) );
+#else
+	internal_directory->handle = FindFirstFileA(
+	                              (LPCSTR) system_directory_name,
+	                              &( internal_first_directory_entry->find_data ) );
+#endif
+	if( internal_directory->handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* Note that FindFirstFile on a non-directory will be successful
+	 */
+	if( ( internal_first_directory_entry->find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unsupported file type - not a directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory->path      = system_directory_name;
+	internal_directory->path_size = system_directory_name_size;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory->handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 internal_directory->handle );
+
+		internal_directory->handle = INVALID_HANDLE_VALUE;
+	}
+	if( internal_directory->first_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &( internal_directory->first_entry ),
+		 NULL );
+	}
+	if( system_directory_name != NULL )
+	{
+		memory_free(
+		 system_directory_name );
+	}
+	return( -1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI open directory at for Windows earlier than NT4 not implemented
+
+#elif defined( LIBCDIRECTORY_HAVE_OPENAT )
+
+/* Opens a directory relative to a parent directory
+ * This function uses the POSIX openat and fdopendir functions
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_open_at(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_t *internal_parent_directory,
+     const system_character_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcdirectory_internal_directory_open_at";
+	int descriptor                               = -1;
+	int parent_descriptor                        = -1;
+
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	system_character_t *system_directory_name    = NULL;
+	size_t system_directory_name_index           = 0;
+	size_t system_directory_name_size            = 0;
+#endif
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) SSIZE_MAX )
+	 || ( directory_name[ directory_name_length ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_parent_directory,
+	     &parent_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent directory descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	if( internal_parent_directory->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parent directory - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - internal_parent_directory->path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path is needed to determine the type of the directory entries
+	 */
+	system_directory_name_size = internal_parent_directory->path_size + directory_name_length + 1;
+
+	system_directory_name = system_string_allocate(
+	                         system_directory_name_size );
+
+	if( system_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create system character directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     system_directory_name,
+	     internal_parent_directory->path,
+	     internal_parent_directory->path_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy parent directory path.",
+		 function );
+
+		goto on_error;
+	}
+	system_directory_name_index = internal_parent_directory->path_size - 1;
+
+	system_directory_name[ system_directory_name_index++ ] = (system_character_t) '/';
+
+	if( system_string_copy(
+	     &( system_directory_name[ system_directory_name_index ] ),
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	system_directory_name_index += directory_name_length;
+
+	system_directory_name[ system_directory_name_index ] = 0;
+
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH ) */
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->read_buffer_size != 0 )
+	{
+		if( libcdirectory_internal_directory_open_descriptor(
+		     internal_directory,
+		     parent_descriptor,
+		     directory_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		descriptor = openat(
+		              parent_descriptor,
+		              directory_name,
+		              O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+
+		if( descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open directory.",
+			 function );
+
+			goto on_error;
+		}
+		internal_directory->stream = fdopendir(
+		                              descriptor );
+
+		if( internal_directory->stream == NULL )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open directory stream.",
+			 function );
+
+			goto on_error;
+		}
+		/* The descriptor is now owned by the stream
+		 */
+		descriptor = -1;
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	if( internal_directory->path != NULL )
+	{
+		memory_free(
+		 internal_directory->path );
+	}
+	internal_directory->path      = system_directory_name;
+	internal_directory->path_size = system_directory_name_size;
+#endif
+
+	return( 1 );
+
+on_error:
+	if( descriptor != -1 )
+	{
+		close(
+		 descriptor );
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	if( system_directory_name != NULL )
+	{
+		memory_free(
+		 system_directory_name );
+	}
+#endif
+	return( -1 );
+}
+
+#else
+
+/* Opens a directory relative to a parent directory
+ * Returns -1 since the POSIX openat and fdopendir functions are not available
+ */
+int libcdirectory_internal_directory_open_at(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_t *internal_parent_directory,
+     const system_character_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_open_at";
+
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( internal_directory )
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( internal_parent_directory )
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( directory_name )
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( directory_name_length )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: missing openat and fdopendir support.",
+	 function );
+
+	return( -1 );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0400 ) */
+
+/* Opens a directory relative to a parent directory
+ * The parent directory must be open
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_open_at(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_t *parent_directory,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcdirectory_directory_open_at";
+	size_t directory_name_length              = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	system_character_t *system_directory_name = NULL;
+	size_t system_directory_name_size         = 0;
+#endif
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory == directory )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory value same as directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcdirectory_system_string_size_from_narrow_string(
+	     directory_name,
+	     directory_name_length + 1,
+	     &system_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine system character directory name size.",
+		 function );
+
+		goto on_error;
+	}
+	system_directory_name = system_string_allocate(
+	                         system_directory_name_size );
+
+	if( system_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create system character directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_system_string_copy_from_narrow_string(
+	     system_directory_name,
+	     system_directory_name_size,
+	     directory_name,
+	     directory_name_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set system character directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_internal_directory_open_at(
+	     (libcdirectory_internal_directory_t *) directory,
+	     (libcdirectory_internal_directory_t *) parent_directory,
+	     system_directory_name,
+	     system_directory_name_size - 1,
+	     error ) != 1 )
+#else
+	if( libcdirectory_internal_directory_open_at(
+	     (libcdirectory_internal_directory_t *) directory,
+	     (libcdirectory_internal_directory_t *) parent_directory,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_free(
+	 system_directory_name );
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_directory_name != NULL )
+	{
+		memory_free(
+		 system_directory_name );
+	}
+#endif
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a directory relative to a parent directory
+ * The parent directory must be open
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_open_at_wide(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_t *parent_directory,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcdirectory_directory_open_at_wide";
+	size_t directory_name_length              = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	system_character_t *system_directory_name = NULL;
+	size_t system_directory_name_size         = 0;
+#endif
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory == directory )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory value same as directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = wide_string_length(
+	                         directory_name );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcdirectory_system_string_size_from_wide_string(
+	     directory_name,
+	     directory_name_length + 1,
+	     &system_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine system character directory name size.",
+		 function );
+
+		goto on_error;
+	}
+	system_directory_name = system_string_allocate(
+	                         system_directory_name_size );
+
+	if( system_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create system character directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_system_string_copy_from_wide_string(
+	     system_directory_name,
+	     system_directory_name_size,
+	     directory_name,
+	     directory_name_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set system character directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_internal_directory_open_at(
+	     (libcdirectory_internal_directory_t *) directory,
+	     (libcdirectory_internal_directory_t *) parent_directory,
+	     system_directory_name,
+	     system_directory_name_size - 1,
+	     error ) != 1 )
+#else
+	if( libcdirectory_internal_directory_open_at(
+	     (libcdirectory_internal_directory_t *) directory,
+	     (libcdirectory_internal_directory_t *) parent_directory,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_free(
+	 system_directory_name );
+#endif
+	return( 1 );
+
+on_error:
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_directory_name != NULL )
+	{
+		memory_free(
+		 system_directory_name );
+	}
+#endif
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 )
+
+/* Closes a directory
+ * This function uses the WINAPI function for Windows XP or later
+ * Returns 0 if successful or -1 on error
+ */
+int libcdirectory_directory_close(
+     libcdirectory_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_close";
+	int result                                             = 0;
+	DWORD error_code                                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( internal_directory->handle != INVALID_HANDLE_VALUE )
+	{
+		if( FindClose(
+		     internal_directory->handle ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 error_code,
+			 "%s: unable to close directory.",
+			 function );
+
+			result = -1;
+		}
+		internal_directory->handle = INVALID_HANDLE_VALUE;
+	}
+	if( internal_directory->path != NULL )
+	{
+		memory_free(
+		 internal_directory->path );
+
+		internal_directory->path = NULL;
+	}
+	internal_directory->path_size     = 0;
+	internal_directory->read_position = 0;
+
+	if( internal_directory->first_entry != NULL )
+	{
+		if( libcdirectory_directory_entry_free(
+		     &( internal_directory->first_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free first entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI close directory for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_CLOSEDIR )
+
+/* Closes a directory
+ * This function uses the POSIX closedir function
+ * Returns 0 if successful or -1 on error
+ */
+int libcdirectory_directory_close(
+     libcdirectory_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_close";
+	int result                                             = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	/* The directory entries can no longer read their file statistics relative to the directory
+	 */
+	libcdirectory_internal_directory_entry_detach_all(
+	 &( internal_directory->first_attached_entry ) );
+
+	if( internal_directory->stream != NULL )
+	{
+		if( closedir(
+		     internal_directory->stream ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close directory.",
+			 function );
+
+			result = -1;
+		}
+		internal_directory->stream = NULL;
+	}
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		if( close(
+		     internal_directory->descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close directory.",
+			 function );
+
+			result = -1;
+		}
+		internal_directory->descriptor = -1;
+	}
+	if( internal_directory->read_buffer != NULL )
+	{
+		memory_free(
+		 internal_directory->read_buffer );
+
+		internal_directory->read_buffer = NULL;
+	}
+	internal_directory->read_buffer_offset    = 0;
+	internal_directory->read_buffer_data_size = 0;
+	internal_directory->read_position         = 0;
+
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	if( internal_directory->path != NULL )
+	{
+		memory_free(
+		 internal_directory->path );
+
+		internal_directory->path = NULL;
+	}
+	internal_directory->path_size = 0;
+
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+	if( internal_directory->name_index != NULL )
+	{
+		if( libcdirectory_name_index_free(
+		     &( internal_directory->name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_directory->name_index_modification_time = 0;
+	internal_directory->name_index_is_racy           = 0;
+
+	if( internal_directory->bloom_filter != NULL )
+	{
+		if( libcdirectory_bloom_filter_free(
+		     &( internal_directory->bloom_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Bloom filter.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_directory->bloom_filter_modification_time = 0;
+	internal_directory->bloom_filter_is_racy           = 0;
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
+
+	return( result );
+}
+
+#else
+#error Missing close directory function
+#endif
+
+/* Sets the read buffer size
+ * A size of 0 represents the system default read function. Other sizes
+ * make the directory read entries in bulk into a buffer of the size
+ * on platforms that support it (Linux getdents64), otherwise the size is ignored
+ * The read buffer size can only be set when the directory is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_set_read_buffer_size(
+     libcdirectory_directory_t *directory,
+     size_t read_buffer_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_set_read_buffer_size";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+#if defined( WINAPI )
+	if( internal_directory->handle != INVALID_HANDLE_VALUE )
+#elif defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( ( internal_directory->stream != NULL )
+	 || ( internal_directory->descriptor != -1 ) )
+#else
+	if( internal_directory->stream != NULL )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - directory already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_buffer_size != 0 )
+	 && ( read_buffer_size < LIBCDIRECTORY_DIRECTORY_MINIMUM_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid read buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_size > (size_t) LIBCDIRECTORY_DIRECTORY_MAXIMUM_READ_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->read_buffer_size = read_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the flags
+ * The flags apply to the directory entries read after they have been set
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_set_flags(
+     libcdirectory_directory_t *directory,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_set_flags";
+	uint8_t supported_flags                                = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	supported_flags = LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE
+	                | LIBCDIRECTORY_DIRECTORY_FLAG_INDEX_NAMES
+	                | LIBCDIRECTORY_DIRECTORY_FLAG_BLOOM_FILTER
+	                | LIBCDIRECTORY_DIRECTORY_FLAG_INODE_ORDER_FILE_STATISTICS;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	internal_directory->flags = flags;
+
+	return( 1 );
+}
+
+/* Sets the number of Bloom filter bits per entry
+ * More bits per entry reduce the false positive rate of the Bloom filter
+ * used when LIBCDIRECTORY_DIRECTORY_FLAG_BLOOM_FILTER is set, at the cost
+ * of memory. The default is 10 bits per entry, a false positive rate of about 1%
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_set_bloom_filter_bits_per_entry(
+     libcdirectory_directory_t *directory,
+     uint8_t bits_per_entry,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_set_bloom_filter_bits_per_entry";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( ( bits_per_entry == 0 )
+	 || ( bits_per_entry > LIBCDIRECTORY_BLOOM_FILTER_MAXIMUM_BITS_PER_ENTRY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bits per entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+	/* The Bloom filter is rebuilt with the new size on the next lookup
+	 */
+	if( ( internal_directory->bloom_filter != NULL )
+	 && ( bits_per_entry != internal_directory->bloom_filter_bits_per_entry ) )
+	{
+		if( libcdirectory_bloom_filter_free(
+		     &( internal_directory->bloom_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
+
+	internal_directory->bloom_filter_bits_per_entry = bits_per_entry;
+
+	return( 1 );
+}
+
+/* Sets the filter
+ * Only the directory entries that match the filter are returned by
+ * libcdirectory_directory_read_entry, libcdirectory_directory_read_entry_view
+ * and libcdirectory_directory_read_entries
+ * The pattern uses the fnmatch syntax and is matched against the bytes of
+ * the entry name, where a pattern of NULL matches every name
+ * The entry type flags contain the LIBCDIRECTORY_ENTRY_TYPE_FLAG of every
+ * entry type to return. An entry of which the type is unknown is matched
+ * as LIBCDIRECTORY_ENTRY_TYPE_UNDEFINED unless the
+ * LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE flag is set
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_set_filter(
+     libcdirectory_directory_t *directory,
+     const char *pattern,
+     size_t pattern_length,
+     uint8_t entry_type_flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	libcdirectory_pattern_t *filter_pattern                = NULL;
+	static char *function                                  = "libcdirectory_directory_set_filter";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( entry_type_flags == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid entry type flags value zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern != NULL )
+	{
+		if( libcdirectory_pattern_initialize(
+		     &filter_pattern,
+		     pattern,
+		     pattern_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filter pattern.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_directory->filter_pattern != NULL )
+	{
+		if( libcdirectory_pattern_free(
+		     &( internal_directory->filter_pattern ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filter pattern.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_directory->filter_pattern          = filter_pattern;
+	internal_directory->filter_entry_type_flags = entry_type_flags;
+
+	return( 1 );
+
+on_error:
+	if( filter_pattern != NULL )
+	{
+		libcdirectory_pattern_free(
+		 &filter_pattern,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+
+/* Determines if a directory entry, as read from the system, matches the filter
+ * The entry type is only checked if it can be determined from the dirent type
+ * The directory is expected to be validated by the caller
+ * Returns 1 if the directory entry matches or 0 if not
+ */
+int libcdirectory_internal_directory_match_filter(
+     libcdirectory_internal_directory_t *internal_directory,
+     const char *name,
+     size_t name_length,
+     uint8_t dirent_type LIBCDIRECTORY_ATTRIBUTE_UNUSED )
+{
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	uint8_t entry_type = 0;
+#endif
+
+	if( internal_directory->filter_pattern != NULL )
+	{
+		if( libcdirectory_pattern_match(
+		     internal_directory->filter_pattern,
+		     name,
+		     name_length ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	if( internal_directory->filter_entry_type_flags != LIBCDIRECTORY_ENTRY_TYPE_FLAG_ALL )
+	{
+		switch( dirent_type )
+		{
+			case DT_BLK:
+			case DT_CHR:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_DEVICE;
+				break;
+
+			case DT_DIR:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY;
+				break;
+
+			case DT_FIFO:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_PIPE;
+				break;
+
+			case DT_LNK:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_LINK;
+				break;
+
+			case DT_REG:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_FILE;
+				break;
+
+			case DT_SOCK:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_SOCKET;
+				break;
+
+#if defined( DT_WHT )
+			case DT_WHT:
+				entry_type = LIBCDIRECTORY_ENTRY_TYPE_WHITEOUT;
+				break;
+#endif
+			/* The entry type is checked by libcdirectory_internal_directory_match_entry_filter
+			 */
+			default:
+				return( 1 );
+		}
+		if( ( internal_directory->filter_entry_type_flags & ( 1 << entry_type ) ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+#else
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( dirent_type )
+#endif
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_DIRENT_H ) */
+
+/* Determines if a directory entry matches the filter
+ * On POSIX systems this function only checks the entry type when it could not be
+ * determined by libcdirectory_internal_directory_match_filter
+ * The directory and directory entry are expected to be validated by the caller
+ * Returns 1 if the directory entry matches, 0 if not or -1 on error
+ */
+int libcdirectory_internal_directory_match_entry_filter(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_match_entry_filter";
+	uint8_t entry_type    = 0;
+
+#if defined( WINAPI )
+	char *entry_name      = NULL;
+
+	if( internal_directory->filter_pattern != NULL )
+	{
+		if( libcdirectory_directory_entry_get_name(
+		     (libcdirectory_directory_entry_t *) internal_directory_entry,
+		     &entry_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_pattern_match(
+		     internal_directory->filter_pattern,
+		     entry_name,
+		     narrow_string_length(
+		      entry_name ) ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+#endif /* defined( WINAPI ) */
+
+	if( internal_directory->filter_entry_type_flags == LIBCDIRECTORY_ENTRY_TYPE_FLAG_ALL )
+	{
+		return( 1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	if( internal_directory_entry->entry.d_type != DT_UNKNOWN )
+	{
+		return( 1 );
+	}
+#endif
+	if( libcdirectory_directory_entry_get_type(
+	     (libcdirectory_directory_entry_t *) internal_directory_entry,
+	     &entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_directory->filter_entry_type_flags & ( 1 << entry_type ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+
+/* Opens a directory file descriptor and allocates the read buffer
+ * The directory name is relative to the parent descriptor, where AT_FDCWD
+ * represents the current working directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_open_descriptor(
+     libcdirectory_internal_directory_t *internal_directory,
+     int parent_descriptor,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_open_descriptor";
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->read_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - read buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_directory->read_buffer_size < LIBCDIRECTORY_DIRECTORY_MINIMUM_READ_BUFFER_SIZE )
+	 || ( internal_directory->read_buffer_size > (size_t) LIBCDIRECTORY_DIRECTORY_MAXIMUM_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory - read buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->read_buffer = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * internal_directory->read_buffer_size );
+
+	if( internal_directory->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory->descriptor = openat(
+	                                  parent_descriptor,
+	                                  directory_name,
+	                                  O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+
+	if( internal_directory->descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory->read_buffer_offset    = 0;
+	internal_directory->read_buffer_data_size = 0;
+	internal_directory->read_position         = 0;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory->read_buffer != NULL )
+	{
+		memory_free(
+		 internal_directory->read_buffer );
+
+		internal_directory->read_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the next directory entry from the read buffer
+ * The read buffer is refilled using getdents64 when all of its records have been read
+ * If LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW is set the name is not copied but referenced in the read buffer
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_internal_directory_read_buffered_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_linux_dirent64_t *record = NULL;
+	static char *function                  = "libcdirectory_internal_directory_read_buffered_entry";
+	size_t maximum_name_length             = 0;
+	size_t name_length                     = 0;
+	ssize_t read_count                     = 0;
+	int entry_matches                      = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( internal_directory->read_buffer_offset >= internal_directory->read_buffer_data_size )
+		{
+			read_count = (ssize_t) syscall(
+			                        SYS_getdents64,
+			                        internal_directory->descriptor,
+			                        internal_directory->read_buffer,
+			                        internal_directory->read_buffer_size );
+
+			if( read_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from directory.",
+				 function );
+
+				return( -1 );
+			}
+			internal_directory->read_buffer_offset    = 0;
+			internal_directory->read_buffer_data_size = (size_t) read_count;
+
+			if( read_count == 0 )
+			{
+				return( 0 );
+			}
+		}
+		if( ( internal_directory->read_buffer_data_size > internal_directory->read_buffer_size )
+		 || ( internal_directory->read_buffer_offset > ( internal_directory->read_buffer_data_size - sizeof( libcdirectory_linux_dirent64_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory - read buffer offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		record = (libcdirectory_linux_dirent64_t *) &( internal_directory->read_buffer[ internal_directory->read_buffer_offset ] );
+
+		if( ( record->record_size < sizeof( libcdirectory_linux_dirent64_t ) )
+		 || ( record->record_size > ( internal_directory->read_buffer_data_size - internal_directory->read_buffer_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_name_length = (size_t) record->record_size - (size_t) ( (uint8_t *) record->name - (uint8_t *) record );
+
+		for( name_length = 0;
+		     name_length < maximum_name_length;
+		     name_length++ )
+		{
+			if( record->name[ name_length ] == 0 )
+			{
+				break;
+			}
+		}
+		if( name_length >= maximum_name_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Entries that do not match the filter are skipped before the name is copied
+		 */
+		if( ( read_flags & LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER ) != 0 )
+		{
+			entry_matches = 1;
+		}
+		else
+		{
+			entry_matches = libcdirectory_internal_directory_match_filter(
+			                 internal_directory,
+			                 record->name,
+			                 name_length,
+			                 record->type );
+
+			if( entry_matches == 0 )
+			{
+				internal_directory->read_buffer_offset += record->record_size;
+				internal_directory->read_position       = (uint64_t) record->next_offset;
+			}
+		}
+	}
+	while( entry_matches == 0 );
+
+	/* Only the name and the values used by the directory entry are copied
+	 */
+	if( ( read_flags & LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW ) != 0 )
+	{
+		internal_directory_entry->view_name = record->name;
+	}
+	else
+	{
+		if( libcdirectory_internal_directory_entry_copy_name(
+		     internal_directory_entry,
+		     record->name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+		internal_directory_entry->view_name = NULL;
+	}
+	internal_directory_entry->entry.d_ino = (ino_t) record->inode_number;
+
+#if defined( _DIRENT_HAVE_D_OFF )
+	internal_directory_entry->entry.d_off = (off_t) record->next_offset;
+#endif
+#if defined( _DIRENT_HAVE_D_TYPE )
+	internal_directory_entry->entry.d_type = record->type;
+#endif
+	internal_directory->read_buffer_offset += record->record_size;
+	internal_directory->read_position       = (uint64_t) record->next_offset;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 )
+
+/* Reads the next directory entry
+ * The directory and directory entry are expected to be validated by the caller
+ * The find data is read directly into the directory entry, hence
+ * LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW has no effect and the filter is applied
+ * by libcdirectory_internal_directory_read_entry
+ * This function uses the WINAPI function for Windows XP or later
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_internal_directory_read_next_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_read_next_entry";
+	DWORD error_code      = 0;
+
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( read_flags )
+
+	if( internal_directory->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->first_entry != NULL )
+	{
+		if( libcdirectory_directory_entry_copy(
+		     (libcdirectory_directory_entry_t *) internal_directory_entry,
+		     internal_directory->first_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy first directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_directory_entry_free(
+		     (libcdirectory_directory_t **) &( internal_directory->first_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free first entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( internal_directory_entry->narrow_name != NULL )
+		{
+			memory_free(
+			 internal_directory_entry->narrow_name );
+
+			internal_directory_entry->narrow_name = NULL;
+		}
+#else
+		if( internal_directory_entry->wide_name != NULL )
+		{
+			memory_free(
+			 internal_directory_entry->wide_name );
+
+			internal_directory_entry->wide_name = NULL;
+		}
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+		if( FindNextFile(
+		     internal_directory->handle,
+		     &( internal_directory_entry->find_data ) ) == 0 )
+		{
+			error_code = GetLastError();
+
+			if( error_code == ERROR_NO_MORE_FILES )
+			{
+				return( 0 );
+			}
+			else
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 error_code,
+				 "%s: unable to read from directory.",
+				 function );
+			}
+			return( -1 );
+		}
+	}
+	internal_directory->read_position += 1;
+
+	return( 1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI read directory entry for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_READDIR ) || defined( HAVE_READDIR_R )
+
+/* Reads the next directory entry
+ * The directory and directory entry are expected to be validated by the caller
+ * If LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW is set the name is referenced in
+ * the data returned by readdir or the read buffer instead of being copied
+ * Entries that do not match the name or known type of the filter are skipped
+ * unless LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER is set
+ * This function uses the POSIX readdir or readdir_r function
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_internal_directory_read_next_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	struct dirent *result_directory_entry           = NULL;
+	static char *function                           = "libcdirectory_internal_directory_read_next_entry";
+	uint8_t dirent_type                             = 0;
+	int directory_descriptor                        = -1;
+	int entry_matches                               = 0;
+	int result                                      = 0;
+
+#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	struct stat file_statistics;
+
+	char *directory_entry_name                      = NULL;
+	size_t directory_entry_name_length              = 0;
+#endif
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	system_character_t *system_directory_entry_path = NULL;
+	size_t system_directory_entry_path_index        = 0;
+	size_t system_directory_entry_path_size         = 0;
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( ( internal_directory->stream == NULL )
+	 && ( internal_directory->descriptor == -1 ) )
+#else
+	if( internal_directory->stream == NULL )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	if( internal_directory->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing path.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( internal_directory_entry->narrow_name != NULL )
+	{
+		memory_free(
+		 internal_directory_entry->narrow_name );
+
+		internal_directory_entry->narrow_name = NULL;
+	}
+#else
+	if( internal_directory_entry->wide_name != NULL )
+	{
+		memory_free(
+		 internal_directory_entry->wide_name );
+
+		internal_directory_entry->wide_name = NULL;
+	}
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		result = libcdirectory_internal_directory_read_buffered_entry(
+		          internal_directory,
+		          internal_directory_entry,
+		          read_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry from buffer.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	else
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+	{
+		do
+		{
+#if defined( HAVE_READDIR ) && ( !defined( HAVE_READDIR_R ) || defined( HAVE_DEPRECATED_READDIR_R ) )
+
+			errno = 0;
+
+			result_directory_entry = readdir(
+			                          internal_directory->stream );
+
+			if( ( result_directory_entry == NULL )
+			  && ( errno != 0 ) )
+			{
+				result = -1;
+			}
+#else
+			result = readdir_r(
+			          internal_directory->stream,
+			          &( internal_directory_entry->entry ),
+			          &result_directory_entry );
+
+#endif /* defined( HAVE_READDIR ) && ( !defined( HAVE_READDIR_R ) || defined( HAVE_DEPRECATED_READDIR_R ) ) */
+
+			if( result != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from directory.",
+				 function );
+
+				goto on_error;
+			}
+			if( result_directory_entry == NULL )
+			{
+				return( 0 );
+			}
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+			dirent_type = result_directory_entry->d_type;
+#endif
+			entry_matches = 1;
+
+			if( ( read_flags & LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER ) == 0 )
+			{
+				entry_matches = libcdirectory_internal_directory_match_filter(
+				                 internal_directory,
+				                 result_directory_entry->d_name,
+				                 narrow_string_length(
+				                  result_directory_entry->d_name ),
+				                 dirent_type );
+			}
+		}
+		while( entry_matches == 0 );
+
+#if defined( HAVE_READDIR ) && ( !defined( HAVE_READDIR_R ) || defined( HAVE_DEPRECATED_READDIR_R ) )
+		if( ( read_flags & LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW ) != 0 )
+		{
+			internal_directory_entry->entry.d_ino = result_directory_entry->d_ino;
+
+#if defined( _DIRENT_HAVE_D_OFF )
+			internal_directory_entry->entry.d_off = result_directory_entry->d_off;
+#endif
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+			internal_directory_entry->entry.d_type = result_directory_entry->d_type;
+#endif
+			internal_directory_entry->view_name = result_directory_entry->d_name;
+		}
+		else
+		{
+			if( memory_copy(
+			     &( internal_directory_entry->entry ),
+			     result_directory_entry,
+			     sizeof( struct dirent ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			internal_directory_entry->view_name = NULL;
+		}
+#else
+		internal_directory_entry->view_name = NULL;
+#endif
+	}
+	/* The file statistics are read on demand relative to the directory descriptor
+	 */
+	internal_directory_entry->flags                             = internal_directory->flags;
+	internal_directory_entry->file_statistics_flags             = 0;
+	internal_directory_entry->file_statistics_unavailable_flags = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_DIRFD )
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &directory_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	libcdirectory_internal_directory_entry_attach(
+	 internal_directory_entry,
+	 &( internal_directory->first_attached_entry ),
+	 directory_descriptor );
+
+#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	if( internal_directory_entry->view_name != NULL )
+	{
+		directory_entry_name = internal_directory_entry->view_name;
+	}
+	else
+	{
+		directory_entry_name = internal_directory_entry->entry.d_name;
+	}
+	directory_entry_name_length = narrow_string_length(
+	                               directory_entry_name );
+
+	if( ( directory_entry_name_length == 1 )
+	 && ( directory_entry_name[ 0 ] == '.' ) )
+	{
+		file_statistics.st_mode = S_IFDIR;
+	}
+	else if( ( directory_entry_name_length == 2 )
+	      && ( directory_entry_name[ 0 ] == '.' )
+	      && ( directory_entry_name[ 1 ] == '.' ) )
+	{
+		file_statistics.st_mode = S_IFDIR;
+	}
+#if !defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	else if( fstatat(
+	          internal_directory_entry->directory_descriptor,
+	          directory_entry_name,
+	          &file_statistics,
+	          AT_SYMLINK_NOFOLLOW ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve directory entry file statistics.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	else
+	{
+		system_directory_entry_path_size = internal_directory->path_size + directory_entry_name_length + 1;
+
+		system_directory_entry_path = system_string_allocate(
+		                               system_directory_entry_path_size );
+
+		if( system_directory_entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create system character directory entry path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     system_directory_entry_path,
+		     internal_directory->path,
+		     internal_directory->path_size - 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory path to system character directory path.",
+			 function );
+
+			goto on_error;
+		}
+		system_directory_entry_path_index = internal_directory->path_size - 1;
+
+		system_directory_entry_path[ system_directory_entry_path_index++ ] = (system_character_t) '/';
+
+		if( libcdirectory_system_string_copy_from_narrow_string(
+		     &( system_directory_entry_path[ system_directory_entry_path_index ] ),
+		     system_directory_entry_path_size - system_directory_entry_path_index,
+		     directory_entry_name,
+		     directory_entry_name_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy directory path to system character directory path.",
+			 "%s: unable to copy directory entry name to system character directory path.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( _wstat(
+		     system_directory_entry_path,
+		     &file_statistics ) != 0 )
+#else
+		if( stat(
+		     system_directory_entry_path,
+		     &file_statistics ) != 0 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry file statistics.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 system_directory_entry_path );
+
+		system_directory_entry_path = NULL;
+	}
+#endif /* !defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH ) */
+
+	internal_directory_entry->st_mode = file_statistics.st_mode;
+
+#endif /* !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE ) */
+
+	return( 1 );
+
+on_error:
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
+	if( system_directory_entry_path != NULL )
+	{
+		memory_free(
+		 system_directory_entry_path );
+	}
+#endif
+	return( -1 );
+}
+
+#else
+#error Missing read directory entry function
+#endif
+
+/* Reads a directory entry that matches the filter
+ * The directory and directory entry are expected to be validated by the caller
+ * If LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER is set the filter is not applied
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_internal_directory_read_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_read_entry";
+	int entry_matches     = 0;
+	int result            = 0;
+
+	do
+	{
+		result = libcdirectory_internal_directory_read_next_entry(
+		          internal_directory,
+		          internal_directory_entry,
+		          read_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read next directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( read_flags & LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER ) != 0 )
+		{
+			break;
+		}
+		entry_matches = libcdirectory_internal_directory_match_entry_filter(
+		                 internal_directory,
+		                 internal_directory_entry,
+		                 error );
+
+		if( entry_matches == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if directory entry matches filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( entry_matches == 0 );
+
+	return( result );
+}
+
+/* Reads a directory
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_directory_read_entry(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_directory_read_entry";
+	int result            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdirectory_internal_directory_read_entry(
+	          (libcdirectory_internal_directory_t *) directory,
+	          (libcdirectory_internal_directory_entry_t *) directory_entry,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a directory entry as a view
+ * The name of the directory entry is not copied but references data owned by
+ * the directory, which remains valid until the next read or close of the directory
+ * Use libcdirectory_directory_entry_copy to retain the directory entry
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_directory_read_entry_view(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_directory_read_entry_view";
+	int result            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdirectory_internal_directory_read_entry(
+	          (libcdirectory_internal_directory_t *) directory,
+	          (libcdirectory_internal_directory_entry_t *) directory_entry,
+	          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads multiple directory entries
+ * The directory entries are read into the directory_entries array, which must
+ * contain number_of_entries initialized directory entries
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_directory_read_entries(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t **directory_entries,
+     int number_of_entries,
+     int *number_of_read_entries,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_read_entries";
+	int entry_index                                        = 0;
+	int result                                             = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( directory_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( directory_entries[ entry_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid directory entries - missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          internal_directory,
+		          (libcdirectory_internal_directory_entry_t *) directory_entries[ entry_index ],
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	*number_of_read_entries = entry_index;
+
+	if( entry_index == 0 )
+	{
+		return( 0 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_DIRFD )
+	if( ( internal_directory->flags & LIBCDIRECTORY_DIRECTORY_FLAG_INODE_ORDER_FILE_STATISTICS ) != 0 )
+	{
+		if( libcdirectory_internal_directory_read_entries_file_statistics(
+		     internal_directory,
+		     directory_entries,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file statistics of directory entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_DIRFD )
+
+/* Compares two inode orders by inode number
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
+ */
+int libcdirectory_inode_order_compare(
+     const void *first_inode_order,
+     const void *second_inode_order )
+{
+	uint64_t first_inode_number  = ( (libcdirectory_inode_order_t *) first_inode_order )->inode_number;
+	uint64_t second_inode_number = ( (libcdirectory_inode_order_t *) second_inode_order )->inode_number;
+
+	if( first_inode_number < second_inode_number )
+	{
+		return( -1 );
+	}
+	else if( first_inode_number > second_inode_number )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the file statistics of directory entries in order of their inode number
+ * On file systems that store the inodes in inode number order, such as ext4
+ * and XFS, this reduces seeking compared to the order the entries were read in
+ * A directory entry of which the file statistics cannot be read, for example
+ * because it was removed after it was read, is skipped and its file statistics
+ * are read on demand instead
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_read_entries_file_statistics(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_directory_entry_t **directory_entries,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libcdirectory_inode_order_t *inode_orders = NULL;
+	static char *function                     = "libcdirectory_internal_directory_read_entries_file_statistics";
+	int entry_index                           = 0;
+	int order_index                           = 0;
+	int result                                = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcdirectory_inode_order_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	inode_orders = (libcdirectory_inode_order_t *) memory_allocate(
+	                                                sizeof( libcdirectory_inode_order_t ) * (size_t) number_of_entries );
+
+	if( inode_orders == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode orders.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		inode_orders[ entry_index ].inode_number = 0;
+		inode_orders[ entry_index ].entry_index  = entry_index;
+
+		if( libcdirectory_internal_directory_entry_get_entry_inode_number(
+		     (libcdirectory_internal_directory_entry_t *) directory_entries[ entry_index ],
+		     &( inode_orders[ entry_index ].inode_number ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number of directory entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	qsort(
+	 inode_orders,
+	 (size_t) number_of_entries,
+	 sizeof( libcdirectory_inode_order_t ),
+	 &libcdirectory_inode_order_compare );
+
+	for( order_index = 0;
+	     order_index < number_of_entries;
+	     order_index++ )
+	{
+		entry_index = inode_orders[ order_index ].entry_index;
+
+		result = libcdirectory_internal_directory_entry_read_file_statistics(
+		          (libcdirectory_internal_directory_entry_t *) directory_entries[ entry_index ],
+		          LIBCDIRECTORY_DIRECTORY_INODE_ORDER_FILE_STATISTICS_FLAGS,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_free(
+			 error );
+		}
+	}
+	memory_free(
+	 inode_orders );
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 inode_orders );
+
+	return( -1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRFD ) */
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 )
+
+/* Rewinds a directory
+ * WINAPI does not provide a rewind of a find handle hence the search is restarted
+ * using the search path of the directory
+ * This function uses the WINAPI function for Windows XP or later
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_rewind(
+     libcdirectory_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory                   = NULL;
+	libcdirectory_internal_directory_entry_t *internal_first_directory_entry = NULL;
+	static char *function                                                    = "libcdirectory_directory_rewind";
+	DWORD error_code                                                         = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( internal_directory->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->read_position == 0 )
+	{
+		return( 1 );
+	}
+	if( FindClose(
+	     internal_directory->handle ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 error_code,
+		 "%s: unable to close directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->handle        = INVALID_HANDLE_VALUE;
+	internal_directory->read_position = 0;
+
+	if( internal_directory->first_entry == NULL )
+	{
+		if( libcdirectory_directory_entry_initialize(
+		     &( internal_directory->first_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create first entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_first_directory_entry = (libcdirectory_internal_directory_entry_t *) internal_directory->first_entry;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	internal_directory->handle = FindFirstFileW(
+	                              (LPCWSTR) internal_directory->path,
+	                              &( internal_first_directory_entry->find_data ) );
+#else
+	internal_directory->handle = FindFirstFileA(
+	                              (LPCSTR) internal_directory->path,
+	                              &( internal_first_directory_entry->find_data ) );
+#endif
+	if( internal_directory->handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to reopen directory.",
+		 function );
+
+		libcdirectory_directory_entry_free(
+		 &( internal_directory->first_entry ),
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the position
+ * The position is an opaque value that can be passed to libcdirectory_directory_set_position
+ * This function uses the WINAPI function for Windows XP or later, where the position
+ * is the number of entries read
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_get_position(
+     libcdirectory_directory_t *directory,
+     uint64_t *position,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_get_position";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( internal_directory->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( position == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid position.",
+		 function );
+
+		return( -1 );
+	}
+	*position = internal_directory->read_position;
+
+	return( 1 );
+}
+
+/* Sets the position
+ * The position is a value previously retrieved by libcdirectory_directory_get_position
+ * This function uses the WINAPI function for Windows XP or later, which cannot seek
+ * hence the search is restarted and the entries before the position are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_set_position(
+     libcdirectory_directory_t *directory,
+     uint64_t position,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *directory_entry       = NULL;
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_set_position";
+	int result                                             = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( position < internal_directory->read_position )
+	{
+		if( libcdirectory_directory_rewind(
+		     directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to rewind directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	while( internal_directory->read_position < position )
+	{
+		result = libcdirectory_internal_directory_read_next_entry(
+		          internal_directory,
+		          (libcdirectory_internal_directory_entry_t *) directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid position value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI directory position functions for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_DIRENT_H )
+
+/* Rewinds a directory
+ * This function uses the POSIX rewinddir function or lseek when the entries
+ * are read using getdents64
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_rewind(
+     libcdirectory_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_rewind";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		if( lseek(
+		     internal_directory->descriptor,
+		     0,
+		     SEEK_SET ) == (off_t) -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to rewind directory.",
+			 function );
+
+			return( -1 );
+		}
+		internal_directory->read_buffer_offset    = 0;
+		internal_directory->read_buffer_data_size = 0;
+		internal_directory->read_position         = 0;
+
+		return( 1 );
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
+	if( internal_directory->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	rewinddir(
+	 internal_directory->stream );
+
+	return( 1 );
+}
+
+/* Retrieves the position
+ * The position is an opaque value that can be passed to libcdirectory_directory_set_position
+ * On Linux the position is the d_off cookie of the file system of the last entry read
+ * This function uses the POSIX telldir function or the d_off of the last record
+ * when the entries are read using getdents64
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_get_position(
+     libcdirectory_directory_t *directory,
+     uint64_t *position,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_get_position";
+
+#if defined( HAVE_TELLDIR )
+	long stream_position                                   = 0;
+#endif
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( position == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid position.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		*position = internal_directory->read_position;
+
+		return( 1 );
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
+	if( internal_directory->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_TELLDIR )
+	stream_position = telldir(
+	                   internal_directory->stream );
+
+	if( stream_position == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to retrieve stream position.",
+		 function );
+
+		return( -1 );
+	}
+	*position = (uint64_t) stream_position;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: retrieving the stream position is not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_TELLDIR ) */
+}
+
+/* Sets the position
+ * The position is a value previously retrieved by libcdirectory_directory_get_position
+ * of the same directory, use libcdirectory_directory_rewind to return to the start
+ * Directory entry views that reference data of the directory are invalidated
+ * This function uses the POSIX seekdir function or lseek when the entries
+ * are read using getdents64
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_set_position(
+     libcdirectory_directory_t *directory,
+     uint64_t position,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_directory_set_position";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	if( internal_directory->descriptor != -1 )
+	{
+		if( position > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid position value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( lseek(
+		     internal_directory->descriptor,
+		     (off_t) position,
+		     SEEK_SET ) == (off_t) -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek position: %" PRIu64 ".",
+			 function,
+			 position );
+
+			return( -1 );
+		}
+		internal_directory->read_buffer_offset    = 0;
+		internal_directory->read_buffer_data_size = 0;
+		internal_directory->read_position         = position;
+
+		return( 1 );
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
+	if( internal_directory->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SEEKDIR )
+	seekdir(
+	 internal_directory->stream,
+	 (long) position );
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: setting the stream position is not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_SEEKDIR ) */
+}
+
+#else
+#error Missing directory position functions
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_CHECKPOINT )
+
+/* Retrieves the identity of an open directory
+ * The identity consists of the device and inode number and the modification time,
+ * which is stored in POSIX time in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_get_identity(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_checkpoint_t *checkpoint,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libcdirectory_internal_directory_get_identity";
+	int descriptor        = -1;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve directory file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint->device_number = (uint64_t) file_statistics.st_dev;
+	checkpoint->inode_number  = (uint64_t) file_statistics.st_ino;
+
+#if defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	checkpoint->modification_time = ( (int64_t) file_statistics.st_mtim.tv_sec * 1000000000 )
+	                              + file_statistics.st_mtim.tv_nsec;
+#else
+	checkpoint->modification_time = (int64_t) file_statistics.st_mtime * 1000000000;
+#endif
+	return( 1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_CHECKPOINT ) */
+
+/* Retrieves a checkpoint
+ * The checkpoint data contains the identity of the directory, its modification
+ * time and the position, and can be stored to resume the enumeration after
+ * the directory was reopened, possibly by another process, using
+ * libcdirectory_directory_restore_checkpoint
+ * The checkpoint data size must be at least LIBCDIRECTORY_CHECKPOINT_DATA_SIZE
+ * Checkpoints are supported where the position remains valid when the directory
+ * is reopened, such as the d_off cookie of the file system on Linux
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_get_checkpoint(
+     libcdirectory_directory_t *directory,
+     uint8_t *checkpoint_data,
+     size_t checkpoint_data_size,
+     libcerror_error_t **error )
+{
+#if defined( LIBCDIRECTORY_HAVE_CHECKPOINT )
+	libcdirectory_checkpoint_t checkpoint;
+#endif
+
+	static char *function = "libcdirectory_directory_get_checkpoint";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_data_size < LIBCDIRECTORY_CHECKPOINT_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid checkpoint data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_CHECKPOINT )
+	if( libcdirectory_internal_directory_get_identity(
+	     (libcdirectory_internal_directory_t *) directory,
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_get_position(
+	     directory,
+	     &( checkpoint.position ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve position.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_checkpoint_write_data(
+	     &checkpoint,
+	     checkpoint_data,
+	     checkpoint_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: checkpoints are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBCDIRECTORY_HAVE_CHECKPOINT ) */
+}
+
+/* Restores a checkpoint
+ * The directory must be open and is positioned after the last entry read
+ * before the checkpoint was retrieved. The checkpoint is not restored if it
+ * was retrieved from another directory, or if
+ * LIBCDIRECTORY_CHECKPOINT_FLAG_REQUIRE_UNCHANGED is set and the directory
+ * was modified since, in which case the position is unchanged
+ * Returns 1 if successful, 0 if the checkpoint does not apply to the directory or -1 on error
+ */
+int libcdirectory_directory_restore_checkpoint(
+     libcdirectory_directory_t *directory,
+     const uint8_t *checkpoint_data,
+     size_t checkpoint_data_size,
+     uint8_t checkpoint_flags,
+     libcerror_error_t **error )
+{
+#if defined( LIBCDIRECTORY_HAVE_CHECKPOINT )
+	libcdirectory_checkpoint_t checkpoint;
+	libcdirectory_checkpoint_t directory_identity;
+#endif
+
+	static char *function = "libcdirectory_directory_restore_checkpoint";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint_flags & ~( LIBCDIRECTORY_CHECKPOINT_FLAG_REQUIRE_UNCHANGED ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint flags: 0x%02" PRIx8 ".",
+		 function,
+		 checkpoint_flags );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_CHECKPOINT )
+	if( libcdirectory_checkpoint_read_data(
+	     &checkpoint,
+	     checkpoint_data,
+	     checkpoint_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_identity(
+	     (libcdirectory_internal_directory_t *) directory,
+	     &directory_identity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint.device_number != directory_identity.device_number )
+	 || ( checkpoint.inode_number != directory_identity.inode_number ) )
+	{
+		return( 0 );
+	}
+	if( ( ( checkpoint_flags & LIBCDIRECTORY_CHECKPOINT_FLAG_REQUIRE_UNCHANGED ) != 0 )
+	 && ( checkpoint.modification_time != directory_identity.modification_time ) )
+	{
+		return( 0 );
+	}
+	if( libcdirectory_directory_set_position(
+	     directory,
+	     checkpoint.position,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set position.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( checkpoint_data )
+	LIBCDIRECTORY_UNREFERENCED_PARAMETER( checkpoint_data_size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: checkpoints are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBCDIRECTORY_HAVE_CHECKPOINT ) */
+}
+
+/* Determines if a directory has a specific entry
+ * A case sensitive search for a defined entry type looks up the entry directly
+ * where supported, otherwise the entry is looked up in the name index when
+ * LIBCDIRECTORY_DIRECTORY_FLAG_INDEX_NAMES is set or the remaining entries
+ * of the directory are read. When LIBCDIRECTORY_DIRECTORY_FLAG_BLOOM_FILTER is
+ * set the Bloom filter is checked before the name index or directory is read
+ * An entry that is looked up directly has the name that was searched for
+ * Returns 1 if the directory has the corresponding entry, 0 if not or -1 on error
+ */
+int libcdirectory_directory_has_entry(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *entry_name,
+     size_t entry_name_length,
+     uint8_t entry_type,
+     uint8_t compare_flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *search_directory_entry = NULL;
+	char *search_directory_entry_name                       = NULL;
+	static char *function                                   = "libcdirectory_directory_has_entry";
+	size_t search_directory_entry_name_length               = 0;
+	uint8_t search_directory_entry_type                     = 0;
+	int entry_found                                         = 0;
+	int entry_looked_up                                     = 0;
+	int match                                               = 0;
+	int result                                              = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entry name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_DEVICE )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_LINK )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_PIPE )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_SOCKET )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_UNDEFINED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_flags & ~( LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &search_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create search directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	entry_found = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE )
+	/* A case sensitive search for a specific type does not require to read the directory
+	 */
+	if( ( ( compare_flags & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) == 0 )
+	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_UNDEFINED ) )
+	{
+		entry_looked_up = libcdirectory_internal_directory_probe_entry(
+		                   (libcdirectory_internal_directory_t *) directory,
+		                   (libcdirectory_internal_directory_entry_t *) search_directory_entry,
+		                   entry_name,
+		                   entry_name_length,
+		                   &entry_found,
+		                   error );
+
+		if( entry_looked_up == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to look up directory entry.",
 			 function );
 
 			goto on_error;
 		}
-		system_directory_entry_path_index = internal_directory->path_size - 1;
+		else if( entry_found != 0 )
+		{
+			if( libcdirectory_directory_entry_get_type(
+			     search_directory_entry,
+			     &search_directory_entry_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry type.",
+				 function );
 
-		system_directory_entry_path[ system_directory_entry_path_index++ ] = (system_character_t) '/';
+				goto on_error;
+			}
+			if( search_directory_entry_type != entry_type )
+			{
+				entry_found = 0;
+			}
+			else if( libcdirectory_directory_entry_copy(
+			          directory_entry,
+			          search_directory_entry,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy search directory entry.",
+				 function );
 
-		if( libcdirectory_system_string_copy_from_narrow_string(
-		     &( system_directory_entry_path[ system_directory_entry_path_index ] ),
-		     system_directory_entry_path_size - system_directory_entry_path_index,
-		     (char *) internal_directory_entry->entry.d_name,
-		     directory_entry_name_length + 1,
-		     error ) != 1 )
+				goto on_error;
+			}
+		}
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) */
+#if defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+	/* The Bloom filter is keyed on the case folded name hence it can rule out
+	 * entries for both case sensitive and case insensitive searches
+	 */
+	if( ( entry_looked_up == 0 )
+	 && ( ( ( (libcdirectory_internal_directory_t *) directory )->flags & LIBCDIRECTORY_DIRECTORY_FLAG_BLOOM_FILTER ) != 0 ) )
+	{
+		result = libcdirectory_internal_directory_bloom_filter_contains_name(
+		          (libcdirectory_internal_directory_t *) directory,
+		          entry_name,
+		          entry_name_length,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy directory entry name to system character directory path.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to look up entry name in Bloom filter.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( _wstat(
-		     system_directory_entry_path,
-		     &file_statistics ) != 0 )
-#else
-		if( stat(
-		     system_directory_entry_path,
-		     &file_statistics ) != 0 )
-#endif
+		else if( result == 0 )
+		{
+			entry_looked_up = 1;
+		}
+	}
+	if( ( entry_looked_up == 0 )
+	 && ( ( ( (libcdirectory_internal_directory_t *) directory )->flags & LIBCDIRECTORY_DIRECTORY_FLAG_INDEX_NAMES ) != 0 ) )
+	{
+		result = libcdirectory_internal_directory_get_indexed_entry(
+		          (libcdirectory_internal_directory_t *) directory,
+		          (libcdirectory_internal_directory_entry_t *) search_directory_entry,
+		          entry_name,
+		          entry_name_length,
+		          entry_type,
+		          compare_flags,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry file statistics.",
+			 "%s: unable to look up directory entry in name index.",
 			 function );
 
 			goto on_error;
 		}
-		memory_free(
-		 system_directory_entry_path );
+		else if( result != 0 )
+		{
+			if( libcdirectory_directory_entry_copy(
+			     directory_entry,
+			     search_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy search directory entry.",
+				 function );
 
-		system_directory_entry_path = NULL;
+				goto on_error;
+			}
+			entry_found = 1;
+		}
 	}
-	internal_directory_entry->st_mode = file_statistics.st_mode;
+	else
+#endif /* defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
+	if( entry_looked_up == 0 )
+	{
+		do
+		{
+			result = libcdirectory_internal_directory_read_entry(
+			          (libcdirectory_internal_directory_t *) directory,
+			          (libcdirectory_internal_directory_entry_t *) search_directory_entry,
+			          LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER,
+			          error );
 
-#endif /* !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE ) */
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory entry.",
+				 function );
 
-	return( 1 );
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libcdirectory_directory_entry_get_type(
+			     search_directory_entry,
+			     &search_directory_entry_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry type.",
+				 function );
+
+				goto on_error;
+			}
+			if( search_directory_entry_type == entry_type )
+			{
+				if( libcdirectory_directory_entry_get_name(
+				     search_directory_entry,
+				     &search_directory_entry_name,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve directory entry name.",
+					 function );
+
+					goto on_error;
+				}
+				search_directory_entry_name_length = narrow_string_length(
+				                                      search_directory_entry_name );
+
+				if( search_directory_entry_name_length == entry_name_length )
+				{
+					/* If there is an exact match we're done searching
+					 */
+					match = narrow_string_compare(
+						 search_directory_entry_name,
+						 entry_name,
+						 entry_name_length );
+
+					if( match == 0 )
+					{
+						if( libcdirectory_directory_entry_copy(
+						     directory_entry,
+						     search_directory_entry,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to copy search directory entry.",
+							 function );
+
+							goto on_error;
+						}
+						entry_found = 1;
+
+						break;
+					}
+					/* Ignore successive caseless matches
+					 */
+					if( ( ( compare_flags & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) != 0 )
+					 && ( entry_found == 0 ) )
+					{
+						match = libcdirectory_string_compare_narrow_no_case(
+							 search_directory_entry_name,
+							 entry_name,
+							 entry_name_length );
+
+						if( match == 0 )
+						{
+							if( libcdirectory_directory_entry_copy(
+							     directory_entry,
+							     search_directory_entry,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_MEMORY,
+								 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+								 "%s: unable to copy search directory entry.",
+								 function );
+
+								goto on_error;
+							}
+							entry_found = 1;
+						}
+					}
+				}
+			}
+		}
+		while( result != 0 );
+	}
+
+	if( libcdirectory_directory_entry_free(
+	     &search_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free search directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( entry_found );
 
 on_error:
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
-	if( system_directory_entry_path != NULL )
+	if( search_directory_entry != NULL )
 	{
-		memory_free(
-		 system_directory_entry_path );
+		libcdirectory_directory_entry_free(
+		 &search_directory_entry,
+		 NULL );
 	}
-#endif
 	return( -1 );
 }
 
-#else
-#error Missing read directory entry function
+/* Copies a directory entry that was found by libcdirectory_directory_has_entries
+ * into the corresponding element of directory_entries, if set
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_copy_found_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_directory_entry_t **directory_entries,
+     int entry_index,
+     libcdirectory_directory_entry_t *search_directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_copy_found_entry";
+
+#if defined( LIBCDIRECTORY_HAVE_OPENAT )
+	int descriptor        = -1;
 #endif
 
-/* Determines if a directory has a specific entry
- * Returns 1 if the directory has the corresponding entry, 0 if not or -1 on error
- */
-int libcdirectory_directory_has_entry(
-     libcdirectory_directory_t *directory,
-     libcdirectory_directory_entry_t *directory_entry,
-     const char *entry_name,
-     size_t entry_name_length,
-     uint8_t entry_type,
-     uint8_t compare_flags,
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries == NULL )
+	{
+		return( 1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries[ entry_index ] == NULL )
+	{
+		return( 1 );
+	}
+	if( libcdirectory_directory_entry_copy(
+	     directory_entries[ entry_index ],
+	     search_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy search directory entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_OPENAT )
+	/* The search directory entry was read from a separate directory
+	 * that is closed after the look up
+	 */
+	if( libcdirectory_internal_directory_get_descriptor(
+	     internal_directory,
+	     &descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	( (libcdirectory_internal_directory_entry_t *) directory_entries[ entry_index ] )->flags = internal_directory->flags;
+
+	libcdirectory_internal_directory_entry_attach(
+	 (libcdirectory_internal_directory_entry_t *) directory_entries[ entry_index ],
+	 &( internal_directory->first_attached_entry ),
+	 descriptor );
+#endif
+	return( 1 );
+}
+
+/* Determines if a directory has specific entries
+ * The entries are looked up in a single pass over the directory, using a name index
+ * of the entry names that are looked up, where an exact match is preferred over
+ * a caseless match. Caseless matches are determined using simple case folding
+ * entries_found is set to 1 for every entry that was found and to 0 otherwise
+ * If directory_entries is set the directory entry of every entry that was found
+ * is copied into the corresponding directory entry, which can be NULL to skip the copy
+ * If compare_flags is NULL the entry names are compared case sensitive
+ * Where supported the directory is read using a separate directory that is opened
+ * relative to the directory, so that the read position of the directory is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_directory_has_entries(
+     libcdirectory_directory_t *directory,
+     const char **entry_names,
+     const size_t *entry_name_lengths,
+     const uint8_t *entry_types,
+     const uint8_t *compare_flags,
+     int number_of_entries,
+     libcdirectory_directory_entry_t **directory_entries,
+     uint8_t *entries_found,
      libcerror_error_t **error )
 {
-	libcdirectory_directory_entry_t *search_directory_entry = NULL;
-	char *search_directory_entry_name                       = NULL;
-	static char *function                                   = "libcdirectory_directory_has_entry";
-	size_t search_directory_entry_name_length               = 0;
-	uint8_t search_directory_entry_type                     = 0;
-	int entry_found                                         = 0;
-	int match                                               = 0;
-	int result                                              = 0;
+	libcdirectory_directory_entry_t *search_directory_entry                   = NULL;
+	libcdirectory_internal_directory_entry_t *internal_search_directory_entry = NULL;
+	libcdirectory_internal_directory_t *internal_directory                    = NULL;
+	libcdirectory_internal_directory_t *internal_search_directory             = NULL;
+	libcdirectory_name_index_t *entry_names_index                             = NULL;
+	char *search_directory_entry_name                                         = NULL;
+	static char *function                                                     = "libcdirectory_directory_has_entries";
+	size_t search_directory_entry_name_length                                 = 0;
+	uint8_t search_directory_entry_type                                       = 0;
+	int entry_index                                                           = 0;
+	int number_of_caseless_entries                                            = 0;
+	int number_of_exact_matches                                               = 0;
+	int result                                                                = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_OPENAT )
+	libcdirectory_directory_t *search_directory                               = NULL;
+#endif
 
 	if( directory == NULL )
 	{
@@ -1491,67 +6681,225 @@ int libcdirectory_directory_has_entry(
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+	internal_directory = (libcdirectory_internal_directory_t *) directory;
+
+	if( entry_names == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 "%s: invalid entry names.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	if( entry_name_lengths == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 "%s: invalid entry name lengths.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name_length > (size_t) SSIZE_MAX )
+	if( entry_types == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid entry name length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry types.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_DEVICE )
-	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
-	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
-	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_LINK )
-	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_PIPE )
-	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_SOCKET )
-	 && ( entry_type != LIBCDIRECTORY_ENTRY_TYPE_UNDEFINED ) )
+	if( number_of_entries < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported entry type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( compare_flags & ~( LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) ) != 0 )
+	if( entries_found == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compare flags.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries found.",
 		 function );
 
 		return( -1 );
 	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_names[ entry_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid entry name: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( entry_name_lengths[ entry_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entry name length: %d value exceeds maximum.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_DEVICE )
+		 && ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		 && ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_FILE )
+		 && ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_LINK )
+		 && ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_PIPE )
+		 && ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_SOCKET )
+		 && ( entry_types[ entry_index ] != LIBCDIRECTORY_ENTRY_TYPE_UNDEFINED ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported entry type: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( compare_flags != NULL )
+		{
+			if( ( compare_flags[ entry_index ] & ~( LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported compare flags: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( ( compare_flags[ entry_index ] & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) != 0 )
+			{
+				number_of_caseless_entries++;
+			}
+		}
+		entries_found[ entry_index ] = 0;
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	/* The entry names are stored in a name index, of which the entry index
+	 * corresponds to the index of the entry name
+	 */
+	if( libcdirectory_name_index_initialize(
+	     &entry_names_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entry names index.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdirectory_name_index_append_entry(
+		     entry_names_index,
+		     entry_names[ entry_index ],
+		     entry_name_lengths[ entry_index ],
+		     entry_types[ entry_index ],
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name: %d to index.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libcdirectory_name_index_build(
+	     entry_names_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build entry names index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCDIRECTORY_HAVE_OPENAT )
+	if( libcdirectory_directory_initialize(
+	     &search_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create search directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_search_directory = (libcdirectory_internal_directory_t *) search_directory;
+
+	internal_search_directory->read_buffer_size = internal_directory->read_buffer_size;
+	internal_search_directory->flags            = internal_directory->flags & LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE;
+
+	if( libcdirectory_internal_directory_open_at(
+	     internal_search_directory,
+	     internal_directory,
+	     _SYSTEM_STRING( "." ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open search directory.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	internal_search_directory = internal_directory;
+#endif
 	if( libcdirectory_directory_entry_initialize(
 	     &search_directory_entry,
 	     error ) != 1 )
@@ -1565,14 +6913,18 @@ int libcdirectory_directory_has_entry(
 
 		goto on_error;
 	}
-	entry_found = 0;
+	internal_search_directory_entry = (libcdirectory_internal_directory_entry_t *) search_directory_entry;
 
-	do
+	/* entries_found is set to 2 for an exact match and to 1 for a caseless match
+	 * while the directory is read
+	 */
+	while( number_of_exact_matches < number_of_entries )
 	{
-		result = libcdirectory_directory_read_entry(
-			  directory,
-			  search_directory_entry,
-			  error );
+		result = libcdirectory_internal_directory_read_entry(
+		          internal_search_directory,
+		          internal_search_directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW | LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER,
+		          error );
 
 		if( result == -1 )
 		{
@@ -1603,88 +6955,137 @@ int libcdirectory_directory_has_entry(
 
 			goto on_error;
 		}
-		if( search_directory_entry_type == entry_type )
+		if( libcdirectory_directory_entry_get_name(
+		     search_directory_entry,
+		     &search_directory_entry_name,
+		     error ) != 1 )
 		{
-			if( libcdirectory_directory_entry_get_name(
-			     search_directory_entry,
-			     &search_directory_entry_name,
-			     error ) != 1 )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		search_directory_entry_name_length = narrow_string_length(
+		                                      search_directory_entry_name );
+
+		entry_index = -1;
+
+		do
+		{
+			result = libcdirectory_name_index_get_next_entry_index_by_name(
+			          entry_names_index,
+			          search_directory_entry_name,
+			          search_directory_entry_name_length,
+			          &entry_index,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve directory entry name.",
+				 "%s: unable to look up entry name in index.",
 				 function );
 
 				goto on_error;
 			}
-			search_directory_entry_name_length = narrow_string_length(
-			                                      search_directory_entry_name );
-
-			if( search_directory_entry_name_length == entry_name_length )
+			else if( ( result != 0 )
+			      && ( entries_found[ entry_index ] != 2 )
+			      && ( entry_types[ entry_index ] == search_directory_entry_type ) )
 			{
-				/* If there is an exact match we're done searching
-				 */
-				match = narrow_string_compare(
-					 search_directory_entry_name,
-					 entry_name,
-					 entry_name_length );
-
-				if( match == 0 )
+				if( libcdirectory_internal_directory_copy_found_entry(
+				     internal_directory,
+				     directory_entries,
+				     entry_index,
+				     search_directory_entry,
+				     error ) != 1 )
 				{
-					if( libcdirectory_directory_entry_copy(
-					     directory_entry,
-					     search_directory_entry,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-						 "%s: unable to copy search directory entry.",
-						 function );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy directory entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				entries_found[ entry_index ] = 2;
 
-						goto on_error;
-					}
-					entry_found = 1;
+				number_of_exact_matches++;
+			}
+		}
+		while( result != 0 );
 
-					break;
-				}
-				/* Ignore successive caseless matches
-				 */
-				if( ( ( compare_flags & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) != 0 )
-				 && ( entry_found == 0 ) )
-				{
-					match = narrow_string_compare_no_case(
-						 search_directory_entry_name,
-						 entry_name,
-						 entry_name_length );
+		if( number_of_caseless_entries == 0 )
+		{
+			continue;
+		}
+		entry_index = -1;
 
-					if( match == 0 )
-					{
-						if( libcdirectory_directory_entry_copy(
-						     directory_entry,
-						     search_directory_entry,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_MEMORY,
-							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-							 "%s: unable to copy search directory entry.",
-							 function );
+		do
+		{
+			result = libcdirectory_name_index_get_next_entry_index_by_case_folded_name(
+			          entry_names_index,
+			          search_directory_entry_name,
+			          search_directory_entry_name_length,
+			          &entry_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to look up case folded entry name in index.",
+				 function );
 
-							goto on_error;
-						}
-						entry_found = 1;
-					}
+				goto on_error;
+			}
+			/* Ignore successive caseless matches
+			 */
+			else if( ( result != 0 )
+			      && ( entries_found[ entry_index ] == 0 )
+			      && ( ( compare_flags[ entry_index ] & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) != 0 )
+			      && ( entry_types[ entry_index ] == search_directory_entry_type ) )
+			{
+				if( libcdirectory_internal_directory_copy_found_entry(
+				     internal_directory,
+				     directory_entries,
+				     entry_index,
+				     search_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy directory entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
 				}
+				entries_found[ entry_index ] = 1;
 			}
 		}
+		while( result != 0 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entries_found[ entry_index ] != 0 )
+		{
+			entries_found[ entry_index ] = 1;
+		}
 	}
-	while( result != 0 );
-
 	if( libcdirectory_directory_entry_free(
 	     &search_directory_entry,
 	     error ) != 1 )
@@ -1698,7 +7099,35 @@ int libcdirectory_directory_has_entry(
 
 		goto on_error;
 	}
-	return( entry_found );
+#if defined( LIBCDIRECTORY_HAVE_OPENAT )
+	if( libcdirectory_directory_free(
+	     &search_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free search directory.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdirectory_name_index_free(
+	     &entry_names_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entry names index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
 
 on_error:
 	if( search_directory_entry != NULL )
@@ -1707,6 +7136,20 @@ on_error:
 		 &search_directory_entry,
 		 NULL );
 	}
+#if defined( LIBCDIRECTORY_HAVE_OPENAT )
+	if( search_directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &search_directory,
+		 NULL );
+	}
+#endif
+	if( entry_names_index != NULL )
+	{
+		libcdirectory_name_index_free(
+		 &entry_names_index,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -1822,10 +7265,11 @@ int libcdirectory_directory_has_entry_wide(
 
 	do
 	{
-		result = libcdirectory_directory_read_entry(
-			  directory,
-			  search_directory_entry,
-			  error );
+		result = libcdirectory_internal_directory_read_entry(
+		          (libcdirectory_internal_directory_t *) directory,
+		          (libcdirectory_internal_directory_entry_t *) search_directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER,
+		          error );
 
 		if( result == -1 )
 		{
@@ -1909,7 +7353,7 @@ int libcdirectory_directory_has_entry_wide(
 				if( ( ( compare_flags & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) != 0 )
 				 && ( entry_found == 0 ) )
 				{
-					match = wide_string_compare_no_case(
+					match = libcdirectory_string_compare_wide_no_case(
 						 search_directory_entry_name,
 						 entry_name,
 						 entry_name_length );
@@ -29,32 +29,240 @@
 #include <dirent.h>
 #endif
 
+#if defined( __linux__ ) && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_UNISTD_H )
+#include <sys/syscall.h>
+#endif
+
+#include "libcdirectory_bloom_filter.h"
+#include "libcdirectory_checkpoint.h"
 #include "libcdirectory_directory_entry.h"
 #include "libcdirectory_extern.h"
 #include "libcdirectory_libcerror.h"
+#include "libcdirectory_name_index.h"
+#include "libcdirectory_pattern.h"
 #include "libcdirectory_types.h"
 
+#if defined( __linux__ ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( SYS_getdents64 )
+#define LIBCDIRECTORY_HAVE_GETDENTS64
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H ) && ( defined( HAVE_DIRFD ) || defined( dirfd ) )
+#define LIBCDIRECTORY_HAVE_DIRFD
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_DIRFD ) && defined( HAVE_FCNTL_H ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT )
+#define LIBCDIRECTORY_HAVE_OPENAT
+#endif
+
+/* Entries can be looked up directly with fstatat when the file system is case sensitive
+ */
+#if defined( LIBCDIRECTORY_HAVE_DIRFD ) && defined( HAVE_FSTATAT ) && !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( __APPLE__ )
+#define LIBCDIRECTORY_HAVE_ENTRY_PROBE
+#endif
+
+/* The entry names can be indexed when the directory can be reopened relative to itself
+ */
+#if defined( LIBCDIRECTORY_HAVE_OPENAT ) && defined( HAVE_SYS_STAT_H )
+#define LIBCDIRECTORY_HAVE_NAME_INDEX
+#endif
+
+/* Checkpoints require a position that remains valid when the directory is reopened,
+ * which the d_off cookie of the file system provides on Linux
+ */
+#if defined( __linux__ ) && defined( LIBCDIRECTORY_HAVE_DIRFD ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR )
+#define LIBCDIRECTORY_HAVE_CHECKPOINT
+#endif
+
+/* The device and inode number of an open directory are retrieved with fstat on its descriptor
+ */
+#if defined( LIBCDIRECTORY_HAVE_DIRFD ) && defined( HAVE_SYS_STAT_H )
+#define LIBCDIRECTORY_HAVE_FILE_IDENTIFIER
+#endif
+
+/* Without d_type the entry type is determined with fstatat relative to the directory
+ * descriptor, the directory path is only retained when fstatat is not available
+ */
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H ) && !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE ) && ( !defined( LIBCDIRECTORY_HAVE_DIRFD ) || !defined( HAVE_FSTATAT ) )
+#define LIBCDIRECTORY_HAVE_DIRECTORY_PATH
+#endif
+
+/* The minimum and maximum read buffer size
+ */
+#define LIBCDIRECTORY_DIRECTORY_MINIMUM_READ_BUFFER_SIZE	4096
+#define LIBCDIRECTORY_DIRECTORY_MAXIMUM_READ_BUFFER_SIZE	( 64 * 1024 * 1024 )
+
+/* The file statistics that are read in order of inode number
+ */
+#define LIBCDIRECTORY_DIRECTORY_INODE_ORDER_FILE_STATISTICS_FLAGS \
+	( LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE | LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME \
+	| LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_CHANGE_TIME | LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER \
+	| LIBCDIRECTORY_FILE_STATISTICS_FLAG_DEVICE_NUMBER | LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS \
+	| LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE | LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS )
+
+/* The interval in nanoseconds before the current time in which a modification time
+ * of a directory is not considered reliable, since a timestamp with a coarse
+ * granularity does not change when the directory is changed again within it
+ */
+#define LIBCDIRECTORY_DIRECTORY_RACY_INTERVAL			2000000000
+
+/* The internal read flags
+ */
+#define LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW			0x01
+#define LIBCDIRECTORY_READ_FLAG_IGNORE_FILTER			0x02
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libcdirectory_inode_order libcdirectory_inode_order_t;
+
+/* An inode order is used to sort directory entries by inode number
+ */
+struct libcdirectory_inode_order
+{
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The index of the directory entry
+	 */
+	int entry_index;
+};
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+
+typedef struct libcdirectory_linux_dirent64 libcdirectory_linux_dirent64_t;
+
+/* The Linux getdents64 directory entry record
+ */
+struct libcdirectory_linux_dirent64
+{
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The offset of the next record
+	 */
+	int64_t next_offset;
+
+	/* The record size
+	 */
+	uint16_t record_size;
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The name, which is variable of size
+	 */
+	char name[ 1 ];
+};
+
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
 typedef struct libcdirectory_internal_directory libcdirectory_internal_directory_t;
 
 struct libcdirectory_internal_directory
 {
+	/* The read buffer size, where 0 represents the system default
+	 */
+	size_t read_buffer_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The filter pattern, or NULL if not set
+	 */
+	libcdirectory_pattern_t *filter_pattern;
+
+	/* The filter entry type flags
+	 */
+	uint8_t filter_entry_type_flags;
+
+	/* The number of Bloom filter bits per entry
+	 */
+	uint8_t bloom_filter_bits_per_entry;
+
 #if defined( WINAPI )
 	HANDLE handle;
 
 	libcdirectory_directory_entry_t *first_entry;
 
+	/* The search path, which is used to open subdirectories
+	 */
+	system_character_t *path;
+
+	/* The search path size
+	 */
+	size_t path_size;
+
+	/* The position, which is the number of entries read since the search was started
+	 */
+	uint64_t read_position;
+
 #elif defined( HAVE_DIRENT_H )
 	DIR *stream;
 
-#if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	/* The first directory entry that reads its file statistics relative to the directory
+	 */
+	libcdirectory_internal_directory_entry_t *first_attached_entry;
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+	/* The file descriptor, used when reading via getdents64
+	 */
+	int descriptor;
+
+	/* The read buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The read buffer offset
+	 */
+	size_t read_buffer_offset;
+
+	/* The read buffer data size
+	 */
+	size_t read_buffer_data_size;
+
+	/* The position, which is the next offset (d_off) of the last record read
+	 */
+	uint64_t read_position;
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_DIRECTORY_PATH )
 	system_character_t *path;
 
 	size_t path_size;
 #endif
+
+#if defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+	/* The name index
+	 */
+	libcdirectory_name_index_t *name_index;
+
+	/* The directory modification time when the name index was built
+	 */
+	int64_t name_index_modification_time;
+
+	/* Value to indicate the name index was built within the racy interval
+	 * of the directory modification time
+	 */
+	uint8_t name_index_is_racy;
+
+	/* The Bloom filter
+	 */
+	libcdirectory_bloom_filter_t *bloom_filter;
+
+	/* The directory modification time when the Bloom filter was built
+	 */
+	int64_t bloom_filter_modification_time;
+
+	/* Value to indicate the Bloom filter was built within the racy interval
+	 * of the directory modification time
+	 */
+	uint8_t bloom_filter_is_racy;
+#endif
 #endif
 };
 
@@ -84,17 +292,266 @@ int libcdirectory_directory_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libcdirectory_internal_directory_open_at(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_t *internal_parent_directory,
+     const system_character_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_open_at(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_t *parent_directory,
+     const char *directory_name,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_open_at_wide(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_t *parent_directory,
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( LIBCDIRECTORY_HAVE_DIRFD )
+
+int libcdirectory_internal_directory_get_descriptor(
+     libcdirectory_internal_directory_t *internal_directory,
+     int *descriptor,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRFD ) */
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+
+int libcdirectory_internal_directory_get_file_identifier(
+     libcdirectory_internal_directory_t *internal_directory,
+     uint64_t *device_number,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_get_change_values(
+     libcdirectory_internal_directory_t *internal_directory,
+     uint64_t *device_number,
+     uint64_t *inode_number,
+     int64_t *modification_time,
+     int64_t *inode_change_time,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER ) */
+
+#if defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) || defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+
+int libcdirectory_internal_directory_set_entry_values(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint64_t inode_number,
+     uint16_t file_mode,
+     int descriptor,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) || defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
+
+#if defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE )
+
+int libcdirectory_internal_directory_probe_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *entry_name,
+     size_t entry_name_length,
+     int *entry_found,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_ENTRY_PROBE ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NAME_INDEX )
+
+int libcdirectory_internal_directory_get_modification_time(
+     libcdirectory_internal_directory_t *internal_directory,
+     int64_t *modification_time,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_is_racy_modification_time(
+     int64_t modification_time );
+
+int libcdirectory_internal_directory_build_name_index(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_get_indexed_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *entry_name,
+     size_t entry_name_length,
+     uint8_t entry_type,
+     uint8_t compare_flags,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_build_bloom_filter(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_bloom_filter_contains_name(
+     libcdirectory_internal_directory_t *internal_directory,
+     const char *entry_name,
+     size_t entry_name_length,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NAME_INDEX ) */
+
 LIBCDIRECTORY_EXTERN \
 int libcdirectory_directory_close(
      libcdirectory_directory_t *directory,
      libcerror_error_t **error );
 
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_set_read_buffer_size(
+     libcdirectory_directory_t *directory,
+     size_t read_buffer_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_set_flags(
+     libcdirectory_directory_t *directory,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_set_bloom_filter_bits_per_entry(
+     libcdirectory_directory_t *directory,
+     uint8_t bits_per_entry,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_set_filter(
+     libcdirectory_directory_t *directory,
+     const char *pattern,
+     size_t pattern_length,
+     uint8_t entry_type_flags,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+
+int libcdirectory_internal_directory_match_filter(
+     libcdirectory_internal_directory_t *internal_directory,
+     const char *name,
+     size_t name_length,
+     uint8_t dirent_type );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_DIRENT_H ) */
+
+int libcdirectory_internal_directory_match_entry_filter(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     libcerror_error_t **error );
+
+#if defined( LIBCDIRECTORY_HAVE_GETDENTS64 )
+
+int libcdirectory_internal_directory_open_descriptor(
+     libcdirectory_internal_directory_t *internal_directory,
+     int parent_descriptor,
+     const char *directory_name,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_read_buffered_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_GETDENTS64 ) */
+
+int libcdirectory_internal_directory_read_next_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_read_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 LIBCDIRECTORY_EXTERN \
 int libcdirectory_directory_read_entry(
      libcdirectory_directory_t *directory,
      libcdirectory_directory_entry_t *directory_entry,
      libcerror_error_t **error );
 
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_read_entry_view(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_read_entries(
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t **directory_entries,
+     int number_of_entries,
+     int *number_of_read_entries,
+     libcerror_error_t **error );
+
+#if defined( LIBCDIRECTORY_HAVE_DIRFD )
+
+int libcdirectory_inode_order_compare(
+     const void *first_inode_order,
+     const void *second_inode_order );
+
+int libcdirectory_internal_directory_read_entries_file_statistics(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_directory_entry_t **directory_entries,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRFD ) */
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_rewind(
+     libcdirectory_directory_t *directory,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_get_position(
+     libcdirectory_directory_t *directory,
+     uint64_t *position,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_set_position(
+     libcdirectory_directory_t *directory,
+     uint64_t position,
+     libcerror_error_t **error );
+
+#if defined( LIBCDIRECTORY_HAVE_CHECKPOINT )
+
+int libcdirectory_internal_directory_get_identity(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_checkpoint_t *checkpoint,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_CHECKPOINT ) */
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_get_checkpoint(
+     libcdirectory_directory_t *directory,
+     uint8_t *checkpoint_data,
+     size_t checkpoint_data_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_restore_checkpoint(
+     libcdirectory_directory_t *directory,
+     const uint8_t *checkpoint_data,
+     size_t checkpoint_data_size,
+     uint8_t checkpoint_flags,
+     libcerror_error_t **error );
+
 LIBCDIRECTORY_EXTERN \
 int libcdirectory_directory_has_entry(
      libcdirectory_directory_t *directory,
@@ -105,6 +562,25 @@ int libcdirectory_directory_has_entry(
      uint8_t compare_flags,
      libcerror_error_t **error );
 
+int libcdirectory_internal_directory_copy_found_entry(
+     libcdirectory_internal_directory_t *internal_directory,
+     libcdirectory_directory_entry_t **directory_entries,
+     int entry_index,
+     libcdirectory_directory_entry_t *search_directory_entry,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_has_entries(
+     libcdirectory_directory_t *directory,
+     const char **entry_names,
+     const size_t *entry_name_lengths,
+     const uint8_t *entry_types,
+     const uint8_t *compare_flags,
+     int number_of_entries,
+     libcdirectory_directory_entry_t **directory_entries,
+     uint8_t *entries_found,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 LIBCDIRECTORY_EXTERN \
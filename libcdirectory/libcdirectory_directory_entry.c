@@ -45,12 +45,33 @@
 #include <unistd.h>
 #endif
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( __linux__ ) && defined( HAVE_LINUX_STAT_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_UNISTD_H )
+#include <linux/stat.h>
+#include <sys/syscall.h>
+#endif
+
 #include "libcdirectory_definitions.h"
 #include "libcdirectory_directory_entry.h"
 #include "libcdirectory_libcerror.h"
 #include "libcdirectory_system_string.h"
 #include "libcdirectory_types.h"
 
+#if defined( __linux__ ) && defined( HAVE_LINUX_STAT_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_UNISTD_H ) && defined( SYS_statx ) && defined( STATX_BASIC_STATS )
+#define LIBCDIRECTORY_HAVE_STATX
+#endif
+
+#if defined( __linux__ ) && !defined( AT_NO_AUTOMOUNT )
+#define AT_NO_AUTOMOUNT		0x800
+#endif
+
+#if !defined( AT_NO_AUTOMOUNT )
+#define AT_NO_AUTOMOUNT		0
+#endif
+
 /* Creates a directory entry
  * Make sure the value directory_entry is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -112,6 +133,9 @@ int libcdirectory_directory_entry_initialize(
 
 		goto on_error;
 	}
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	internal_directory_entry->directory_descriptor = -1;
+#endif
 	*directory_entry = (libcdirectory_directory_entry_t *) internal_directory_entry;
 
 	return( 1 );
@@ -151,6 +175,10 @@ int libcdirectory_directory_entry_free(
 		internal_directory_entry = (libcdirectory_internal_directory_entry_t *) *directory_entry;
 		*directory_entry         = NULL;
 
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+		libcdirectory_internal_directory_entry_detach(
+		 internal_directory_entry );
+#endif
 #if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		if( internal_directory_entry->narrow_name != NULL )
 		{
@@ -316,6 +344,65 @@ int libcdirectory_directory_entry_copy(
 #if defined( HAVE_DIRENT_H ) && !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
 	internal_destination_directory_entry->st_mode = internal_source_directory_entry->st_mode;
 #endif
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	/* The name of an entry view is copied into the destination directory entry
+	 */
+	if( internal_source_directory_entry->view_name != NULL )
+	{
+		if( libcdirectory_internal_directory_entry_copy_name(
+		     internal_destination_directory_entry,
+		     internal_source_directory_entry->view_name,
+		     narrow_string_length(
+		      internal_source_directory_entry->view_name ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy view name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_destination_directory_entry->view_name = NULL;
+
+	/* The destination directory entry is attached to the directory of the source directory entry
+	 * so that it is detached when the directory is closed
+	 */
+	if( internal_destination_directory_entry != internal_source_directory_entry )
+	{
+		if( internal_source_directory_entry->first_attached_entry != NULL )
+		{
+			libcdirectory_internal_directory_entry_attach(
+			 internal_destination_directory_entry,
+			 internal_source_directory_entry->first_attached_entry,
+			 internal_source_directory_entry->directory_descriptor );
+		}
+		else
+		{
+			libcdirectory_internal_directory_entry_detach(
+			 internal_destination_directory_entry );
+
+			internal_destination_directory_entry->directory_is_closed = internal_source_directory_entry->directory_is_closed;
+		}
+	}
+	internal_destination_directory_entry->flags                             = internal_source_directory_entry->flags;
+	internal_destination_directory_entry->file_statistics_flags             = internal_source_directory_entry->file_statistics_flags;
+	internal_destination_directory_entry->file_statistics_unavailable_flags = internal_source_directory_entry->file_statistics_unavailable_flags;
+	internal_destination_directory_entry->size                              = internal_source_directory_entry->size;
+	internal_destination_directory_entry->modification_time                 = internal_source_directory_entry->modification_time;
+	internal_destination_directory_entry->inode_change_time                 = internal_source_directory_entry->inode_change_time;
+	internal_destination_directory_entry->creation_time                     = internal_source_directory_entry->creation_time;
+	internal_destination_directory_entry->inode_number                      = internal_source_directory_entry->inode_number;
+	internal_destination_directory_entry->device_number                     = internal_source_directory_entry->device_number;
+	internal_destination_directory_entry->number_of_links                   = internal_source_directory_entry->number_of_links;
+	internal_destination_directory_entry->number_of_blocks                  = internal_source_directory_entry->number_of_blocks;
+	internal_destination_directory_entry->file_mode                         = internal_source_directory_entry->file_mode;
+
+#endif /* !defined( WINAPI ) && defined( HAVE_DIRENT_H ) */
+
 	return( 1 );
 
 on_error:
@@ -339,6 +426,162 @@ on_error:
 	return( -1 );
 }
 
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+
+/* Attaches the directory entry to the attached entries of a directory
+ * The directory descriptor is used to read the file statistics on demand
+ * until the directory is closed
+ */
+void libcdirectory_internal_directory_entry_attach(
+      libcdirectory_internal_directory_entry_t *internal_directory_entry,
+      libcdirectory_internal_directory_entry_t **first_attached_entry,
+      int directory_descriptor )
+{
+	if( ( internal_directory_entry == NULL )
+	 || ( first_attached_entry == NULL ) )
+	{
+		return;
+	}
+	if( internal_directory_entry->first_attached_entry != first_attached_entry )
+	{
+		libcdirectory_internal_directory_entry_detach(
+		 internal_directory_entry );
+
+		internal_directory_entry->first_attached_entry    = first_attached_entry;
+		internal_directory_entry->previous_attached_entry = NULL;
+		internal_directory_entry->next_attached_entry     = *first_attached_entry;
+
+		if( *first_attached_entry != NULL )
+		{
+			( *first_attached_entry )->previous_attached_entry = internal_directory_entry;
+		}
+		*first_attached_entry = internal_directory_entry;
+	}
+	internal_directory_entry->directory_descriptor = directory_descriptor;
+	internal_directory_entry->directory_is_closed  = 0;
+}
+
+/* Detaches the directory entry from the attached entries of a directory
+ */
+void libcdirectory_internal_directory_entry_detach(
+      libcdirectory_internal_directory_entry_t *internal_directory_entry )
+{
+	if( internal_directory_entry == NULL )
+	{
+		return;
+	}
+	if( internal_directory_entry->first_attached_entry != NULL )
+	{
+		if( internal_directory_entry->previous_attached_entry != NULL )
+		{
+			internal_directory_entry->previous_attached_entry->next_attached_entry = internal_directory_entry->next_attached_entry;
+		}
+		else
+		{
+			*( internal_directory_entry->first_attached_entry ) = internal_directory_entry->next_attached_entry;
+		}
+		if( internal_directory_entry->next_attached_entry != NULL )
+		{
+			internal_directory_entry->next_attached_entry->previous_attached_entry = internal_directory_entry->previous_attached_entry;
+		}
+	}
+	internal_directory_entry->first_attached_entry    = NULL;
+	internal_directory_entry->previous_attached_entry = NULL;
+	internal_directory_entry->next_attached_entry     = NULL;
+	internal_directory_entry->directory_descriptor    = -1;
+	internal_directory_entry->directory_is_closed     = 0;
+}
+
+/* Detaches all the attached entries of a directory that is closed
+ * The file statistics that were not read before are no longer available
+ */
+void libcdirectory_internal_directory_entry_detach_all(
+      libcdirectory_internal_directory_entry_t **first_attached_entry )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+
+	if( first_attached_entry == NULL )
+	{
+		return;
+	}
+	while( *first_attached_entry != NULL )
+	{
+		internal_directory_entry = *first_attached_entry;
+		*first_attached_entry    = internal_directory_entry->next_attached_entry;
+
+		internal_directory_entry->first_attached_entry    = NULL;
+		internal_directory_entry->previous_attached_entry = NULL;
+		internal_directory_entry->next_attached_entry     = NULL;
+		internal_directory_entry->directory_descriptor    = -1;
+		internal_directory_entry->directory_is_closed     = 1;
+	}
+}
+
+/* Copies a name into the directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_entry_copy_name(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_entry_copy_name";
+
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length >= sizeof( internal_directory_entry->entry.d_name ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_directory_entry->entry.d_name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry->entry.d_name[ name_length ] = 0;
+
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_DIRENT_H ) */
+
 #if defined( WINAPI ) && ( WINVER >= 0x0400 )
 
 /* Retrieves the directory entry type
@@ -405,6 +648,8 @@ int libcdirectory_directory_entry_get_type(
 
 /* Retrieves the directory entry type
  * This function uses the POSIX directory entry structure
+ * An unknown type is resolved using the file statistics when the directory
+ * was read with LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE
  * Returns 1 if successful or -1 on error
  */
 int libcdirectory_directory_entry_get_type(
@@ -414,6 +659,11 @@ int libcdirectory_directory_entry_get_type(
 {
 	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
 	static char *function                                              = "libcdirectory_directory_entry_get_type";
+	mode_t file_mode                                                   = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	int result                                                         = 0;
+#endif
 
 	if( directory_entry == NULL )
 	{
@@ -469,6 +719,30 @@ int libcdirectory_directory_entry_get_type(
 
 		case DT_UNKNOWN:
 			*type = LIBCDIRECTORY_ENTRY_TYPE_UNDEFINED;
+
+			if( ( internal_directory_entry->flags & LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE ) != 0 )
+			{
+				result = libcdirectory_internal_directory_entry_read_file_statistics(
+				          internal_directory_entry,
+				          LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to read file statistics.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					file_mode = (mode_t) internal_directory_entry->file_mode;
+				}
+			}
 			break;
 #if defined( DT_WHT )
 		case DT_WHT:
@@ -486,8 +760,18 @@ int libcdirectory_directory_entry_get_type(
 
 			return( -1 );
 	}
+	/* The file mode is only set when an unknown type was resolved
+	 */
+	if( file_mode == 0 )
+	{
+		return( 1 );
+	}
 #else
-	switch( internal_directory_entry->st_mode & S_IFMT )
+	file_mode = internal_directory_entry->st_mode;
+
+#endif /* defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE ) */
+
+	switch( file_mode & S_IFMT )
 	{
 		case S_IFBLK:
 		case S_IFCHR:
@@ -532,8 +816,6 @@ int libcdirectory_directory_entry_get_type(
 
 			return( -1 );
 	}
-#endif /* defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE ) */
-
 	return( 1 );
 }
 
@@ -703,7 +985,14 @@ int libcdirectory_directory_entry_get_name(
 
 		return( -1 );
 	}
-	*name = internal_directory_entry->entry.d_name;
+	if( internal_directory_entry->view_name != NULL )
+	{
+		*name = internal_directory_entry->view_name;
+	}
+	else
+	{
+		*name = internal_directory_entry->entry.d_name;
+	}
 
 	return( 1 );
 }
@@ -850,6 +1139,7 @@ int libcdirectory_directory_entry_get_name_wide(
      libcerror_error_t **error )
 {
 	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	char *directory_name                                               = NULL;
 	static char *function                                              = "libcdirectory_directory_entry_get_name_wide";
 	size_t directory_name_length                                       = 0;
 	size_t wide_directory_name_size                                    = 0;
@@ -878,11 +1168,19 @@ int libcdirectory_directory_entry_get_name_wide(
 
 		return( -1 );
 	}
+	if( internal_directory_entry->view_name != NULL )
+	{
+		directory_name = internal_directory_entry->view_name;
+	}
+	else
+	{
+		directory_name = internal_directory_entry->entry.d_name;
+	}
 	directory_name_length = narrow_string_length(
-	                         internal_directory_entry->entry.d_name );
+	                         directory_name );
 
 	if( libcdirectory_system_string_size_to_wide_string(
-	     internal_directory_entry->entry.d_name,
+	     directory_name,
 	     directory_name_length + 1,
 	     &wide_directory_name_size,
 	     error ) != 1 )
@@ -916,7 +1214,7 @@ int libcdirectory_directory_entry_get_name_wide(
 		goto on_error;
 	}
 	if( libcdirectory_system_string_copy_to_wide_string(
-	     internal_directory_entry->entry.d_name,
+	     directory_name,
 	     directory_name_length + 1,
 	     internal_directory_entry->wide_name,
 	     wide_directory_name_size,
@@ -952,3 +1250,1180 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+
+/* Sets the file statistics of the directory entry from a stat structure
+ * Returns the file statistics flags of the values that were set
+ */
+uint32_t libcdirectory_internal_directory_entry_set_file_statistics(
+          libcdirectory_internal_directory_entry_t *internal_directory_entry,
+          const struct stat *file_statistics )
+{
+	uint32_t available_flags = 0;
+
+	internal_directory_entry->size             = (uint64_t) file_statistics->st_size;
+	internal_directory_entry->inode_number     = (uint64_t) file_statistics->st_ino;
+	internal_directory_entry->device_number    = (uint64_t) file_statistics->st_dev;
+	internal_directory_entry->number_of_links  = (uint64_t) file_statistics->st_nlink;
+	internal_directory_entry->number_of_blocks = (uint64_t) file_statistics->st_blocks;
+	internal_directory_entry->file_mode        = (uint16_t) file_statistics->st_mode;
+
+#if defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	internal_directory_entry->modification_time = ( (int64_t) file_statistics->st_mtim.tv_sec * 1000000000 )
+	                                            + file_statistics->st_mtim.tv_nsec;
+	internal_directory_entry->inode_change_time = ( (int64_t) file_statistics->st_ctim.tv_sec * 1000000000 )
+	                                            + file_statistics->st_ctim.tv_nsec;
+#elif defined( HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC )
+	internal_directory_entry->modification_time = ( (int64_t) file_statistics->st_mtimespec.tv_sec * 1000000000 )
+	                                            + file_statistics->st_mtimespec.tv_nsec;
+	internal_directory_entry->inode_change_time = ( (int64_t) file_statistics->st_ctimespec.tv_sec * 1000000000 )
+	                                            + file_statistics->st_ctimespec.tv_nsec;
+#else
+	internal_directory_entry->modification_time = (int64_t) file_statistics->st_mtime * 1000000000;
+	internal_directory_entry->inode_change_time = (int64_t) file_statistics->st_ctime * 1000000000;
+#endif
+	available_flags = LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_CHANGE_TIME
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_DEVICE_NUMBER
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS
+	                | LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE;
+
+#if defined( HAVE_STRUCT_STAT_ST_BIRTHTIMESPEC_TV_NSEC )
+	internal_directory_entry->creation_time = ( (int64_t) file_statistics->st_birthtimespec.tv_sec * 1000000000 )
+	                                        + file_statistics->st_birthtimespec.tv_nsec;
+	available_flags                        |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_CREATION_TIME;
+#endif
+
+	internal_directory_entry->file_statistics_flags |= available_flags;
+
+	return( available_flags );
+}
+
+/* Reads the file statistics of the directory entry
+ * The file statistics are read relative to the descriptor of the directory the entry
+ * was read from and only the values not read before are requested
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_internal_directory_entry_read_file_statistics(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint32_t file_statistics_flags,
+     libcerror_error_t **error )
+{
+#if defined( LIBCDIRECTORY_HAVE_STATX )
+	struct statx extended_file_statistics;
+
+	unsigned int statx_mask  = 0;
+	long statx_result        = 0;
+#endif
+#if defined( HAVE_FSTATAT )
+	struct stat file_statistics;
+#endif
+
+	char *entry_name         = NULL;
+	static char *function    = "libcdirectory_internal_directory_entry_read_file_statistics";
+	uint32_t available_flags = 0;
+
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_directory_entry->file_statistics_flags & file_statistics_flags ) == file_statistics_flags )
+	{
+		return( 1 );
+	}
+	if( ( internal_directory_entry->file_statistics_unavailable_flags & file_statistics_flags ) != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_directory_entry->directory_is_closed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory entry - directory was closed.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_entry->directory_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( internal_directory_entry->view_name != NULL )
+	{
+		entry_name = internal_directory_entry->view_name;
+	}
+	else
+	{
+		entry_name = internal_directory_entry->entry.d_name;
+	}
+#if defined( LIBCDIRECTORY_HAVE_STATX )
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE ) != 0 )
+	{
+		statx_mask |= STATX_SIZE;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME ) != 0 )
+	{
+		statx_mask |= STATX_MTIME;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_CHANGE_TIME ) != 0 )
+	{
+		statx_mask |= STATX_CTIME;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_CREATION_TIME ) != 0 )
+	{
+		statx_mask |= STATX_BTIME;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER ) != 0 )
+	{
+		statx_mask |= STATX_INO;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS ) != 0 )
+	{
+		statx_mask |= STATX_NLINK;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS ) != 0 )
+	{
+		statx_mask |= STATX_BLOCKS;
+	}
+	if( ( file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE ) != 0 )
+	{
+		statx_mask |= STATX_TYPE | STATX_MODE;
+	}
+	/* The device number is always returned by statx
+	 */
+	statx_result = syscall(
+	                SYS_statx,
+	                internal_directory_entry->directory_descriptor,
+	                entry_name,
+	                AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT,
+	                statx_mask,
+	                &extended_file_statistics );
+
+	if( statx_result == 0 )
+	{
+		/* statx can return more values than requested, these are retained as well
+		 */
+		if( ( extended_file_statistics.stx_mask & STATX_SIZE ) != 0 )
+		{
+			internal_directory_entry->size = (uint64_t) extended_file_statistics.stx_size;
+			available_flags               |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE;
+		}
+		if( ( extended_file_statistics.stx_mask & STATX_MTIME ) != 0 )
+		{
+			internal_directory_entry->modification_time = ( (int64_t) extended_file_statistics.stx_mtime.tv_sec * 1000000000 )
+			                                            + extended_file_statistics.stx_mtime.tv_nsec;
+			available_flags                            |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME;
+		}
+		if( ( extended_file_statistics.stx_mask & STATX_CTIME ) != 0 )
+		{
+			internal_directory_entry->inode_change_time = ( (int64_t) extended_file_statistics.stx_ctime.tv_sec * 1000000000 )
+			                                            + extended_file_statistics.stx_ctime.tv_nsec;
+			available_flags                            |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_CHANGE_TIME;
+		}
+		if( ( extended_file_statistics.stx_mask & STATX_BTIME ) != 0 )
+		{
+			internal_directory_entry->creation_time = ( (int64_t) extended_file_statistics.stx_btime.tv_sec * 1000000000 )
+			                                        + extended_file_statistics.stx_btime.tv_nsec;
+			available_flags                        |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_CREATION_TIME;
+		}
+		if( ( extended_file_statistics.stx_mask & STATX_INO ) != 0 )
+		{
+			internal_directory_entry->inode_number = (uint64_t) extended_file_statistics.stx_ino;
+			available_flags                       |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER;
+		}
+		if( ( extended_file_statistics.stx_mask & STATX_NLINK ) != 0 )
+		{
+			internal_directory_entry->number_of_links = (uint64_t) extended_file_statistics.stx_nlink;
+			available_flags                          |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS;
+		}
+		if( ( extended_file_statistics.stx_mask & STATX_BLOCKS ) != 0 )
+		{
+			internal_directory_entry->number_of_blocks = (uint64_t) extended_file_statistics.stx_blocks;
+			available_flags                           |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS;
+		}
+		if( ( extended_file_statistics.stx_mask & ( STATX_TYPE | STATX_MODE ) ) == ( STATX_TYPE | STATX_MODE ) )
+		{
+			internal_directory_entry->file_mode = (uint16_t) extended_file_statistics.stx_mode;
+			available_flags                    |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE;
+		}
+		/* The device number is stored in the same encoding as st_dev by glibc
+		 */
+		internal_directory_entry->device_number = ( ( (uint64_t) extended_file_statistics.stx_dev_major & 0xfffff000UL ) << 32 )
+		                                        | ( ( (uint64_t) extended_file_statistics.stx_dev_major & 0x00000fffUL ) << 8 )
+		                                        | ( ( (uint64_t) extended_file_statistics.stx_dev_minor & 0xffffff00UL ) << 12 )
+		                                        | ( (uint64_t) extended_file_statistics.stx_dev_minor & 0x000000ffUL );
+		available_flags                        |= LIBCDIRECTORY_FILE_STATISTICS_FLAG_DEVICE_NUMBER;
+	}
+	else if( errno != ENOSYS )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve extended file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else
+#endif /* defined( LIBCDIRECTORY_HAVE_STATX ) */
+	{
+#if defined( HAVE_FSTATAT )
+		if( fstatat(
+		     internal_directory_entry->directory_descriptor,
+		     entry_name,
+		     &file_statistics,
+		     AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 errno,
+			 "%s: unable to retrieve file statistics.",
+			 function );
+
+			return( -1 );
+		}
+		available_flags = libcdirectory_internal_directory_entry_set_file_statistics(
+		                   internal_directory_entry,
+		                   &file_statistics );
+
+#endif /* defined( HAVE_FSTATAT ) */
+	}
+	internal_directory_entry->file_statistics_flags |= available_flags;
+
+	/* Requested values that were not returned are not available on the file system
+	 */
+	internal_directory_entry->file_statistics_unavailable_flags |= file_statistics_flags & ~( internal_directory_entry->file_statistics_flags );
+
+	if( ( internal_directory_entry->file_statistics_flags & file_statistics_flags ) != file_statistics_flags )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_DIRENT_H ) */
+
+/* Retrieves the size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_size(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_size";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*size = ( (uint64_t) internal_directory_entry->find_data.nFileSizeHigh << 32 )
+	      | internal_directory_entry->find_data.nFileSizeLow;
+
+	return( 1 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*size = internal_directory_entry->size;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the modification time
+ * The time is a signed POSIX time in number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_modification_time(
+     libcdirectory_directory_entry_t *directory_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_modification_time";
+
+#if defined( WINAPI )
+	uint64_t filetime                                                  = 0;
+#elif defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid posix time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	filetime = ( (uint64_t) internal_directory_entry->find_data.ftLastWriteTime.dwHighDateTime << 32 )
+	         | internal_directory_entry->find_data.ftLastWriteTime.dwLowDateTime;
+
+	*posix_time = ( (int64_t) filetime - (int64_t) 116444736000000000LL ) * 100;
+
+	return( 1 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*posix_time = internal_directory_entry->modification_time;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the inode change time
+ * The time is a signed POSIX time in number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_inode_change_time(
+     libcdirectory_directory_entry_t *directory_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_inode_change_time";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid posix time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_CHANGE_TIME,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*posix_time = internal_directory_entry->inode_change_time;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the creation time
+ * The time is a signed POSIX time in number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_creation_time(
+     libcdirectory_directory_entry_t *directory_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_creation_time";
+
+#if defined( WINAPI )
+	uint64_t filetime                                                  = 0;
+#elif defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid posix time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	filetime = ( (uint64_t) internal_directory_entry->find_data.ftCreationTime.dwHighDateTime << 32 )
+	         | internal_directory_entry->find_data.ftCreationTime.dwLowDateTime;
+
+	*posix_time = ( (int64_t) filetime - (int64_t) 116444736000000000LL ) * 100;
+
+	return( 1 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_CREATION_TIME,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*posix_time = internal_directory_entry->creation_time;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the inode number
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_inode_number(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_inode_number";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*inode_number = internal_directory_entry->inode_number;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the device number
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_device_number(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *device_number,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_device_number";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( device_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device number.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_DEVICE_NUMBER,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*device_number = internal_directory_entry->device_number;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the number of links
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_number_of_links(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *number_of_links,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_number_of_links";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( number_of_links == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of links.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*number_of_links = internal_directory_entry->number_of_links;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the allocated size
+ * The allocated size is the size of the blocks allocated on the file system
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_allocated_size(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_allocated_size";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*allocated_size = internal_directory_entry->number_of_blocks * 512;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the file mode
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_directory_entry_get_file_mode(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint16_t *file_mode,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_entry_t *internal_directory_entry = NULL;
+	static char *function                                              = "libcdirectory_directory_entry_get_file_mode";
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	int result                                                         = 0;
+#endif
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry = (libcdirectory_internal_directory_entry_t *) directory_entry;
+
+	if( file_mode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          internal_directory_entry,
+	          LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*file_mode = internal_directory_entry->file_mode;
+	}
+	return( result );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
+/* Retrieves the values of the directory entry that are retained by a detached directory entry
+ * The attributes contain the file attributes on Windows and the file type bits of the file mode otherwise
+ * The type of the directory entry should be retrieved before to resolve an unknown type
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_entry_get_detached_values(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint32_t *attributes,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_entry_get_detached_values";
+
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*attributes   = (uint32_t) internal_directory_entry->find_data.dwFileAttributes;
+	*inode_number = 0;
+
+#elif defined( HAVE_DIRENT_H )
+	/* Retain the resolved file type if the entry type was resolved on demand
+	 */
+	if( ( internal_directory_entry->file_statistics_flags & LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE ) != 0 )
+	{
+		*attributes = (uint32_t) ( internal_directory_entry->file_mode & S_IFMT );
+	}
+	else
+	{
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+		*attributes = (uint32_t) DTTOIF( internal_directory_entry->entry.d_type );
+#else
+		*attributes = (uint32_t) ( internal_directory_entry->st_mode & S_IFMT );
+#endif
+	}
+	*inode_number = (uint64_t) internal_directory_entry->entry.d_ino;
+
+#else
+#error Missing directory entry structure definition
+#endif
+	return( 1 );
+}
+
+/* Sets the directory entry to a detached directory entry
+ * A detached directory entry is not associated with an open directory, hence the values
+ * that are read from the file statistics are not available
+ * On POSIX the directory entry references the name, which must remain valid while the directory entry is used
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_directory_entry_set_detached_values(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *name,
+     size_t name_length,
+     uint32_t attributes,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_entry_set_detached_values";
+
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( internal_directory_entry->narrow_name != NULL )
+	{
+		memory_free(
+		 internal_directory_entry->narrow_name );
+
+		internal_directory_entry->narrow_name = NULL;
+	}
+#else
+	if( internal_directory_entry->wide_name != NULL )
+	{
+		memory_free(
+		 internal_directory_entry->wide_name );
+
+		internal_directory_entry->wide_name = NULL;
+	}
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+#if defined( WINAPI )
+	if( memory_set(
+	     &( internal_directory_entry->find_data ),
+	     0,
+	     sizeof( WIN32_FIND_DATA ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear find data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_system_string_copy_from_narrow_string(
+	     internal_directory_entry->find_data.cFileName,
+	     MAX_PATH,
+	     name,
+	     name_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_entry->find_data.dwFileAttributes = (DWORD) attributes;
+
+#elif defined( HAVE_DIRENT_H )
+	internal_directory_entry->entry.d_ino = (ino_t) inode_number;
+
+#if defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
+	internal_directory_entry->entry.d_type = (unsigned char) IFTODT( (mode_t) attributes );
+#else
+	internal_directory_entry->st_mode = (mode_t) attributes;
+#endif
+	libcdirectory_internal_directory_entry_detach(
+	 internal_directory_entry );
+
+	internal_directory_entry->view_name                         = (char *) name;
+	internal_directory_entry->flags                             = 0;
+	internal_directory_entry->file_statistics_flags             = 0;
+	internal_directory_entry->file_statistics_unavailable_flags = 0;
+
+#else
+#error Missing directory entry structure definition
+#endif
+	return( 1 );
+}
+
+/* Retrieves the inode number as read from the directory
+ * Unlike libcdirectory_directory_entry_get_inode_number this does not read the file statistics,
+ * hence for a mount point it is the inode number of the directory that is mounted on
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdirectory_internal_directory_entry_get_entry_inode_number(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_directory_entry_get_entry_inode_number";
+
+	if( internal_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The value is not provided by the find data
+	 */
+	return( 0 );
+
+#elif defined( HAVE_DIRENT_H )
+	*inode_number = (uint64_t) internal_directory_entry->entry.d_ino;
+
+	return( 1 );
+
+#else
+#error Missing directory entry structure definition
+#endif
+}
+
@@ -45,7 +45,9 @@
 #include "libcdirectory_libcerror.h"
 #include "libcdirectory_types.h"
 
-#if defined( HAVE_DIRENT_H ) && ( defined( _DIRENT_HAVE_D_TYPE ) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) )
+/* LIBCDIRECTORY_DISABLE_DIRENT_D_TYPE can be defined to force the code path used by systems without d_type
+ */
+#if defined( HAVE_DIRENT_H ) && !defined( LIBCDIRECTORY_DISABLE_DIRENT_D_TYPE ) && ( defined( _DIRENT_HAVE_D_TYPE ) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) )
 #define LIBCDIRECTORY_HAVE_DIRENT_D_TYPE
 #endif
 
@@ -53,6 +55,21 @@
 extern "C" {
 #endif
 
+/* The file statistics flags
+ */
+enum LIBCDIRECTORY_FILE_STATISTICS_FLAGS
+{
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE			= 0x0001,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME	= 0x0002,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_CHANGE_TIME	= 0x0004,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_CREATION_TIME	= 0x0008,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER		= 0x0010,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_DEVICE_NUMBER	= 0x0020,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS	= 0x0040,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_FILE_MODE		= 0x0080,
+	LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS	= 0x0100
+};
+
 typedef struct libcdirectory_internal_directory_entry libcdirectory_internal_directory_entry_t;
 
 struct libcdirectory_internal_directory_entry
@@ -63,9 +80,85 @@ struct libcdirectory_internal_directory_entry
 #elif defined( HAVE_DIRENT_H )
 	struct dirent entry;
 
+	/* The name of an entry view, which references data owned by
+	 * the directory, or NULL if the entry is not a view
+	 */
+	char *view_name;
+
 #if !defined( LIBCDIRECTORY_HAVE_DIRENT_D_TYPE )
 	mode_t st_mode;
 #endif
+
+	/* The flags of the directory the entry was read from
+	 */
+	uint8_t flags;
+
+	/* The descriptor of the directory the entry was read from, or -1 if not available
+	 * The descriptor is owned by the directory
+	 */
+	int directory_descriptor;
+
+	/* The first attached entry of the directory the entry was read from, or NULL if
+	 * the entry is not attached. The directory detaches its entries when it is closed
+	 */
+	libcdirectory_internal_directory_entry_t **first_attached_entry;
+
+	/* The previous attached entry
+	 */
+	libcdirectory_internal_directory_entry_t *previous_attached_entry;
+
+	/* The next attached entry
+	 */
+	libcdirectory_internal_directory_entry_t *next_attached_entry;
+
+	/* Value to indicate the directory the entry was read from was closed
+	 */
+	uint8_t directory_is_closed;
+
+	/* The file statistics flags, which indicate the values that have been read
+	 */
+	uint32_t file_statistics_flags;
+
+	/* The file statistics flags, which indicate the values that are not available
+	 */
+	uint32_t file_statistics_unavailable_flags;
+
+	/* The size
+	 */
+	uint64_t size;
+
+	/* The modification time
+	 */
+	int64_t modification_time;
+
+	/* The inode change time
+	 */
+	int64_t inode_change_time;
+
+	/* The creation time
+	 */
+	int64_t creation_time;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The device number
+	 */
+	uint64_t device_number;
+
+	/* The number of links
+	 */
+	uint64_t number_of_links;
+
+	/* The number of allocated blocks of 512 bytes
+	 */
+	uint64_t number_of_blocks;
+
+	/* The file mode
+	 */
+	uint16_t file_mode;
+
 #endif /* defined( WINAPI ) */
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -91,6 +184,27 @@ int libcdirectory_directory_entry_copy(
      libcdirectory_directory_entry_t *source_directory_entry,
      libcerror_error_t **error );
 
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+
+void libcdirectory_internal_directory_entry_attach(
+      libcdirectory_internal_directory_entry_t *internal_directory_entry,
+      libcdirectory_internal_directory_entry_t **first_attached_entry,
+      int directory_descriptor );
+
+void libcdirectory_internal_directory_entry_detach(
+      libcdirectory_internal_directory_entry_t *internal_directory_entry );
+
+void libcdirectory_internal_directory_entry_detach_all(
+      libcdirectory_internal_directory_entry_t **first_attached_entry );
+
+int libcdirectory_internal_directory_entry_copy_name(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#endif
+
 LIBCDIRECTORY_EXTERN \
 int libcdirectory_directory_entry_get_type(
      libcdirectory_directory_entry_t *directory_entry,
@@ -113,6 +227,92 @@ int libcdirectory_directory_entry_get_name_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+
+uint32_t libcdirectory_internal_directory_entry_set_file_statistics(
+          libcdirectory_internal_directory_entry_t *internal_directory_entry,
+          const struct stat *file_statistics );
+
+int libcdirectory_internal_directory_entry_read_file_statistics(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint32_t file_statistics_flags,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_DIRENT_H ) */
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_size(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_modification_time(
+     libcdirectory_directory_entry_t *directory_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_inode_change_time(
+     libcdirectory_directory_entry_t *directory_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_creation_time(
+     libcdirectory_directory_entry_t *directory_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_inode_number(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_device_number(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *device_number,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_number_of_links(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *number_of_links,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_allocated_size(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint64_t *allocated_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_directory_entry_get_file_mode(
+     libcdirectory_directory_entry_t *directory_entry,
+     uint16_t *file_mode,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_entry_get_detached_values(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint32_t *attributes,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_entry_set_detached_values(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     const char *name,
+     size_t name_length,
+     uint32_t attributes,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_directory_entry_get_entry_inode_number(
+     libcdirectory_internal_directory_entry_t *internal_directory_entry,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1755 @@
+/*
+ * Disk usage functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_disk_usage.h"
+#include "libcdirectory_inode_set.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_parallel_walker.h"
+#include "libcdirectory_types.h"
+#include "libcdirectory_walker.h"
+
+/* Creates a disk usage
+ * Make sure the value disk_usage is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_initialize(
+     libcdirectory_disk_usage_t **disk_usage,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                    = "libcdirectory_disk_usage_initialize";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *disk_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid disk usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = memory_allocate_structure(
+	                       libcdirectory_internal_disk_usage_t );
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create disk usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_disk_usage,
+	     0,
+	     sizeof( libcdirectory_internal_disk_usage_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear disk usage.",
+		 function );
+
+		goto on_error;
+	}
+	*disk_usage = (libcdirectory_disk_usage_t *) internal_disk_usage;
+
+	return( 1 );
+
+on_error:
+	if( internal_disk_usage != NULL )
+	{
+		memory_free(
+		 internal_disk_usage );
+	}
+	return( -1 );
+}
+
+/* Frees a disk usage
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_free(
+     libcdirectory_disk_usage_t **disk_usage,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                    = "libcdirectory_disk_usage_free";
+	int result                                               = 1;
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *disk_usage != NULL )
+	{
+		internal_disk_usage = (libcdirectory_internal_disk_usage_t *) *disk_usage;
+		*disk_usage         = NULL;
+
+		if( libcdirectory_internal_disk_usage_clear(
+		     internal_disk_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear disk usage.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_disk_usage );
+	}
+	return( result );
+}
+
+/* Frees the records and hard links of an accumulator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_accumulator_free(
+     libcdirectory_disk_usage_accumulator_t *accumulator,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_disk_usage_accumulator_free";
+	int record_index      = 0;
+
+	if( accumulator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid accumulator.",
+		 function );
+
+		return( -1 );
+	}
+	if( accumulator->records != NULL )
+	{
+		for( record_index = 0;
+		     record_index < accumulator->number_of_records;
+		     record_index++ )
+		{
+			if( accumulator->records[ record_index ].path != NULL )
+			{
+				memory_free(
+				 accumulator->records[ record_index ].path );
+			}
+		}
+		memory_free(
+		 accumulator->records );
+
+		accumulator->records = NULL;
+	}
+	if( accumulator->hard_links != NULL )
+	{
+		memory_free(
+		 accumulator->hard_links );
+
+		accumulator->hard_links = NULL;
+	}
+	accumulator->number_of_records              = 0;
+	accumulator->number_of_allocated_records    = 0;
+	accumulator->current_record_index           = -1;
+	accumulator->number_of_hard_links           = 0;
+	accumulator->number_of_allocated_hard_links = 0;
+
+	return( 1 );
+}
+
+/* Appends a directory record to an accumulator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_accumulator_append_record(
+     libcdirectory_disk_usage_accumulator_t *accumulator,
+     const char *path,
+     size_t path_length,
+     int depth,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_disk_usage_record_t *record  = NULL;
+	libcdirectory_disk_usage_record_t *records = NULL;
+	static char *function                      = "libcdirectory_disk_usage_accumulator_append_record";
+	int number_of_allocated_records            = 0;
+
+	if( accumulator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid accumulator.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid depth value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( accumulator->number_of_records >= accumulator->number_of_allocated_records )
+	{
+		if( accumulator->number_of_allocated_records == 0 )
+		{
+			number_of_allocated_records = LIBCDIRECTORY_DISK_USAGE_INITIAL_NUMBER_OF_RECORDS;
+		}
+		else if( accumulator->number_of_allocated_records > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_disk_usage_record_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid accumulator - number of allocated records value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_records = accumulator->number_of_allocated_records * 2;
+		}
+		records = (libcdirectory_disk_usage_record_t *) memory_reallocate(
+		                                                 accumulator->records,
+		                                                 sizeof( libcdirectory_disk_usage_record_t ) * number_of_allocated_records );
+
+		if( records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			return( -1 );
+		}
+		accumulator->records                     = records;
+		accumulator->number_of_allocated_records = number_of_allocated_records;
+	}
+	record = &( accumulator->records[ accumulator->number_of_records ] );
+
+	if( memory_set(
+	     record,
+	     0,
+	     sizeof( libcdirectory_disk_usage_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		return( -1 );
+	}
+	record->path = narrow_string_allocate(
+	                path_length + 1 );
+
+	if( record->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     record->path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			memory_free(
+			 record->path );
+
+			record->path = NULL;
+
+			return( -1 );
+		}
+	}
+	record->path[ path_length ] = 0;
+	record->path_length         = path_length;
+	record->depth               = depth;
+
+	*record_index = accumulator->number_of_records;
+
+	accumulator->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Appends a hard link to an accumulator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_accumulator_append_hard_link(
+     libcdirectory_disk_usage_accumulator_t *accumulator,
+     uint64_t device_number,
+     uint64_t inode_number,
+     uint64_t apparent_size,
+     uint64_t allocated_size,
+     int record_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_disk_usage_hard_link_t *hard_link  = NULL;
+	libcdirectory_disk_usage_hard_link_t *hard_links = NULL;
+	static char *function                            = "libcdirectory_disk_usage_accumulator_append_hard_link";
+	int number_of_allocated_hard_links               = 0;
+
+	if( accumulator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid accumulator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= accumulator->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( accumulator->number_of_hard_links >= accumulator->number_of_allocated_hard_links )
+	{
+		if( accumulator->number_of_allocated_hard_links == 0 )
+		{
+			number_of_allocated_hard_links = LIBCDIRECTORY_DISK_USAGE_INITIAL_NUMBER_OF_HARD_LINKS;
+		}
+		else if( accumulator->number_of_allocated_hard_links > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_disk_usage_hard_link_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid accumulator - number of allocated hard links value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_hard_links = accumulator->number_of_allocated_hard_links * 2;
+		}
+		hard_links = (libcdirectory_disk_usage_hard_link_t *) memory_reallocate(
+		                                                       accumulator->hard_links,
+		                                                       sizeof( libcdirectory_disk_usage_hard_link_t ) * number_of_allocated_hard_links );
+
+		if( hard_links == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hard links.",
+			 function );
+
+			return( -1 );
+		}
+		accumulator->hard_links                     = hard_links;
+		accumulator->number_of_allocated_hard_links = number_of_allocated_hard_links;
+	}
+	hard_link = &( accumulator->hard_links[ accumulator->number_of_hard_links ] );
+
+	hard_link->device_number  = device_number;
+	hard_link->inode_number   = inode_number;
+	hard_link->apparent_size  = apparent_size;
+	hard_link->allocated_size = allocated_size;
+	hard_link->record_index   = record_index;
+
+	accumulator->number_of_hard_links += 1;
+
+	return( 1 );
+}
+
+/* The walk callback
+ * Every thread only updates its own accumulator. Since the parallel walker reads all
+ * the entries of a directory in the same thread, consecutive entries of the same parent
+ * directory are added to the same record
+ * Returns 1 to continue or -1 on error
+ */
+int libcdirectory_disk_usage_walk_callback(
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *path,
+     size_t path_length,
+     int depth,
+     int thread_index,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdirectory_disk_usage_accumulator_t *accumulator      = NULL;
+	libcdirectory_disk_usage_record_t *parent_record         = NULL;
+	libcdirectory_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                    = "libcdirectory_disk_usage_walk_callback";
+	size_t parent_path_length                                = 0;
+	uint64_t allocated_size                                  = 0;
+	uint64_t apparent_size                                   = 0;
+	uint64_t device_number                                   = 0;
+	uint64_t inode_number                                    = 0;
+	uint64_t number_of_links                                 = 1;
+	uint8_t entry_type                                       = 0;
+	int record_index                                         = 0;
+	int result                                               = 1;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libcdirectory_internal_disk_usage_t *) callback_data;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( thread_index < 0 )
+	 || ( thread_index >= internal_disk_usage->number_of_accumulators ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	accumulator = &( internal_disk_usage->accumulators[ thread_index ] );
+
+	parent_path_length = path_length;
+
+	while( parent_path_length > 0 )
+	{
+		parent_path_length--;
+
+		if( path[ parent_path_length ] == (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR )
+		{
+			break;
+		}
+	}
+	if( accumulator->current_record_index != -1 )
+	{
+		parent_record = &( accumulator->records[ accumulator->current_record_index ] );
+
+		if( ( parent_record->path_length != parent_path_length )
+		 || ( memory_compare(
+		       parent_record->path,
+		       path,
+		       parent_path_length ) != 0 ) )
+		{
+			parent_record = NULL;
+		}
+	}
+	if( parent_record == NULL )
+	{
+		if( libcdirectory_disk_usage_accumulator_append_record(
+		     accumulator,
+		     path,
+		     parent_path_length,
+		     depth - 1,
+		     &record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append parent directory record.",
+			 function );
+
+			return( -1 );
+		}
+		accumulator->current_record_index = record_index;
+	}
+	if( libcdirectory_directory_entry_get_type(
+	     directory_entry,
+	     &entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry type.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	/* Read all the file statistics with a single system call, the values are
+	 * retrieved from the directory entry afterwards
+	 */
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          (libcdirectory_internal_directory_entry_t *) directory_entry,
+	          LIBCDIRECTORY_DISK_USAGE_FILE_STATISTICS_FLAGS,
+	          error );
+
+	if( result == -1 )
+	{
+		/* The entry could have been removed after it was read, its sizes are not counted
+		 */
+		libcerror_error_free(
+		 error );
+	}
+#endif
+	if( result != -1 )
+	{
+		if( libcdirectory_directory_entry_get_size(
+		     directory_entry,
+		     &apparent_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_directory_entry_get_allocated_size(
+		     directory_entry,
+		     &allocated_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve allocated size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+	{
+		/* The directory contributes its own size, its entries are added
+		 * to a separate record by the thread that reads the directory
+		 */
+		if( libcdirectory_disk_usage_accumulator_append_record(
+		     accumulator,
+		     path,
+		     path_length,
+		     depth,
+		     &record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory record.",
+			 function );
+
+			return( -1 );
+		}
+		accumulator->records[ record_index ].apparent_size  = apparent_size;
+		accumulator->records[ record_index ].allocated_size = allocated_size;
+
+		accumulator->records[ accumulator->current_record_index ].number_of_directories += 1;
+
+		return( 1 );
+	}
+	if( result != -1 )
+	{
+		if( libcdirectory_directory_entry_get_number_of_links(
+		     directory_entry,
+		     &number_of_links,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of links.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_links > 1 )
+	{
+		if( libcdirectory_directory_entry_get_device_number(
+		     directory_entry,
+		     &device_number,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device number.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_directory_entry_get_inode_number(
+		     directory_entry,
+		     &inode_number,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( inode_number != 0 )
+	{
+		/* Files with multiple links are counted once after the walk
+		 */
+		if( libcdirectory_disk_usage_accumulator_append_hard_link(
+		     accumulator,
+		     device_number,
+		     inode_number,
+		     apparent_size,
+		     allocated_size,
+		     accumulator->current_record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append hard link.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		parent_record = &( accumulator->records[ accumulator->current_record_index ] );
+
+		parent_record->apparent_size   += apparent_size;
+		parent_record->allocated_size  += allocated_size;
+		parent_record->number_of_files += 1;
+	}
+	return( 1 );
+}
+
+/* Compares the paths of two records
+ * The path separator sorts before any other character, so that a directory
+ * is directly followed by all its sub directories (pre-order)
+ * Returns -1 if the first record sorts before the second, 0 if equal or 1 otherwise
+ */
+int libcdirectory_disk_usage_record_compare(
+     const void *first_record,
+     const void *second_record )
+{
+	const libcdirectory_disk_usage_record_t *first_disk_usage_record  = NULL;
+	const libcdirectory_disk_usage_record_t *second_disk_usage_record = NULL;
+	size_t path_index                                                 = 0;
+	uint8_t first_character                                           = 0;
+	uint8_t second_character                                          = 0;
+
+	first_disk_usage_record  = *( (const libcdirectory_disk_usage_record_t **) first_record );
+	second_disk_usage_record = *( (const libcdirectory_disk_usage_record_t **) second_record );
+
+	while( ( path_index < first_disk_usage_record->path_length )
+	    && ( path_index < second_disk_usage_record->path_length ) )
+	{
+		first_character  = (uint8_t) first_disk_usage_record->path[ path_index ];
+		second_character = (uint8_t) second_disk_usage_record->path[ path_index ];
+
+		if( first_character != second_character )
+		{
+			if( first_character == (uint8_t) LIBCDIRECTORY_WALKER_PATH_SEPARATOR )
+			{
+				return( -1 );
+			}
+			if( second_character == (uint8_t) LIBCDIRECTORY_WALKER_PATH_SEPARATOR )
+			{
+				return( 1 );
+			}
+			if( first_character < second_character )
+			{
+				return( -1 );
+			}
+			return( 1 );
+		}
+		path_index++;
+	}
+	if( first_disk_usage_record->path_length < second_disk_usage_record->path_length )
+	{
+		return( -1 );
+	}
+	else if( first_disk_usage_record->path_length > second_disk_usage_record->path_length )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two hard links by record index, device number and inode number
+ * Returns -1 if the first hard link sorts before the second, 0 if equal or 1 otherwise
+ */
+int libcdirectory_disk_usage_hard_link_compare(
+     const void *first_hard_link,
+     const void *second_hard_link )
+{
+	const libcdirectory_disk_usage_hard_link_t *first_disk_usage_hard_link  = NULL;
+	const libcdirectory_disk_usage_hard_link_t *second_disk_usage_hard_link = NULL;
+
+	first_disk_usage_hard_link  = (const libcdirectory_disk_usage_hard_link_t *) first_hard_link;
+	second_disk_usage_hard_link = (const libcdirectory_disk_usage_hard_link_t *) second_hard_link;
+
+	if( first_disk_usage_hard_link->record_index != second_disk_usage_hard_link->record_index )
+	{
+		return( ( first_disk_usage_hard_link->record_index < second_disk_usage_hard_link->record_index ) ? -1 : 1 );
+	}
+	if( first_disk_usage_hard_link->device_number != second_disk_usage_hard_link->device_number )
+	{
+		return( ( first_disk_usage_hard_link->device_number < second_disk_usage_hard_link->device_number ) ? -1 : 1 );
+	}
+	if( first_disk_usage_hard_link->inode_number != second_disk_usage_hard_link->inode_number )
+	{
+		return( ( first_disk_usage_hard_link->inode_number < second_disk_usage_hard_link->inode_number ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Clears the records and accumulators of a disk usage
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_disk_usage_clear(
+     libcdirectory_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_disk_usage_clear";
+	int accumulator_index = 0;
+	int record_index      = 0;
+	int result            = 1;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_disk_usage->accumulators != NULL )
+	{
+		for( accumulator_index = 0;
+		     accumulator_index < internal_disk_usage->number_of_accumulators;
+		     accumulator_index++ )
+		{
+			if( libcdirectory_disk_usage_accumulator_free(
+			     &( internal_disk_usage->accumulators[ accumulator_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free accumulator: %d.",
+				 function,
+				 accumulator_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_disk_usage->accumulators );
+
+		internal_disk_usage->accumulators = NULL;
+	}
+	internal_disk_usage->number_of_accumulators = 0;
+
+	if( internal_disk_usage->records != NULL )
+	{
+		for( record_index = 0;
+		     record_index < internal_disk_usage->number_of_records;
+		     record_index++ )
+		{
+			if( internal_disk_usage->records[ record_index ].path != NULL )
+			{
+				memory_free(
+				 internal_disk_usage->records[ record_index ].path );
+			}
+		}
+		memory_free(
+		 internal_disk_usage->records );
+
+		internal_disk_usage->records = NULL;
+	}
+	internal_disk_usage->number_of_records = 0;
+
+	return( result );
+}
+
+/* Merges the records of the accumulators
+ * The records are sorted in pre-order and the records of the same directory,
+ * which are read by different threads, are combined. Files with multiple links
+ * are counted once, in the first directory in pre-order that contains a link.
+ * The values of every directory are then added to its parent directory in reverse order
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_disk_usage_merge(
+     libcdirectory_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error )
+{
+	libcdirectory_disk_usage_accumulator_t *accumulator = NULL;
+	libcdirectory_disk_usage_hard_link_t *hard_links    = NULL;
+	libcdirectory_disk_usage_record_t **sorted_records  = NULL;
+	libcdirectory_disk_usage_record_t *merged_record    = NULL;
+	libcdirectory_disk_usage_record_t *parent_record    = NULL;
+	libcdirectory_disk_usage_record_t *record           = NULL;
+	libcdirectory_inode_set_t *inode_set                = NULL;
+	static char *function                               = "libcdirectory_internal_disk_usage_merge";
+	int *directory_indexes                              = NULL;
+	int accumulator_index                               = 0;
+	int depth                                           = 0;
+	int hard_link_index                                 = 0;
+	int maximum_depth                                   = 0;
+	int number_of_hard_links                            = 0;
+	int number_of_records                               = 0;
+	int record_index                                    = 0;
+	int result                                          = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_disk_usage->records != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid disk usage - records value already set.",
+		 function );
+
+		return( -1 );
+	}
+	for( accumulator_index = 0;
+	     accumulator_index < internal_disk_usage->number_of_accumulators;
+	     accumulator_index++ )
+	{
+		accumulator = &( internal_disk_usage->accumulators[ accumulator_index ] );
+
+		if( ( accumulator->number_of_records > ( INT_MAX - number_of_records ) )
+		 || ( accumulator->number_of_hard_links > ( INT_MAX - number_of_hard_links ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid accumulator: %d - number of values out of bounds.",
+			 function,
+			 accumulator_index );
+
+			return( -1 );
+		}
+		number_of_records    += accumulator->number_of_records;
+		number_of_hard_links += accumulator->number_of_hard_links;
+	}
+	if( number_of_records == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing records.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcdirectory_disk_usage_record_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sorted_records = (libcdirectory_disk_usage_record_t **) memory_allocate(
+	                                                         sizeof( libcdirectory_disk_usage_record_t * ) * number_of_records );
+
+	if( sorted_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted records.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_records = 0;
+
+	for( accumulator_index = 0;
+	     accumulator_index < internal_disk_usage->number_of_accumulators;
+	     accumulator_index++ )
+	{
+		accumulator = &( internal_disk_usage->accumulators[ accumulator_index ] );
+
+		for( record_index = 0;
+		     record_index < accumulator->number_of_records;
+		     record_index++ )
+		{
+			sorted_records[ number_of_records++ ] = &( accumulator->records[ record_index ] );
+		}
+	}
+	qsort(
+	 sorted_records,
+	 (size_t) number_of_records,
+	 sizeof( libcdirectory_disk_usage_record_t * ),
+	 &libcdirectory_disk_usage_record_compare );
+
+	internal_disk_usage->records = (libcdirectory_disk_usage_record_t *) memory_allocate(
+	                                                                      sizeof( libcdirectory_disk_usage_record_t ) * number_of_records );
+
+	if( internal_disk_usage->records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records.",
+		 function );
+
+		goto on_error;
+	}
+	/* Combine the records with the same path, the merged record takes over the path
+	 * of the first record
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		record = sorted_records[ record_index ];
+
+		if( ( merged_record != NULL )
+		 && ( libcdirectory_disk_usage_record_compare(
+		       &merged_record,
+		       &record ) == 0 ) )
+		{
+			merged_record->apparent_size         += record->apparent_size;
+			merged_record->allocated_size        += record->allocated_size;
+			merged_record->number_of_files       += record->number_of_files;
+			merged_record->number_of_directories += record->number_of_directories;
+
+			memory_free(
+			 record->path );
+		}
+		else
+		{
+			merged_record = &( internal_disk_usage->records[ internal_disk_usage->number_of_records ] );
+
+			*merged_record = *record;
+
+			internal_disk_usage->number_of_records += 1;
+
+			if( merged_record->depth > maximum_depth )
+			{
+				maximum_depth = merged_record->depth;
+			}
+		}
+		record->path         = NULL;
+		record->merged_index = internal_disk_usage->number_of_records - 1;
+	}
+	memory_free(
+	 sorted_records );
+
+	sorted_records = NULL;
+
+	if( ( internal_disk_usage->records[ 0 ].path_length != 0 )
+	 || ( internal_disk_usage->records[ 0 ].depth != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing walked directory record.",
+		 function );
+
+		goto on_error;
+	}
+	/* Count every file with multiple links once, the hard links are sorted
+	 * by merged record index so that the first directory in pre-order counts
+	 * the file, regardless of the thread that read the directory
+	 */
+	if( number_of_hard_links > 0 )
+	{
+		if( (size_t) number_of_hard_links > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcdirectory_disk_usage_hard_link_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of hard links value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		hard_links = (libcdirectory_disk_usage_hard_link_t *) memory_allocate(
+		                                                       sizeof( libcdirectory_disk_usage_hard_link_t ) * number_of_hard_links );
+
+		if( hard_links == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hard links.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_hard_links = 0;
+
+		for( accumulator_index = 0;
+		     accumulator_index < internal_disk_usage->number_of_accumulators;
+		     accumulator_index++ )
+		{
+			accumulator = &( internal_disk_usage->accumulators[ accumulator_index ] );
+
+			for( hard_link_index = 0;
+			     hard_link_index < accumulator->number_of_hard_links;
+			     hard_link_index++ )
+			{
+				hard_links[ number_of_hard_links ] = accumulator->hard_links[ hard_link_index ];
+
+				record_index = hard_links[ number_of_hard_links ].record_index;
+
+				hard_links[ number_of_hard_links ].record_index = accumulator->records[ record_index ].merged_index;
+
+				number_of_hard_links++;
+			}
+		}
+		qsort(
+		 hard_links,
+		 (size_t) number_of_hard_links,
+		 sizeof( libcdirectory_disk_usage_hard_link_t ),
+		 &libcdirectory_disk_usage_hard_link_compare );
+
+		if( libcdirectory_inode_set_initialize(
+		     &inode_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode set.",
+			 function );
+
+			goto on_error;
+		}
+		for( hard_link_index = 0;
+		     hard_link_index < number_of_hard_links;
+		     hard_link_index++ )
+		{
+			result = libcdirectory_inode_set_insert(
+			          inode_set,
+			          hard_links[ hard_link_index ].device_number,
+			          hard_links[ hard_link_index ].inode_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert hard link into inode set.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				record = &( internal_disk_usage->records[ hard_links[ hard_link_index ].record_index ] );
+
+				record->apparent_size   += hard_links[ hard_link_index ].apparent_size;
+				record->allocated_size  += hard_links[ hard_link_index ].allocated_size;
+				record->number_of_files += 1;
+			}
+		}
+		if( libcdirectory_inode_set_free(
+		     &inode_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode set.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 hard_links );
+
+		hard_links = NULL;
+	}
+	/* Determine the parent of every directory, since the records are in pre-order
+	 * the parent is the last directory read at the preceding depth
+	 */
+	directory_indexes = (int *) memory_allocate(
+	                             sizeof( int ) * ( maximum_depth + 1 ) );
+
+	if( directory_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory indexes.",
+		 function );
+
+		goto on_error;
+	}
+	directory_indexes[ 0 ] = 0;
+
+	internal_disk_usage->records[ 0 ].parent_index = -1;
+
+	depth = 0;
+
+	for( record_index = 1;
+	     record_index < internal_disk_usage->number_of_records;
+	     record_index++ )
+	{
+		record = &( internal_disk_usage->records[ record_index ] );
+
+		if( ( record->depth <= 0 )
+		 || ( record->depth > ( depth + 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %d - depth value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		depth = record->depth;
+
+		directory_indexes[ depth ] = record_index;
+
+		record->parent_index = directory_indexes[ depth - 1 ];
+	}
+	memory_free(
+	 directory_indexes );
+
+	directory_indexes = NULL;
+
+	/* Add the values of every directory to its parent, descendants are processed
+	 * before their ancestors when the records are traversed in reverse order
+	 */
+	for( record_index = internal_disk_usage->number_of_records - 1;
+	     record_index > 0;
+	     record_index-- )
+	{
+		record        = &( internal_disk_usage->records[ record_index ] );
+		parent_record = &( internal_disk_usage->records[ record->parent_index ] );
+
+		parent_record->apparent_size         += record->apparent_size;
+		parent_record->allocated_size        += record->allocated_size;
+		parent_record->number_of_files       += record->number_of_files;
+		parent_record->number_of_directories += record->number_of_directories;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_indexes != NULL )
+	{
+		memory_free(
+		 directory_indexes );
+	}
+	if( inode_set != NULL )
+	{
+		libcdirectory_inode_set_free(
+		 &inode_set,
+		 NULL );
+	}
+	if( hard_links != NULL )
+	{
+		memory_free(
+		 hard_links );
+	}
+	if( sorted_records != NULL )
+	{
+		memory_free(
+		 sorted_records );
+	}
+	return( -1 );
+}
+
+/* Calculates the disk usage of a directory tree
+ * The directory tree is walked by the parallel walker, where every thread adds
+ * the entries it reads to its own accumulator. The accumulators are merged after the walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_calculate(
+     libcdirectory_disk_usage_t *disk_usage,
+     libcdirectory_parallel_walker_t *parallel_walker,
+     const char *path,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H )
+	struct stat file_statistics;
+#endif
+
+	libcdirectory_internal_disk_usage_t *internal_disk_usage           = NULL;
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_disk_usage_calculate";
+	int accumulator_index                                              = 0;
+	int record_index                                                   = 0;
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libcdirectory_internal_disk_usage_t *) disk_usage;
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_disk_usage_clear(
+	     internal_disk_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage->accumulators = (libcdirectory_disk_usage_accumulator_t *) memory_allocate(
+	                                                                                sizeof( libcdirectory_disk_usage_accumulator_t ) * internal_parallel_walker->number_of_threads );
+
+	if( internal_disk_usage->accumulators == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create accumulators.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_disk_usage->accumulators,
+	     0,
+	     sizeof( libcdirectory_disk_usage_accumulator_t ) * internal_parallel_walker->number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear accumulators.",
+		 function );
+
+		memory_free(
+		 internal_disk_usage->accumulators );
+
+		internal_disk_usage->accumulators = NULL;
+
+		goto on_error;
+	}
+	internal_disk_usage->number_of_accumulators = internal_parallel_walker->number_of_threads;
+
+	for( accumulator_index = 0;
+	     accumulator_index < internal_disk_usage->number_of_accumulators;
+	     accumulator_index++ )
+	{
+		internal_disk_usage->accumulators[ accumulator_index ].current_record_index = -1;
+	}
+	/* The walked directory contributes its own size, since it is not reported by the walk
+	 */
+	if( libcdirectory_disk_usage_accumulator_append_record(
+	     &( internal_disk_usage->accumulators[ 0 ] ),
+	     "",
+	     0,
+	     0,
+	     &record_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append walked directory record.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H )
+	if( stat(
+	     path,
+	     &file_statistics ) == 0 )
+	{
+		internal_disk_usage->accumulators[ 0 ].records[ record_index ].apparent_size  = (uint64_t) file_statistics.st_size;
+		internal_disk_usage->accumulators[ 0 ].records[ record_index ].allocated_size = (uint64_t) file_statistics.st_blocks * 512;
+	}
+#endif
+	if( libcdirectory_parallel_walker_walk(
+	     parallel_walker,
+	     path,
+	     &libcdirectory_disk_usage_walk_callback,
+	     (void *) internal_disk_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_internal_disk_usage_merge(
+	     internal_disk_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to merge records.",
+		 function );
+
+		goto on_error;
+	}
+	/* The accumulators are no longer needed since the merged records took over the paths
+	 */
+	for( accumulator_index = 0;
+	     accumulator_index < internal_disk_usage->number_of_accumulators;
+	     accumulator_index++ )
+	{
+		if( libcdirectory_disk_usage_accumulator_free(
+		     &( internal_disk_usage->accumulators[ accumulator_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free accumulator: %d.",
+			 function,
+			 accumulator_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 internal_disk_usage->accumulators );
+
+	internal_disk_usage->accumulators           = NULL;
+	internal_disk_usage->number_of_accumulators = 0;
+
+	return( 1 );
+
+on_error:
+	libcdirectory_internal_disk_usage_clear(
+	 internal_disk_usage,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of directories
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_get_number_of_directories(
+     libcdirectory_disk_usage_t *disk_usage,
+     int *number_of_directories,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                    = "libcdirectory_disk_usage_get_number_of_directories";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libcdirectory_internal_disk_usage_t *) disk_usage;
+
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directories = internal_disk_usage->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the relative path of a specific directory
+ * The directories are stored in pre-order, where the walked directory has index 0 and an empty path
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_get_directory_path(
+     libcdirectory_disk_usage_t *disk_usage,
+     int directory_index,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                    = "libcdirectory_disk_usage_get_directory_path";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libcdirectory_internal_disk_usage_t *) disk_usage;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_disk_usage->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	*path        = internal_disk_usage->records[ directory_index ].path;
+	*path_length = internal_disk_usage->records[ directory_index ].path_length;
+
+	return( 1 );
+}
+
+/* Retrieves the values of a specific directory
+ * The values contain the directory itself and all its descendants, where the number of
+ * directories does not include the directory itself and files with multiple links are counted once
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_disk_usage_get_directory_values(
+     libcdirectory_disk_usage_t *disk_usage,
+     int directory_index,
+     uint64_t *apparent_size,
+     uint64_t *allocated_size,
+     uint64_t *number_of_files,
+     uint64_t *number_of_directories,
+     libcerror_error_t **error )
+{
+	libcdirectory_disk_usage_record_t *record                = NULL;
+	libcdirectory_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                    = "libcdirectory_disk_usage_get_directory_values";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libcdirectory_internal_disk_usage_t *) disk_usage;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_disk_usage->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( apparent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid apparent size.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	record = &( internal_disk_usage->records[ directory_index ] );
+
+	*apparent_size         = record->apparent_size;
+	*allocated_size        = record->allocated_size;
+	*number_of_files       = record->number_of_files;
+	*number_of_directories = record->number_of_directories;
+
+	return( 1 );
+}
+
@@ -0,0 +1,263 @@
+/*
+ * Disk usage functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_DISK_USAGE_H )
+#define _LIBCDIRECTORY_DISK_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_extern.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of records and hard links of an accumulator
+ */
+#define LIBCDIRECTORY_DISK_USAGE_INITIAL_NUMBER_OF_RECORDS		64
+#define LIBCDIRECTORY_DISK_USAGE_INITIAL_NUMBER_OF_HARD_LINKS		64
+
+/* The file statistics that are read for every entry
+ */
+#define LIBCDIRECTORY_DISK_USAGE_FILE_STATISTICS_FLAGS \
+	( LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE | LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_BLOCKS \
+	| LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER | LIBCDIRECTORY_FILE_STATISTICS_FLAG_DEVICE_NUMBER \
+	| LIBCDIRECTORY_FILE_STATISTICS_FLAG_NUMBER_OF_LINKS )
+
+typedef struct libcdirectory_disk_usage_record libcdirectory_disk_usage_record_t;
+
+struct libcdirectory_disk_usage_record
+{
+	/* The relative path of the directory, where the walked directory has an empty path
+	 */
+	char *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The depth of the directory, where the walked directory has depth 0
+	 */
+	int depth;
+
+	/* The index of the merged record
+	 */
+	int merged_index;
+
+	/* The index of the merged record of the parent directory
+	 */
+	int parent_index;
+
+	/* The apparent size
+	 */
+	uint64_t apparent_size;
+
+	/* The allocated size
+	 */
+	uint64_t allocated_size;
+
+	/* The number of files
+	 */
+	uint64_t number_of_files;
+
+	/* The number of directories
+	 */
+	uint64_t number_of_directories;
+};
+
+typedef struct libcdirectory_disk_usage_hard_link libcdirectory_disk_usage_hard_link_t;
+
+struct libcdirectory_disk_usage_hard_link
+{
+	/* The device number
+	 */
+	uint64_t device_number;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The apparent size
+	 */
+	uint64_t apparent_size;
+
+	/* The allocated size
+	 */
+	uint64_t allocated_size;
+
+	/* The index of the record of the directory that contains the hard link
+	 */
+	int record_index;
+};
+
+typedef struct libcdirectory_disk_usage_accumulator libcdirectory_disk_usage_accumulator_t;
+
+/* An accumulator contains the records read by a single thread
+ */
+struct libcdirectory_disk_usage_accumulator
+{
+	/* The records
+	 */
+	libcdirectory_disk_usage_record_t *records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of allocated records
+	 */
+	int number_of_allocated_records;
+
+	/* The index of the record of the directory whose entries are read, where -1 represents none
+	 */
+	int current_record_index;
+
+	/* The hard links, which are files with more than 1 link
+	 */
+	libcdirectory_disk_usage_hard_link_t *hard_links;
+
+	/* The number of hard links
+	 */
+	int number_of_hard_links;
+
+	/* The number of allocated hard links
+	 */
+	int number_of_allocated_hard_links;
+};
+
+typedef struct libcdirectory_internal_disk_usage libcdirectory_internal_disk_usage_t;
+
+struct libcdirectory_internal_disk_usage
+{
+	/* The merged records, which are stored in pre-order
+	 */
+	libcdirectory_disk_usage_record_t *records;
+
+	/* The number of merged records
+	 */
+	int number_of_records;
+
+	/* The accumulators of a calculation, one per thread
+	 */
+	libcdirectory_disk_usage_accumulator_t *accumulators;
+
+	/* The number of accumulators
+	 */
+	int number_of_accumulators;
+};
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_disk_usage_initialize(
+     libcdirectory_disk_usage_t **disk_usage,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_disk_usage_free(
+     libcdirectory_disk_usage_t **disk_usage,
+     libcerror_error_t **error );
+
+int libcdirectory_disk_usage_accumulator_free(
+     libcdirectory_disk_usage_accumulator_t *accumulator,
+     libcerror_error_t **error );
+
+int libcdirectory_disk_usage_accumulator_append_record(
+     libcdirectory_disk_usage_accumulator_t *accumulator,
+     const char *path,
+     size_t path_length,
+     int depth,
+     int *record_index,
+     libcerror_error_t **error );
+
+int libcdirectory_disk_usage_accumulator_append_hard_link(
+     libcdirectory_disk_usage_accumulator_t *accumulator,
+     uint64_t device_number,
+     uint64_t inode_number,
+     uint64_t apparent_size,
+     uint64_t allocated_size,
+     int record_index,
+     libcerror_error_t **error );
+
+int libcdirectory_disk_usage_walk_callback(
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *path,
+     size_t path_length,
+     int depth,
+     int thread_index,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libcdirectory_disk_usage_record_compare(
+     const void *first_record,
+     const void *second_record );
+
+int libcdirectory_disk_usage_hard_link_compare(
+     const void *first_hard_link,
+     const void *second_hard_link );
+
+int libcdirectory_internal_disk_usage_clear(
+     libcdirectory_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_disk_usage_merge(
+     libcdirectory_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_disk_usage_calculate(
+     libcdirectory_disk_usage_t *disk_usage,
+     libcdirectory_parallel_walker_t *parallel_walker,
+     const char *path,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_disk_usage_get_number_of_directories(
+     libcdirectory_disk_usage_t *disk_usage,
+     int *number_of_directories,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_disk_usage_get_directory_path(
+     libcdirectory_disk_usage_t *disk_usage,
+     int directory_index,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_disk_usage_get_directory_values(
+     libcdirectory_disk_usage_t *disk_usage,
+     int directory_index,
+     uint64_t *apparent_size,
+     uint64_t *allocated_size,
+     uint64_t *number_of_files,
+     uint64_t *number_of_directories,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_DISK_USAGE_H ) */
+
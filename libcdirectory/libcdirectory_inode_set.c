@@ -0,0 +1,397 @@
+/*
+ * Inode set functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdirectory_inode_set.h"
+#include "libcdirectory_libcerror.h"
+
+/* Creates an inode set
+ * Make sure the value inode_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_inode_set_initialize(
+     libcdirectory_inode_set_t **inode_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_inode_set_initialize";
+
+	if( inode_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_set = memory_allocate_structure(
+	              libcdirectory_inode_set_t );
+
+	if( *inode_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_set,
+	     0,
+	     sizeof( libcdirectory_inode_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_set != NULL )
+	{
+		memory_free(
+		 *inode_set );
+
+		*inode_set = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode set
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_inode_set_free(
+     libcdirectory_inode_set_t **inode_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_inode_set_free";
+
+	if( inode_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_set != NULL )
+	{
+		if( ( *inode_set )->slots != NULL )
+		{
+			memory_free(
+			 ( *inode_set )->slots );
+		}
+		memory_free(
+		 *inode_set );
+
+		*inode_set = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties an inode set
+ * The allocated slots are retained to be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_inode_set_empty(
+     libcdirectory_inode_set_t *inode_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_inode_set_empty";
+
+	if( inode_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_set->slots != NULL )
+	 && ( inode_set->number_of_values > 0 ) )
+	{
+		if( memory_set(
+		     inode_set->slots,
+		     0,
+		     sizeof( libcdirectory_inode_set_slot_t ) * (size_t) inode_set->number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	inode_set->number_of_values = 0;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a device and inode number
+ * The hash combines both values and applies the MurmurHash3 finalizer,
+ * since inode numbers are often sequential
+ * Returns the hash
+ */
+uint64_t libcdirectory_inode_set_calculate_hash(
+          uint64_t device_number,
+          uint64_t inode_number )
+{
+	uint64_t hash = inode_number ^ ( device_number * 0x9e3779b97f4a7c15ULL );
+
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	return( hash );
+}
+
+/* Resizes an inode set
+ * The values are reinserted into the resized slots
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_inode_set_resize(
+     libcdirectory_inode_set_t *inode_set,
+     uint64_t number_of_slots,
+     libcerror_error_t **error )
+{
+	libcdirectory_inode_set_slot_t *slots = NULL;
+	static char *function                 = "libcdirectory_inode_set_resize";
+	uint64_t slot_index                   = 0;
+	uint64_t slot_mask                    = 0;
+	uint64_t source_slot_index            = 0;
+
+	if( inode_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots < LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( number_of_slots <= inode_set->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcdirectory_inode_set_slot_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (libcdirectory_inode_set_slot_t *) memory_allocate(
+	                                            sizeof( libcdirectory_inode_set_slot_t ) * (size_t) number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( libcdirectory_inode_set_slot_t ) * (size_t) number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	slot_mask = number_of_slots - 1;
+
+	for( source_slot_index = 0;
+	     source_slot_index < inode_set->number_of_slots;
+	     source_slot_index++ )
+	{
+		if( inode_set->slots[ source_slot_index ].inode_number == 0 )
+		{
+			continue;
+		}
+		slot_index = libcdirectory_inode_set_calculate_hash(
+		              inode_set->slots[ source_slot_index ].device_number,
+		              inode_set->slots[ source_slot_index ].inode_number ) & slot_mask;
+
+		while( slots[ slot_index ].inode_number != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & slot_mask;
+		}
+		slots[ slot_index ] = inode_set->slots[ source_slot_index ];
+	}
+	if( inode_set->slots != NULL )
+	{
+		memory_free(
+		 inode_set->slots );
+	}
+	inode_set->slots           = slots;
+	inode_set->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Inserts a device and inode number into an inode set
+ * The inode set is resized when more than half of the slots are used
+ * An inode number of 0 is not considered a valid inode number and is never contained
+ * Returns 1 if inserted, 0 if already contained or -1 on error
+ */
+int libcdirectory_inode_set_insert(
+     libcdirectory_inode_set_t *inode_set,
+     uint64_t device_number,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libcdirectory_inode_set_slot_t *slot = NULL;
+	static char *function                = "libcdirectory_inode_set_insert";
+	uint64_t number_of_slots             = 0;
+	uint64_t slot_index                  = 0;
+	uint64_t slot_mask                   = 0;
+
+	if( inode_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode set.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == 0 )
+	{
+		return( 1 );
+	}
+	if( ( inode_set->number_of_values + 1 ) > ( inode_set->number_of_slots / 2 ) )
+	{
+		if( inode_set->number_of_slots == 0 )
+		{
+			number_of_slots = LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS;
+		}
+		else
+		{
+			number_of_slots = inode_set->number_of_slots * 2;
+		}
+		if( libcdirectory_inode_set_resize(
+		     inode_set,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize inode set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	slot_mask  = inode_set->number_of_slots - 1;
+	slot_index = libcdirectory_inode_set_calculate_hash(
+	              device_number,
+	              inode_number ) & slot_mask;
+
+	while( 1 )
+	{
+		slot = &( inode_set->slots[ slot_index ] );
+
+		if( slot->inode_number == 0 )
+		{
+			break;
+		}
+		if( ( slot->inode_number == inode_number )
+		 && ( slot->device_number == device_number ) )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & slot_mask;
+	}
+	slot->device_number = device_number;
+	slot->inode_number  = inode_number;
+
+	inode_set->number_of_values += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Inode set functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_INODE_SET_H )
+#define _LIBCDIRECTORY_INODE_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of slots
+ */
+#define LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS		256
+
+typedef struct libcdirectory_inode_set_slot libcdirectory_inode_set_slot_t;
+
+struct libcdirectory_inode_set_slot
+{
+	/* The device number
+	 */
+	uint64_t device_number;
+
+	/* The inode number, where 0 represents an unused slot
+	 */
+	uint64_t inode_number;
+};
+
+typedef struct libcdirectory_inode_set libcdirectory_inode_set_t;
+
+/* An inode set contains (device number, inode number) pairs in an open addressing
+ * hash table with linear probing
+ */
+struct libcdirectory_inode_set
+{
+	/* The slots
+	 */
+	libcdirectory_inode_set_slot_t *slots;
+
+	/* The number of slots, which is a power of 2
+	 */
+	uint64_t number_of_slots;
+
+	/* The number of values
+	 */
+	uint64_t number_of_values;
+};
+
+int libcdirectory_inode_set_initialize(
+     libcdirectory_inode_set_t **inode_set,
+     libcerror_error_t **error );
+
+int libcdirectory_inode_set_free(
+     libcdirectory_inode_set_t **inode_set,
+     libcerror_error_t **error );
+
+int libcdirectory_inode_set_empty(
+     libcdirectory_inode_set_t *inode_set,
+     libcerror_error_t **error );
+
+uint64_t libcdirectory_inode_set_calculate_hash(
+          uint64_t device_number,
+          uint64_t inode_number );
+
+int libcdirectory_inode_set_resize(
+     libcdirectory_inode_set_t *inode_set,
+     uint64_t number_of_slots,
+     libcerror_error_t **error );
+
+int libcdirectory_inode_set_insert(
+     libcdirectory_inode_set_t *inode_set,
+     uint64_t device_number,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_INODE_SET_H ) */
+
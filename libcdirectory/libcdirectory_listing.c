@@ -0,0 +1,522 @@
+/*
+ * Listing functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_listing.h"
+
+/* Creates a listing
+ * Make sure the value listing is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_listing_initialize(
+     libcdirectory_listing_t **listing,
+     const char *path,
+     size_t path_length,
+     int depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_listing_initialize";
+
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *listing != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid listing value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path == NULL )
+	 && ( path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*listing = memory_allocate_structure(
+	            libcdirectory_listing_t );
+
+	if( *listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create listing.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *listing,
+	     0,
+	     sizeof( libcdirectory_listing_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear listing.",
+		 function );
+
+		memory_free(
+		 *listing );
+
+		*listing = NULL;
+
+		return( -1 );
+	}
+	( *listing )->path = (char *) memory_allocate(
+	                               sizeof( char ) * ( path_length + 1 ) );
+
+	if( ( *listing )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     ( *listing )->path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *listing )->path[ path_length ] = 0;
+
+	( *listing )->path_length = path_length;
+	( *listing )->depth       = depth;
+	( *listing )->state       = LIBCDIRECTORY_LISTING_STATE_QUEUED;
+
+	return( 1 );
+
+on_error:
+	if( *listing != NULL )
+	{
+		if( ( *listing )->path != NULL )
+		{
+			memory_free(
+			 ( *listing )->path );
+		}
+		memory_free(
+		 *listing );
+
+		*listing = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a listing
+ * The listings of the subdirectories are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_listing_free(
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_listing_free";
+
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *listing != NULL )
+	{
+		if( ( *listing )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *listing )->error ) );
+		}
+		if( ( *listing )->names != NULL )
+		{
+			memory_free(
+			 ( *listing )->names );
+		}
+		if( ( *listing )->entries != NULL )
+		{
+			memory_free(
+			 ( *listing )->entries );
+		}
+		if( ( *listing )->path != NULL )
+		{
+			memory_free(
+			 ( *listing )->path );
+		}
+		memory_free(
+		 *listing );
+
+		*listing = NULL;
+	}
+	return( 1 );
+}
+
+/* Frees a listing and the listings of its subdirectories
+ * The tree is freed without recursion, the parent listing and entry index
+ * of the listings are used to track the position in the tree
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_listing_free_tree(
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error )
+{
+	libcdirectory_listing_t *current_listing = NULL;
+	libcdirectory_listing_t *parent_listing  = NULL;
+	libcdirectory_listing_t *sub_listing     = NULL;
+	static char *function                    = "libcdirectory_listing_free_tree";
+	int result                               = 1;
+
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	current_listing = *listing;
+
+	if( current_listing != NULL )
+	{
+		current_listing->parent_listing = NULL;
+		current_listing->entry_index    = 0;
+	}
+	while( current_listing != NULL )
+	{
+		sub_listing = NULL;
+
+		while( current_listing->entry_index < current_listing->number_of_entries )
+		{
+			sub_listing = current_listing->entries[ current_listing->entry_index ].sub_listing;
+
+			current_listing->entries[ current_listing->entry_index ].sub_listing = NULL;
+			current_listing->entry_index                                         += 1;
+
+			if( sub_listing != NULL )
+			{
+				break;
+			}
+		}
+		if( sub_listing != NULL )
+		{
+			sub_listing->parent_listing = current_listing;
+			sub_listing->entry_index    = 0;
+
+			current_listing = sub_listing;
+
+			continue;
+		}
+		parent_listing = current_listing->parent_listing;
+
+		if( libcdirectory_listing_free(
+		     &current_listing,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free listing.",
+			 function );
+
+			result = -1;
+		}
+		current_listing = parent_listing;
+	}
+	*listing = NULL;
+
+	return( result );
+}
+
+/* Appends an entry to the listing
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_listing_append_entry(
+     libcdirectory_listing_t *listing,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint32_t attributes,
+     uint64_t inode_number,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_listing_entry_t *entries = NULL;
+	libcdirectory_listing_entry_t *entry   = NULL;
+	char *names                            = NULL;
+	static char *function                  = "libcdirectory_listing_append_entry";
+	size_t names_allocated_size            = 0;
+	int number_of_allocated_entries        = 0;
+
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( listing->names_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - name_length - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing->number_of_entries >= listing->number_of_allocated_entries )
+	{
+		if( listing->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBCDIRECTORY_LISTING_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else if( listing->number_of_allocated_entries > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_listing_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid listing - number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_entries = listing->number_of_allocated_entries * 2;
+		}
+		entries = (libcdirectory_listing_entry_t *) memory_reallocate(
+		                                             listing->entries,
+		                                             sizeof( libcdirectory_listing_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		listing->entries                     = entries;
+		listing->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( ( listing->names_size + name_length + 1 ) > listing->names_allocated_size )
+	{
+		names_allocated_size = listing->names_allocated_size;
+
+		if( names_allocated_size == 0 )
+		{
+			names_allocated_size = LIBCDIRECTORY_LISTING_INITIAL_NAMES_SIZE;
+		}
+		while( names_allocated_size < ( listing->names_size + name_length + 1 ) )
+		{
+			if( names_allocated_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				names_allocated_size = listing->names_size + name_length + 1;
+
+				break;
+			}
+			names_allocated_size *= 2;
+		}
+		names = (char *) memory_reallocate(
+		                  listing->names,
+		                  sizeof( char ) * names_allocated_size );
+
+		if( names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names.",
+			 function );
+
+			return( -1 );
+		}
+		listing->names                = names;
+		listing->names_allocated_size = names_allocated_size;
+	}
+	if( name_length > 0 )
+	{
+		if( memory_copy(
+		     &( listing->names[ listing->names_size ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	listing->names[ listing->names_size + name_length ] = 0;
+
+	entry = &( listing->entries[ listing->number_of_entries ] );
+
+	entry->name_offset  = listing->names_size;
+	entry->name_length  = name_length;
+	entry->attributes   = attributes;
+	entry->inode_number = inode_number;
+	entry->type         = type;
+	entry->sub_listing  = NULL;
+
+	listing->names_size += name_length + 1;
+
+	*entry_index = listing->number_of_entries;
+
+	listing->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the allocated size of the listing
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_listing_get_allocated_size(
+     libcdirectory_listing_t *listing,
+     size_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_listing_get_allocated_size";
+
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = sizeof( libcdirectory_listing_t )
+	                + ( sizeof( libcdirectory_listing_entry_t ) * (size_t) listing->number_of_allocated_entries )
+	                + listing->names_allocated_size
+	                + listing->path_length + 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,204 @@
+/*
+ * Listing functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_LISTING_H )
+#define _LIBCDIRECTORY_LISTING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of entries of a listing
+ */
+#define LIBCDIRECTORY_LISTING_INITIAL_NUMBER_OF_ENTRIES		64
+
+/* The initial size of the names of a listing
+ */
+#define LIBCDIRECTORY_LISTING_INITIAL_NAMES_SIZE		1024
+
+/* The listing states
+ */
+enum LIBCDIRECTORY_LISTING_STATES
+{
+	LIBCDIRECTORY_LISTING_STATE_QUEUED	= 0,
+	LIBCDIRECTORY_LISTING_STATE_READING	= 1,
+	LIBCDIRECTORY_LISTING_STATE_READ	= 2,
+	LIBCDIRECTORY_LISTING_STATE_FAILED	= 3,
+	LIBCDIRECTORY_LISTING_STATE_REUSED	= 4
+};
+
+typedef struct libcdirectory_listing libcdirectory_listing_t;
+
+typedef struct libcdirectory_listing_entry libcdirectory_listing_entry_t;
+
+struct libcdirectory_listing_entry
+{
+	/* The offset of the name in the names
+	 */
+	size_t name_offset;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The attributes, as retained by a detached directory entry
+	 */
+	uint32_t attributes;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The listing of the subdirectory or NULL if not available
+	 */
+	libcdirectory_listing_t *sub_listing;
+};
+
+/* A listing contains the entries of a directory that were read before they are used
+ */
+struct libcdirectory_listing
+{
+	/* The relative path of the directory
+	 */
+	char *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The depth of the directory, where the walked directory has depth 0
+	 */
+	int depth;
+
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The size of the listing that is accounted for in the buffered size of a parallel walker
+	 */
+	size_t buffered_size;
+
+	/* The device number of the directory, as retained by a tree state
+	 */
+	uint64_t device_number;
+
+	/* The inode number of the directory, as retained by a tree state
+	 */
+	uint64_t inode_number;
+
+	/* The modification time of the directory, as retained by a tree state
+	 */
+	int64_t modification_time;
+
+	/* The inode change time of the directory, as retained by a tree state
+	 */
+	int64_t inode_change_time;
+
+	/* The previous listing in the queue
+	 */
+	libcdirectory_listing_t *previous_listing;
+
+	/* The next listing in the queue
+	 */
+	libcdirectory_listing_t *next_listing;
+
+	/* The parent listing, which is set while the entries are passed to the callback
+	 */
+	libcdirectory_listing_t *parent_listing;
+
+	/* The entries
+	 */
+	libcdirectory_listing_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The index of the next entry to pass to the callback
+	 */
+	int entry_index;
+
+	/* The names of the entries, which are stored with an end-of-string character
+	 */
+	char *names;
+
+	/* The size of the names that is used
+	 */
+	size_t names_size;
+
+	/* The size of the names that is allocated
+	 */
+	size_t names_allocated_size;
+
+	/* The error when the listing could not be read
+	 */
+	libcerror_error_t *error;
+};
+
+int libcdirectory_listing_initialize(
+     libcdirectory_listing_t **listing,
+     const char *path,
+     size_t path_length,
+     int depth,
+     libcerror_error_t **error );
+
+int libcdirectory_listing_free(
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error );
+
+int libcdirectory_listing_free_tree(
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error );
+
+int libcdirectory_listing_append_entry(
+     libcdirectory_listing_t *listing,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint32_t attributes,
+     uint64_t inode_number,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcdirectory_listing_get_allocated_size(
+     libcdirectory_listing_t *listing,
+     size_t *allocated_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_LISTING_H ) */
+
@@ -0,0 +1,1197 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcdirectory_case_folding.h"
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_libclocale.h"
+#include "libcdirectory_libuna.h"
+#include "libcdirectory_name_index.h"
+
+/* The minimum number of buckets
+ */
+#define LIBCDIRECTORY_NAME_INDEX_MINIMUM_NUMBER_OF_BUCKETS	16
+
+/* Creates a name index
+ * Make sure the value name_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_initialize(
+     libcdirectory_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_name_index_initialize";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*name_index = memory_allocate_structure(
+	               libcdirectory_name_index_t );
+
+	if( *name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_index,
+	     0,
+	     sizeof( libcdirectory_name_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *name_index != NULL )
+	{
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name index
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_free(
+     libcdirectory_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_name_index_free";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		if( ( *name_index )->case_folded_buckets != NULL )
+		{
+			memory_free(
+			 ( *name_index )->case_folded_buckets );
+		}
+		if( ( *name_index )->buckets != NULL )
+		{
+			memory_free(
+			 ( *name_index )->buckets );
+		}
+		if( ( *name_index )->lookup_key != NULL )
+		{
+			memory_free(
+			 ( *name_index )->lookup_key );
+		}
+		if( ( *name_index )->case_folded_key_data != NULL )
+		{
+			memory_free(
+			 ( *name_index )->case_folded_key_data );
+		}
+		if( ( *name_index )->name_data != NULL )
+		{
+			memory_free(
+			 ( *name_index )->name_data );
+		}
+		if( ( *name_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *name_index )->entries );
+		}
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a name index
+ * The allocated entries and name data are retained to be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_empty(
+     libcdirectory_name_index_t *name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_name_index_empty";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->case_folded_buckets != NULL )
+	{
+		memory_free(
+		 name_index->case_folded_buckets );
+
+		name_index->case_folded_buckets = NULL;
+	}
+	if( name_index->buckets != NULL )
+	{
+		memory_free(
+		 name_index->buckets );
+
+		name_index->buckets = NULL;
+	}
+	name_index->number_of_buckets           = 0;
+	name_index->number_of_entries           = 0;
+	name_index->name_data_size              = 0;
+	name_index->case_folded_key_data_length = 0;
+	name_index->lookup_key_length           = 0;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a name
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash
+ * Returns the hash
+ */
+uint32_t libcdirectory_name_index_calculate_hash(
+          const char *name,
+          size_t name_length )
+{
+	size_t name_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		hash ^= (uint8_t) name[ name_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Calculates the hash of a case folded key
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash of the Unicode characters
+ * Returns the hash
+ */
+uint32_t libcdirectory_name_index_calculate_case_folded_key_hash(
+          const libuna_unicode_character_t *case_folded_key,
+          size_t case_folded_key_length )
+{
+	size_t key_index = 0;
+	uint32_t hash    = 0x811c9dc5UL;
+
+	for( key_index = 0;
+	     key_index < case_folded_key_length;
+	     key_index++ )
+	{
+		hash ^= (uint32_t) case_folded_key[ key_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Determines the case folded key of a name
+ * The name is decoded using the narrow system string codepage and every Unicode
+ * character is replaced by its simple case folding. A byte that cannot be decoded
+ * is stored as an unpaired low surrogate (0xdc00 + byte value) so that it only
+ * matches the same byte
+ * The case folded key size must be at least the name length
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_get_case_folded_key(
+     const char *name,
+     size_t name_length,
+     libuna_unicode_character_t *case_folded_key,
+     size_t case_folded_key_size,
+     size_t *case_folded_key_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcdirectory_name_index_get_case_folded_key";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_index                       = 0;
+	size_t key_index                             = 0;
+	size_t name_index                            = 0;
+	int result                                   = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded key.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_key_size < name_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid case folded key size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_key_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded key length.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < name_length )
+	{
+		character_index   = name_index;
+		unicode_character = (uint8_t) name[ name_index ];
+
+		if( unicode_character < 0x00000080UL )
+		{
+			name_index++;
+		}
+		else
+		{
+			if( libclocale_codepage == 0 )
+			{
+				result = libuna_unicode_character_copy_from_utf8(
+				          &unicode_character,
+				          (const libuna_utf8_character_t *) name,
+				          name_length,
+				          &name_index,
+				          NULL );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &unicode_character,
+				          (const uint8_t *) name,
+				          name_length,
+				          &name_index,
+				          libclocale_codepage,
+				          NULL );
+			}
+			/* An invalid character can be decoded as the replacement character
+			 */
+			if( ( result != 1 )
+			 || ( name_index <= character_index )
+			 || ( ( unicode_character == 0x0000fffdUL )
+			  && ( ( libclocale_codepage != 0 )
+			   || ( ( name_index - character_index ) != 3 )
+			   || ( narrow_string_compare(
+			         &( name[ character_index ] ),
+			         "\xef\xbf\xbd",
+			         3 ) != 0 ) ) ) )
+			{
+				unicode_character = 0x0000dc00UL + (uint8_t) name[ character_index ];
+				name_index        = character_index + 1;
+			}
+		}
+		case_folded_key[ key_index++ ] = libcdirectory_case_folding_get_character(
+		                                  unicode_character );
+	}
+	*case_folded_key_length = key_index;
+
+	return( 1 );
+}
+
+/* Resizes an Unicode character buffer
+ * The buffer is at least doubled in size when it is resized
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_resize_unicode_buffer(
+     libuna_unicode_character_t **buffer,
+     size_t *allocated_buffer_length,
+     size_t buffer_length,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t *resized_buffer = NULL;
+	static char *function                      = "libcdirectory_name_index_resize_unicode_buffer";
+	size_t resized_buffer_length               = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_buffer_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated buffer length.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *buffer != NULL )
+	 && ( buffer_length <= *allocated_buffer_length ) )
+	{
+		return( 1 );
+	}
+	resized_buffer_length = *allocated_buffer_length * 2;
+
+	if( resized_buffer_length < 1024 )
+	{
+		resized_buffer_length = 1024;
+	}
+	if( resized_buffer_length < buffer_length )
+	{
+		resized_buffer_length = buffer_length;
+	}
+	resized_buffer = (libuna_unicode_character_t *) memory_reallocate(
+	                                                 *buffer,
+	                                                 sizeof( libuna_unicode_character_t ) * resized_buffer_length );
+
+	if( resized_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer                  = resized_buffer;
+	*allocated_buffer_length = resized_buffer_length;
+
+	return( 1 );
+}
+
+/* Appends an entry to the name index
+ * The hash buckets are not updated until the name index is build
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_append_entry(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint16_t file_mode,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libcdirectory_name_index_entry_t *entries = NULL;
+	libcdirectory_name_index_entry_t *entry   = NULL;
+	char *name_data                           = NULL;
+	static char *function                     = "libcdirectory_name_index_append_entry";
+	size_t allocated_name_data_size           = 0;
+	int number_of_allocated_entries           = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->number_of_entries >= name_index->number_of_allocated_entries )
+	{
+		if( name_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( name_index->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name index - number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_entries = name_index->number_of_allocated_entries * 2;
+		}
+		if( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcdirectory_name_index_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libcdirectory_name_index_entry_t *) memory_reallocate(
+		                                                name_index->entries,
+		                                                sizeof( libcdirectory_name_index_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		name_index->entries                     = entries;
+		name_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( ( name_length + 1 ) > ( name_index->allocated_name_data_size - name_index->name_data_size ) )
+	{
+		allocated_name_data_size = name_index->allocated_name_data_size;
+
+		if( allocated_name_data_size == 0 )
+		{
+			allocated_name_data_size = 4096;
+		}
+		while( allocated_name_data_size < ( name_index->name_data_size + name_length + 1 ) )
+		{
+			if( allocated_name_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid name data size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			allocated_name_data_size *= 2;
+		}
+		name_data = (char *) memory_reallocate(
+		                      name_index->name_data,
+		                      sizeof( char ) * allocated_name_data_size );
+
+		if( name_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name data.",
+			 function );
+
+			return( -1 );
+		}
+		name_index->name_data                = name_data;
+		name_index->allocated_name_data_size = allocated_name_data_size;
+	}
+	if( name_length > 0 )
+	{
+		if( narrow_string_copy(
+		     &( name_index->name_data[ name_index->name_data_size ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	name_index->name_data[ name_index->name_data_size + name_length ] = 0;
+
+	if( libcdirectory_name_index_resize_unicode_buffer(
+	     &( name_index->case_folded_key_data ),
+	     &( name_index->allocated_case_folded_key_data_length ),
+	     name_index->case_folded_key_data_length + name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize case folded key data.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( name_index->entries[ name_index->number_of_entries ] );
+
+	if( libcdirectory_name_index_get_case_folded_key(
+	     name,
+	     name_length,
+	     &( name_index->case_folded_key_data[ name_index->case_folded_key_data_length ] ),
+	     name_index->allocated_case_folded_key_data_length - name_index->case_folded_key_data_length,
+	     &( entry->case_folded_key_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve case folded key.",
+		 function );
+
+		return( -1 );
+	}
+	entry->name_offset                  = name_index->name_data_size;
+	entry->name_length                  = name_length;
+	entry->name_hash                    = libcdirectory_name_index_calculate_hash(
+	                                       name,
+	                                       name_length );
+	entry->case_folded_key_offset       = name_index->case_folded_key_data_length;
+	entry->case_folded_key_hash         = libcdirectory_name_index_calculate_case_folded_key_hash(
+	                                       &( name_index->case_folded_key_data[ entry->case_folded_key_offset ] ),
+	                                       entry->case_folded_key_length );
+	entry->next_entry_index             = -1;
+	entry->next_case_folded_entry_index = -1;
+	entry->inode_number                 = inode_number;
+	entry->file_mode                    = file_mode;
+	entry->type                         = type;
+
+	name_index->name_data_size              += name_length + 1;
+	name_index->case_folded_key_data_length += entry->case_folded_key_length;
+	name_index->number_of_entries           += 1;
+
+	return( 1 );
+}
+
+/* Builds the hash buckets of the name index
+ * Entries that share a bucket are chained in the order they were appended
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_name_index_build(
+     libcdirectory_name_index_t *name_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_name_index_entry_t *entry = NULL;
+	static char *function                   = "libcdirectory_name_index_build";
+	uint32_t bucket_index                   = 0;
+	uint32_t number_of_buckets              = LIBCDIRECTORY_NAME_INDEX_MINIMUM_NUMBER_OF_BUCKETS;
+	int entry_index                         = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_index->buckets != NULL )
+	 || ( name_index->case_folded_buckets != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index - buckets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor at or below 0.5
+	 */
+	while( number_of_buckets < ( 2 * (uint32_t) name_index->number_of_entries ) )
+	{
+		if( number_of_buckets >= (uint32_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of buckets value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_buckets *= 2;
+	}
+	name_index->buckets = (int *) memory_allocate(
+	                               sizeof( int ) * number_of_buckets );
+
+	if( name_index->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	name_index->case_folded_buckets = (int *) memory_allocate(
+	                                           sizeof( int ) * number_of_buckets );
+
+	if( name_index->case_folded_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create case folded buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		name_index->buckets[ bucket_index ]             = -1;
+		name_index->case_folded_buckets[ bucket_index ] = -1;
+	}
+	/* Insert the entries in reverse order so that the first appended entry is at the start of a chain
+	 */
+	for( entry_index = name_index->number_of_entries - 1;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		entry = &( name_index->entries[ entry_index ] );
+
+		bucket_index = entry->name_hash & ( number_of_buckets - 1 );
+
+		entry->next_entry_index             = name_index->buckets[ bucket_index ];
+		name_index->buckets[ bucket_index ] = entry_index;
+
+		bucket_index = entry->case_folded_key_hash & ( number_of_buckets - 1 );
+
+		entry->next_case_folded_entry_index             = name_index->case_folded_buckets[ bucket_index ];
+		name_index->case_folded_buckets[ bucket_index ] = entry_index;
+	}
+	name_index->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( name_index->buckets != NULL )
+	{
+		memory_free(
+		 name_index->buckets );
+
+		name_index->buckets = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the next entry with a specific name
+ * Set entry_index to -1 to retrieve the index of the first entry with the name,
+ * otherwise the index of the entry that follows entry_index is retrieved
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_name_index_get_next_entry_index_by_name(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_name_index_entry_t *entry = NULL;
+	static char *function                   = "libcdirectory_name_index_get_next_entry_index_by_name";
+	uint32_t hash                           = 0;
+	int safe_entry_index                    = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name index - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *entry_index < -1 )
+	 || ( *entry_index >= name_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry_index == -1 )
+	{
+		hash = libcdirectory_name_index_calculate_hash(
+		        name,
+		        name_length );
+
+		safe_entry_index = name_index->buckets[ hash & ( name_index->number_of_buckets - 1 ) ];
+	}
+	else
+	{
+		entry = &( name_index->entries[ *entry_index ] );
+
+		hash             = entry->name_hash;
+		safe_entry_index = entry->next_entry_index;
+	}
+	while( safe_entry_index != -1 )
+	{
+		entry = &( name_index->entries[ safe_entry_index ] );
+
+		if( ( entry->name_hash == hash )
+		 && ( entry->name_length == name_length ) )
+		{
+			if( narrow_string_compare(
+			     &( name_index->name_data[ entry->name_offset ] ),
+			     name,
+			     name_length ) == 0 )
+			{
+				*entry_index = safe_entry_index;
+
+				return( 1 );
+			}
+		}
+		safe_entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the next entry with a case folded key that matches a specific name
+ * Set entry_index to -1 to retrieve the index of the first matching entry, which
+ * case folds the name into the lookup key, otherwise the index of the entry that
+ * follows entry_index is retrieved using the lookup key of the previous call
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_name_index_get_next_entry_index_by_case_folded_name(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_name_index_entry_t *entry = NULL;
+	static char *function                   = "libcdirectory_name_index_get_next_entry_index_by_case_folded_name";
+	uint32_t hash                           = 0;
+	int safe_entry_index                    = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->case_folded_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name index - missing case folded buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *entry_index < -1 )
+	 || ( *entry_index >= name_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry_index == -1 )
+	{
+		if( libcdirectory_name_index_resize_unicode_buffer(
+		     &( name_index->lookup_key ),
+		     &( name_index->allocated_lookup_key_length ),
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize lookup key.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_name_index_get_case_folded_key(
+		     name,
+		     name_length,
+		     name_index->lookup_key,
+		     name_index->allocated_lookup_key_length,
+		     &( name_index->lookup_key_length ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve case folded key.",
+			 function );
+
+			return( -1 );
+		}
+		hash = libcdirectory_name_index_calculate_case_folded_key_hash(
+		        name_index->lookup_key,
+		        name_index->lookup_key_length );
+
+		safe_entry_index = name_index->case_folded_buckets[ hash & ( name_index->number_of_buckets - 1 ) ];
+	}
+	else
+	{
+		entry = &( name_index->entries[ *entry_index ] );
+
+		hash             = entry->case_folded_key_hash;
+		safe_entry_index = entry->next_case_folded_entry_index;
+	}
+	while( safe_entry_index != -1 )
+	{
+		entry = &( name_index->entries[ safe_entry_index ] );
+
+		if( ( entry->case_folded_key_hash == hash )
+		 && ( entry->case_folded_key_length == name_index->lookup_key_length ) )
+		{
+			if( memory_compare(
+			     &( name_index->case_folded_key_data[ entry->case_folded_key_offset ] ),
+			     name_index->lookup_key,
+			     sizeof( libuna_unicode_character_t ) * name_index->lookup_key_length ) == 0 )
+			{
+				*entry_index = safe_entry_index;
+
+				return( 1 );
+			}
+		}
+		safe_entry_index = entry->next_case_folded_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the entry for a specific name
+ * An entry with an exact name match is preferred over an entry with a matching case folded key
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_name_index_get_entry_by_name(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint8_t compare_flags,
+     libcdirectory_name_index_entry_t **name_index_entry,
+     const char **entry_name,
+     libcerror_error_t **error )
+{
+	libcdirectory_name_index_entry_t *entry = NULL;
+	static char *function                   = "libcdirectory_name_index_get_entry_by_name";
+	int entry_index                         = -1;
+	int result                              = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_flags & ~( LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare flags: 0x%02" PRIx8 ".",
+		 function,
+		 compare_flags );
+
+		return( -1 );
+	}
+	if( name_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libcdirectory_name_index_get_next_entry_index_by_name(
+		          name_index,
+		          name,
+		          name_length,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry index by name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			entry = &( name_index->entries[ entry_index ] );
+
+			if( entry->type == type )
+			{
+				*name_index_entry = entry;
+				*entry_name       = &( name_index->name_data[ entry->name_offset ] );
+
+				return( 1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	if( ( compare_flags & LIBCDIRECTORY_COMPARE_FLAG_NO_CASE ) == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = -1;
+
+	do
+	{
+		result = libcdirectory_name_index_get_next_entry_index_by_case_folded_name(
+		          name_index,
+		          name,
+		          name_length,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry index by case folded name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			entry = &( name_index->entries[ entry_index ] );
+
+			if( entry->type == type )
+			{
+				*name_index_entry = entry;
+				*entry_name       = &( name_index->name_data[ entry->name_offset ] );
+
+				return( 1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
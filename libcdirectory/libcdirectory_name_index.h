@@ -0,0 +1,225 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_NAME_INDEX_H )
+#define _LIBCDIRECTORY_NAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcdirectory_name_index_entry libcdirectory_name_index_entry_t;
+
+struct libcdirectory_name_index_entry
+{
+	/* The offset of the name in the name data
+	 */
+	size_t name_offset;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The offset of the case folded key in the case folded key data
+	 */
+	size_t case_folded_key_offset;
+
+	/* The case folded key length
+	 */
+	size_t case_folded_key_length;
+
+	/* The case folded key hash
+	 */
+	uint32_t case_folded_key_hash;
+
+	/* The index of the next entry with the same name hash bucket, or -1 if not set
+	 */
+	int next_entry_index;
+
+	/* The index of the next entry with the same case folded key hash bucket, or -1 if not set
+	 */
+	int next_case_folded_entry_index;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The file type as stored in the file mode
+	 */
+	uint16_t file_mode;
+
+	/* The entry type
+	 */
+	uint8_t type;
+};
+
+typedef struct libcdirectory_name_index libcdirectory_name_index_t;
+
+struct libcdirectory_name_index
+{
+	/* The entries
+	 */
+	libcdirectory_name_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The name data, which contains the end-of-string terminated names
+	 */
+	char *name_data;
+
+	/* The name data size
+	 */
+	size_t name_data_size;
+
+	/* The allocated name data size
+	 */
+	size_t allocated_name_data_size;
+
+	/* The case folded key data, which contains the case folded Unicode characters of the names
+	 */
+	libuna_unicode_character_t *case_folded_key_data;
+
+	/* The number of Unicode characters in the case folded key data
+	 */
+	size_t case_folded_key_data_length;
+
+	/* The number of allocated Unicode characters in the case folded key data
+	 */
+	size_t allocated_case_folded_key_data_length;
+
+	/* The case folded key of the name that is looked up
+	 */
+	libuna_unicode_character_t *lookup_key;
+
+	/* The number of Unicode characters in the lookup key
+	 */
+	size_t lookup_key_length;
+
+	/* The number of allocated Unicode characters in the lookup key
+	 */
+	size_t allocated_lookup_key_length;
+
+	/* The name hash buckets
+	 */
+	int *buckets;
+
+	/* The case folded key hash buckets
+	 */
+	int *case_folded_buckets;
+
+	/* The number of buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+};
+
+int libcdirectory_name_index_initialize(
+     libcdirectory_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_free(
+     libcdirectory_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_empty(
+     libcdirectory_name_index_t *name_index,
+     libcerror_error_t **error );
+
+uint32_t libcdirectory_name_index_calculate_hash(
+          const char *name,
+          size_t name_length );
+
+uint32_t libcdirectory_name_index_calculate_case_folded_key_hash(
+          const libuna_unicode_character_t *case_folded_key,
+          size_t case_folded_key_length );
+
+int libcdirectory_name_index_get_case_folded_key(
+     const char *name,
+     size_t name_length,
+     libuna_unicode_character_t *case_folded_key,
+     size_t case_folded_key_size,
+     size_t *case_folded_key_length,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_resize_unicode_buffer(
+     libuna_unicode_character_t **buffer,
+     size_t *allocated_buffer_length,
+     size_t buffer_length,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_append_entry(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint16_t file_mode,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_build(
+     libcdirectory_name_index_t *name_index,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_get_next_entry_index_by_name(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_get_next_entry_index_by_case_folded_name(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcdirectory_name_index_get_entry_by_name(
+     libcdirectory_name_index_t *name_index,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint8_t compare_flags,
+     libcdirectory_name_index_entry_t **name_index_entry,
+     const char **entry_name,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_NAME_INDEX_H ) */
+
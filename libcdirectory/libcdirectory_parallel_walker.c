@@ -0,0 +1,3882 @@
+/*
+ * Parallel walker functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_listing.h"
+#include "libcdirectory_parallel_walker.h"
+#include "libcdirectory_threads.h"
+#include "libcdirectory_types.h"
+#include "libcdirectory_walker.h"
+
+/* Creates a parallel walker
+ * Make sure the value parallel_walker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_initialize(
+     libcdirectory_parallel_walker_t **parallel_walker,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_initialize";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parallel_walker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parallel walker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = memory_allocate_structure(
+	                            libcdirectory_internal_parallel_walker_t );
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parallel walker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_parallel_walker,
+	     0,
+	     sizeof( libcdirectory_internal_parallel_walker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parallel walker.",
+		 function );
+
+		goto on_error;
+	}
+	internal_parallel_walker->number_of_threads   = LIBCDIRECTORY_PARALLEL_WALKER_DEFAULT_NUMBER_OF_THREADS;
+	internal_parallel_walker->maximum_buffer_size = LIBCDIRECTORY_PARALLEL_WALKER_DEFAULT_MAXIMUM_BUFFER_SIZE;
+
+	*parallel_walker = (libcdirectory_parallel_walker_t *) internal_parallel_walker;
+
+	return( 1 );
+
+on_error:
+	if( internal_parallel_walker != NULL )
+	{
+		memory_free(
+		 internal_parallel_walker );
+	}
+	return( -1 );
+}
+
+/* Frees a parallel walker
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_free(
+     libcdirectory_parallel_walker_t **parallel_walker,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_free";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parallel_walker != NULL )
+	{
+		internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) *parallel_walker;
+		*parallel_walker         = NULL;
+
+		memory_free(
+		 internal_parallel_walker );
+	}
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * The number of threads is 1 when multi-threading is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_set_number_of_threads(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_set_number_of_threads";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBCDIRECTORY_PARALLEL_WALKER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the read buffer size of the directories
+ * A read buffer size of 0 represents the system default
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_set_read_buffer_size(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     size_t read_buffer_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_set_read_buffer_size";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( ( read_buffer_size != 0 )
+	 && ( read_buffer_size < LIBCDIRECTORY_DIRECTORY_MINIMUM_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid read buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_size > (size_t) LIBCDIRECTORY_DIRECTORY_MAXIMUM_READ_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker->read_buffer_size = read_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum depth
+ * The entries of the walked directory have depth 1 and a maximum depth of 0 represents no maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_set_maximum_depth(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     int maximum_depth,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_set_maximum_depth";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( maximum_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum depth value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker->maximum_depth = maximum_depth;
+
+	return( 1 );
+}
+
+/* Sets the maximum buffer size
+ * The maximum buffer size limits the size of the listings that are read ahead by an ordered walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_set_maximum_buffer_size(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     size_t maximum_buffer_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_set_maximum_buffer_size";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( maximum_buffer_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum buffer size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker->maximum_buffer_size = maximum_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the flags
+ * Only LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE is supported
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_set_flags(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_set_flags";
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( ( flags & ~( LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	internal_parallel_walker->flags = flags;
+
+	return( 1 );
+}
+
+/* Initializes a deque
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_deque_initialize(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_parallel_walker_deque_initialize";
+
+	if( deque == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deque.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     deque,
+	     0,
+	     sizeof( libcdirectory_parallel_walker_deque_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deque.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_initialize(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Frees a deque and the items it contains
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_deque_free(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_parallel_walker_deque_free";
+	int item_index        = 0;
+	int result            = 1;
+
+	if( deque == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deque.",
+		 function );
+
+		return( -1 );
+	}
+	if( deque->items != NULL )
+	{
+		while( deque->number_of_items > 0 )
+		{
+			item_index = deque->first_item_index;
+
+			if( deque->items[ item_index ].path != NULL )
+			{
+				memory_free(
+				 deque->items[ item_index ].path );
+			}
+			deque->first_item_index = ( item_index + 1 ) & ( deque->number_of_allocated_items - 1 );
+			deque->number_of_items -= 1;
+		}
+		memory_free(
+		 deque->items );
+
+		deque->items                     = NULL;
+		deque->number_of_allocated_items = 0;
+		deque->first_item_index          = 0;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_free(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Pushes an item onto the back of a deque
+ * The deque takes over the path of the item
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_deque_push_back(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	libcdirectory_parallel_walker_item_t *items = NULL;
+	static char *function                       = "libcdirectory_parallel_walker_deque_push_back";
+	int item_index                              = 0;
+	int number_of_allocated_items               = 0;
+	int result                                  = 1;
+
+	if( deque == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deque.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( deque->number_of_items >= deque->number_of_allocated_items )
+	{
+		/* The ring buffer is full, the items are moved to the start of a buffer of twice the size
+		 */
+		if( deque->number_of_allocated_items == 0 )
+		{
+			number_of_allocated_items = LIBCDIRECTORY_PARALLEL_WALKER_INITIAL_NUMBER_OF_ITEMS;
+		}
+		else if( deque->number_of_allocated_items > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_parallel_walker_item_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated items value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			number_of_allocated_items = deque->number_of_allocated_items * 2;
+		}
+		if( result == 1 )
+		{
+			items = (libcdirectory_parallel_walker_item_t *) memory_allocate(
+			                                                  sizeof( libcdirectory_parallel_walker_item_t ) * number_of_allocated_items );
+
+			if( items == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create items.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			for( item_index = 0;
+			     item_index < deque->number_of_items;
+			     item_index++ )
+			{
+				items[ item_index ] = deque->items[ ( deque->first_item_index + item_index ) & ( deque->number_of_allocated_items - 1 ) ];
+			}
+			if( deque->items != NULL )
+			{
+				memory_free(
+				 deque->items );
+			}
+			deque->items                     = items;
+			deque->number_of_allocated_items = number_of_allocated_items;
+			deque->first_item_index          = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		item_index = ( deque->first_item_index + deque->number_of_items ) & ( deque->number_of_allocated_items - 1 );
+
+		deque->items[ item_index ] = *item;
+		deque->number_of_items    += 1;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_release(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Pops an item from the back of a deque
+ * The back of the deque is used by the thread that owns it, which results in
+ * a depth-first order that keeps the number of queued directories small
+ * Returns 1 if successful, 0 if the deque is empty or -1 on error
+ */
+int libcdirectory_parallel_walker_deque_pop_back(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_parallel_walker_deque_pop_back";
+	int item_index        = 0;
+	int result            = 0;
+
+	if( deque == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deque.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( deque->number_of_items > 0 )
+	{
+		item_index = ( deque->first_item_index + deque->number_of_items - 1 ) & ( deque->number_of_allocated_items - 1 );
+
+		*item                   = deque->items[ item_index ];
+		deque->number_of_items -= 1;
+
+		result = 1;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_release(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Pops an item from the front of a deque
+ * The front of the deque is used by threads that steal from it, which
+ * takes the directories closest to the walked directory and with that
+ * the largest amount of remaining work
+ * Returns 1 if successful, 0 if the deque is empty or -1 on error
+ */
+int libcdirectory_parallel_walker_deque_pop_front(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_parallel_walker_deque_pop_front";
+	int result            = 0;
+
+	if( deque == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deque.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( deque->number_of_items > 0 )
+	{
+		*item = deque->items[ deque->first_item_index ];
+
+		deque->first_item_index = ( deque->first_item_index + 1 ) & ( deque->number_of_allocated_items - 1 );
+		deque->number_of_items -= 1;
+
+		result = 1;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_release(
+	     &( deque->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Initializes a thread context
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_thread_context_initialize(
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     int thread_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_directory_t *internal_directory = NULL;
+	static char *function                                  = "libcdirectory_parallel_walker_thread_context_initialize";
+	size_t root_path_length                                = 0;
+
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parallel_walker->root_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parallel walker - missing root path.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     thread_context,
+	     0,
+	     sizeof( libcdirectory_parallel_walker_thread_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread context.",
+		 function );
+
+		return( -1 );
+	}
+	thread_context->internal_parallel_walker = internal_parallel_walker;
+	thread_context->thread_index             = thread_index;
+
+	if( libcdirectory_parallel_walker_deque_initialize(
+	     &( thread_context->deque ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize deque.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_initialize(
+	     &( thread_context->directory ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory = (libcdirectory_internal_directory_t *) thread_context->directory;
+
+	/* The entry type is needed to determine if an entry is descended into
+	 */
+	internal_directory->flags            = LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE;
+	internal_directory->read_buffer_size = internal_parallel_walker->read_buffer_size;
+
+	if( libcdirectory_directory_entry_initialize(
+	     &( thread_context->directory_entry ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	root_path_length = narrow_string_length(
+	                    internal_parallel_walker->root_path );
+
+	if( libcdirectory_parallel_walker_thread_context_set_path(
+	     thread_context,
+	     0,
+	     internal_parallel_walker->root_path,
+	     root_path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_parallel_walker->root_path_length > root_path_length )
+	{
+		thread_context->path[ root_path_length ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+	}
+	return( 1 );
+
+on_error:
+	libcdirectory_parallel_walker_thread_context_free(
+	 thread_context,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees a thread context
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_thread_context_free(
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_parallel_walker_thread_context_free";
+	int result            = 1;
+
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_parallel_walker_deque_free(
+	     &( thread_context->deque ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free deque.",
+		 function );
+
+		result = -1;
+	}
+	if( thread_context->directory != NULL )
+	{
+		if( libcdirectory_directory_free(
+		     &( thread_context->directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( thread_context->directory_entry != NULL )
+	{
+		if( libcdirectory_directory_entry_free(
+		     &( thread_context->directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( thread_context->path != NULL )
+	{
+		memory_free(
+		 thread_context->path );
+
+		thread_context->path = NULL;
+	}
+	thread_context->path_size = 0;
+
+	if( thread_context->error != NULL )
+	{
+		libcerror_error_free(
+		 &( thread_context->error ) );
+	}
+	return( result );
+}
+
+/* Sets a part of the path of a thread context
+ * The path buffer is only resized when the path does not fit
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_thread_context_set_path(
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     size_t path_offset,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	char *thread_context_path = NULL;
+	static char *function     = "libcdirectory_parallel_walker_thread_context_set_path";
+	size_t path_size          = 0;
+
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path == NULL )
+	 && ( path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_offset >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( path_length >= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - path_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_offset + path_length + 1 ) > thread_context->path_size )
+	{
+		path_size = thread_context->path_size;
+
+		if( path_size == 0 )
+		{
+			path_size = LIBCDIRECTORY_WALKER_INITIAL_PATH_SIZE;
+		}
+		while( path_size < ( path_offset + path_length + 1 ) )
+		{
+			if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				path_size = path_offset + path_length + 1;
+
+				break;
+			}
+			path_size *= 2;
+		}
+		thread_context_path = (char *) memory_reallocate(
+		                                thread_context->path,
+		                                sizeof( char ) * path_size );
+
+		if( thread_context_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		thread_context->path      = thread_context_path;
+		thread_context->path_size = path_size;
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     &( thread_context->path[ path_offset ] ),
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	thread_context->path[ path_offset + path_length ] = 0;
+
+	return( 1 );
+}
+
+/* Queues a directory on the deque of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_push_item(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     const char *path,
+     size_t path_length,
+     int depth,
+     libcerror_error_t **error )
+{
+	libcdirectory_parallel_walker_item_t item;
+
+	static char *function = "libcdirectory_internal_parallel_walker_push_item";
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	int signal_thread     = 0;
+#endif
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path == NULL )
+	 && ( path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	item.path = (char *) memory_allocate(
+	                      sizeof( char ) * ( path_length + 1 ) );
+
+	if( item.path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     item.path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy item path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	item.path[ path_length ] = 0;
+
+	item.path_length = path_length;
+	item.depth       = depth;
+
+	/* The directory is counted as pending before it is queued so that the number
+	 * of pending directories cannot drop to 0 while it can still be stolen
+	 */
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_parallel_walker->number_of_pending_items += 1;
+	internal_parallel_walker->number_of_queued_items  += 1;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	signal_thread = (int) ( internal_parallel_walker->number_of_waiting_threads > 0 );
+
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdirectory_parallel_walker_deque_push_back(
+	     &( thread_context->deque ),
+	     &item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push item onto deque.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( signal_thread != 0 )
+	{
+		if( libcdirectory_threads_condition_signal(
+		     &( internal_parallel_walker->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal condition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( item.path != NULL )
+	{
+		memory_free(
+		 item.path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the next directory to read
+ * The directory is taken from the back of the deque of the thread or
+ * otherwise stolen from the front of the deque of another thread
+ * Returns 1 if successful, 0 if the walk is finished or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_get_item(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_get_item";
+	int thread_index      = 0;
+	int result            = 0;
+	int victim_index      = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		result = libcdirectory_parallel_walker_deque_pop_back(
+		          &( thread_context->deque ),
+		          item,
+		          error );
+
+		for( thread_index = 1;
+		     ( result == 0 ) && ( thread_index < internal_parallel_walker->number_of_thread_contexts );
+		     thread_index++ )
+		{
+			victim_index = ( thread_context->thread_index + thread_index ) % internal_parallel_walker->number_of_thread_contexts;
+
+			result = libcdirectory_parallel_walker_deque_pop_front(
+			          &( internal_parallel_walker->thread_contexts[ victim_index ].deque ),
+			          item,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop item from deque.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+		if( libcdirectory_threads_mutex_grab(
+		     &( internal_parallel_walker->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == 1 )
+		{
+			internal_parallel_walker->number_of_queued_items -= 1;
+		}
+		else if( ( internal_parallel_walker->abort == 0 )
+		      && ( internal_parallel_walker->number_of_pending_items > 0 )
+		      && ( internal_parallel_walker->number_of_queued_items <= 0 ) )
+		{
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+			/* Wait until another thread queues a directory or the walk is finished
+			 */
+			internal_parallel_walker->number_of_waiting_threads += 1;
+
+			if( libcdirectory_threads_condition_wait(
+			     &( internal_parallel_walker->condition ),
+			     &( internal_parallel_walker->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				internal_parallel_walker->number_of_waiting_threads -= 1;
+
+				libcdirectory_threads_mutex_release(
+				 &( internal_parallel_walker->mutex ),
+				 NULL );
+
+				return( -1 );
+			}
+			internal_parallel_walker->number_of_waiting_threads -= 1;
+#else
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid parallel walker - pending directories without queued directories.",
+			 function );
+
+			return( -1 );
+#endif
+		}
+		if( internal_parallel_walker->abort != 0 )
+		{
+			result = -2;
+		}
+		else if( ( result == 0 )
+		      && ( internal_parallel_walker->number_of_pending_items <= 0 ) )
+		{
+			result = -3;
+		}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+		if( libcdirectory_threads_mutex_release(
+		     &( internal_parallel_walker->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == 1 )
+		{
+			break;
+		}
+		else if( result == -2 )
+		{
+			/* The walk was aborted by another thread
+			 */
+			if( item->path != NULL )
+			{
+				memory_free(
+				 item->path );
+
+				item->path = NULL;
+			}
+			return( 0 );
+		}
+		else if( result == -3 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( result == 1 )
+	{
+		memory_free(
+		 item->path );
+
+		item->path = NULL;
+	}
+	return( -1 );
+#endif
+}
+
+/* Finishes a directory that was read
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_finish_item(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_finish_item";
+	int result            = 1;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( item->path != NULL )
+	{
+		memory_free(
+		 item->path );
+
+		item->path = NULL;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_parallel_walker->number_of_pending_items -= 1;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( ( internal_parallel_walker->number_of_pending_items <= 0 )
+	 && ( internal_parallel_walker->number_of_waiting_threads > 0 ) )
+	{
+		/* Wake the waiting threads since the walk is finished
+		 */
+		if( libcdirectory_threads_condition_broadcast(
+		     &( internal_parallel_walker->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Aborts a walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_abort(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_abort";
+	int result            = 1;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_parallel_walker->abort = 1;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_condition_broadcast(
+	     &( internal_parallel_walker->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Reads the entries of a directory
+ * The callback is called for every entry and subdirectories are queued on the deque of the thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_read_directory(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	const char *name      = NULL;
+	static char *function = "libcdirectory_internal_parallel_walker_read_directory";
+	size_t name_length    = 0;
+	size_t name_offset    = 0;
+	size_t path_length    = 0;
+	uint8_t entry_type    = 0;
+	int callback_result   = 0;
+	int depth             = 0;
+	int result            = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( item->path_length == 0 )
+	{
+		result = libcdirectory_directory_open(
+		          thread_context->directory,
+		          internal_parallel_walker->root_path,
+		          error );
+
+		name_offset = internal_parallel_walker->root_path_length;
+	}
+	else
+	{
+		if( libcdirectory_parallel_walker_thread_context_set_path(
+		     thread_context,
+		     internal_parallel_walker->root_path_length,
+		     item->path,
+		     item->path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			return( -1 );
+		}
+		result = libcdirectory_directory_open(
+		          thread_context->directory,
+		          thread_context->path,
+		          error );
+
+		name_offset = internal_parallel_walker->root_path_length + item->path_length + 1;
+	}
+	if( result != 1 )
+	{
+		if( ( item->path_length > 0 )
+		 && ( ( internal_parallel_walker->flags & LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 1 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		return( -1 );
+	}
+	depth = item->depth + 1;
+
+	while( 1 )
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          (libcdirectory_internal_directory_t *) thread_context->directory,
+		          (libcdirectory_internal_directory_entry_t *) thread_context->directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     thread_context->directory_entry,
+		     (char **) &name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( name[ 0 ] == '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		name_length = narrow_string_length(
+		               name );
+
+		if( libcdirectory_parallel_walker_thread_context_set_path(
+		     thread_context,
+		     name_offset,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			goto on_error;
+		}
+		if( item->path_length > 0 )
+		{
+			thread_context->path[ name_offset - 1 ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+		}
+		path_length = name_offset + name_length - internal_parallel_walker->root_path_length;
+
+		callback_result = 1;
+
+		if( internal_parallel_walker->callback != NULL )
+		{
+			callback_result = internal_parallel_walker->callback(
+			                   thread_context->directory_entry,
+			                   &( thread_context->path[ internal_parallel_walker->root_path_length ] ),
+			                   path_length,
+			                   depth,
+			                   thread_context->thread_index,
+			                   internal_parallel_walker->callback_data,
+			                   error );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback failed for entry: %s.",
+				 function,
+				 &( thread_context->path[ internal_parallel_walker->root_path_length ] ) );
+
+				goto on_error;
+			}
+		}
+		if( ( callback_result != 0 )
+		 && ( ( internal_parallel_walker->maximum_depth == 0 )
+		  || ( depth < internal_parallel_walker->maximum_depth ) ) )
+		{
+			if( libcdirectory_directory_entry_get_type(
+			     thread_context->directory_entry,
+			     &entry_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry type.",
+				 function );
+
+				goto on_error;
+			}
+			if( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+			{
+				if( libcdirectory_internal_parallel_walker_push_item(
+				     internal_parallel_walker,
+				     thread_context,
+				     &( thread_context->path[ internal_parallel_walker->root_path_length ] ),
+				     path_length,
+				     depth,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to queue directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( libcdirectory_directory_close(
+	     thread_context->directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcdirectory_directory_close(
+	 thread_context->directory,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Runs a thread of a walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_thread_context_run(
+     void *arguments )
+{
+	libcdirectory_parallel_walker_item_t item;
+
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	libcdirectory_parallel_walker_thread_context_t *thread_context     = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_thread_context_run";
+	int result                                                         = 0;
+
+	thread_context = (libcdirectory_parallel_walker_thread_context_t *) arguments;
+
+	if( thread_context == NULL )
+	{
+		return( -1 );
+	}
+	internal_parallel_walker = thread_context->internal_parallel_walker;
+
+	item.path = NULL;
+
+	while( 1 )
+	{
+		result = libcdirectory_internal_parallel_walker_get_item(
+		          internal_parallel_walker,
+		          thread_context,
+		          &item,
+		          &( thread_context->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( thread_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libcdirectory_internal_parallel_walker_read_directory(
+		          internal_parallel_walker,
+		          thread_context,
+		          &item,
+		          &( thread_context->error ) );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &( thread_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory.",
+			 function );
+		}
+		if( libcdirectory_internal_parallel_walker_finish_item(
+		     internal_parallel_walker,
+		     &item,
+		     &( thread_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( thread_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finish directory.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcdirectory_internal_parallel_walker_abort(
+	 internal_parallel_walker,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Initializes a walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_initialize_walk(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     const char *path,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcdirectory_internal_parallel_walker_initialize_walk";
+	size_t path_length                        = 0;
+	int number_of_initialized_thread_contexts = 0;
+	int number_of_threads                     = 0;
+	int thread_index                          = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	int synchronization_initialized           = 0;
+#endif
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parallel_walker->thread_contexts != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parallel walker - thread contexts value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path length value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	number_of_threads = internal_parallel_walker->number_of_threads;
+#else
+	number_of_threads = 1;
+#endif
+
+	internal_parallel_walker->root_path                 = path;
+	internal_parallel_walker->root_path_length          = path_length;
+	internal_parallel_walker->number_of_pending_items   = 0;
+	internal_parallel_walker->number_of_queued_items    = 0;
+	internal_parallel_walker->number_of_waiting_threads = 0;
+	internal_parallel_walker->abort                     = 0;
+	internal_parallel_walker->buffered_size             = 0;
+	internal_parallel_walker->queued_listings           = NULL;
+
+	if( path[ path_length - 1 ] != (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR )
+	{
+		internal_parallel_walker->root_path_length += 1;
+	}
+	internal_parallel_walker->thread_contexts = (libcdirectory_parallel_walker_thread_context_t *) memory_allocate(
+	                                                                                                sizeof( libcdirectory_parallel_walker_thread_context_t ) * number_of_threads );
+
+	if( internal_parallel_walker->thread_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread contexts.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_initialize(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_threads_condition_initialize(
+	     &( internal_parallel_walker->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		libcdirectory_threads_mutex_free(
+		 &( internal_parallel_walker->mutex ),
+		 NULL );
+
+		goto on_error;
+	}
+	synchronization_initialized = 1;
+#endif
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcdirectory_parallel_walker_thread_context_initialize(
+		     &( internal_parallel_walker->thread_contexts[ thread_index ] ),
+		     internal_parallel_walker,
+		     thread_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize thread context: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		number_of_initialized_thread_contexts++;
+	}
+	internal_parallel_walker->number_of_thread_contexts = number_of_threads;
+
+	return( 1 );
+
+on_error:
+	if( internal_parallel_walker->thread_contexts != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_initialized_thread_contexts;
+		     thread_index++ )
+		{
+			libcdirectory_parallel_walker_thread_context_free(
+			 &( internal_parallel_walker->thread_contexts[ thread_index ] ),
+			 NULL );
+		}
+		memory_free(
+		 internal_parallel_walker->thread_contexts );
+
+		internal_parallel_walker->thread_contexts = NULL;
+	}
+	internal_parallel_walker->number_of_thread_contexts = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( synchronization_initialized != 0 )
+	{
+		libcdirectory_threads_condition_free(
+		 &( internal_parallel_walker->condition ),
+		 NULL );
+		libcdirectory_threads_mutex_free(
+		 &( internal_parallel_walker->mutex ),
+		 NULL );
+	}
+#endif
+	internal_parallel_walker->root_path = NULL;
+
+	return( -1 );
+}
+
+/* Starts the threads of a walk, except for the first thread which is the calling thread
+ * The walk is aborted if a thread cannot be started
+ * Returns the number of started threads
+ */
+int libcdirectory_internal_parallel_walker_start_threads(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     int (*start_function)(
+            void *arguments ) )
+{
+	int number_of_started_threads = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	static char *function         = "libcdirectory_internal_parallel_walker_start_threads";
+	int thread_index              = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		return( 0 );
+	}
+	for( thread_index = 1;
+	     thread_index < internal_parallel_walker->number_of_thread_contexts;
+	     thread_index++ )
+	{
+		if( libcdirectory_threads_thread_create(
+		     &( internal_parallel_walker->thread_contexts[ thread_index ].thread ),
+		     start_function,
+		     (void *) &( internal_parallel_walker->thread_contexts[ thread_index ] ),
+		     &( internal_parallel_walker->thread_contexts[ thread_index ].error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( internal_parallel_walker->thread_contexts[ thread_index ].error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			libcdirectory_internal_parallel_walker_abort(
+			 internal_parallel_walker,
+			 NULL );
+
+			break;
+		}
+		number_of_started_threads++;
+	}
+#endif
+	return( number_of_started_threads );
+}
+
+/* Joins the threads of a walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_join_threads(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     int number_of_started_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_join_threads";
+	int result            = 1;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	int thread_index      = 0;
+#endif
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 1;
+	     thread_index <= number_of_started_threads;
+	     thread_index++ )
+	{
+		if( libcdirectory_threads_thread_join(
+		     &( internal_parallel_walker->thread_contexts[ thread_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Finalizes a walk
+ * The first error of the threads is moved into error, if error does not contain an error already
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_finalize_walk(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_finalize_walk";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parallel_walker->thread_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parallel walker - missing thread contexts.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < internal_parallel_walker->number_of_thread_contexts;
+	     thread_index++ )
+	{
+		if( internal_parallel_walker->thread_contexts[ thread_index ].error != NULL )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = internal_parallel_walker->thread_contexts[ thread_index ].error;
+
+				internal_parallel_walker->thread_contexts[ thread_index ].error = NULL;
+			}
+			result = -1;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < internal_parallel_walker->number_of_thread_contexts;
+	     thread_index++ )
+	{
+		if( libcdirectory_parallel_walker_thread_context_free(
+		     &( internal_parallel_walker->thread_contexts[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free thread context: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 internal_parallel_walker->thread_contexts );
+
+	internal_parallel_walker->thread_contexts           = NULL;
+	internal_parallel_walker->number_of_thread_contexts = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_condition_free(
+	     &( internal_parallel_walker->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdirectory_threads_mutex_free(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	internal_parallel_walker->root_path       = NULL;
+	internal_parallel_walker->callback        = NULL;
+	internal_parallel_walker->callback_data   = NULL;
+	internal_parallel_walker->queued_listings = NULL;
+
+	return( result );
+}
+
+/* Walks a directory tree using multiple threads
+ * The directories are distributed over per-thread deques, a thread reads the
+ * directories on its own deque depth-first and steals directories from the deques
+ * of other threads when its own deque is empty
+ * The callback is called for every entry, except for "." and "..", from the thread
+ * that read the entry, which is identified by thread_index in the range 0 to the
+ * number of threads - 1 and can be used to select a per-thread sink. The callback
+ * must be thread-safe otherwise. The order in which the entries are passed to the
+ * callback is not defined. The directory entry and path are valid until the callback returns
+ * The callback returns 1 to continue, 0 to not descend into a directory or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_walk(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     const char *path,
+     int (*callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            int thread_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_walk";
+	int number_of_started_threads                                      = 0;
+	int result                                                         = 1;
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( libcdirectory_internal_parallel_walker_initialize_walk(
+	     internal_parallel_walker,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize walk.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker->callback      = callback;
+	internal_parallel_walker->callback_data = callback_data;
+
+	/* The walked directory is read by the first thread
+	 */
+	if( libcdirectory_internal_parallel_walker_push_item(
+	     internal_parallel_walker,
+	     &( internal_parallel_walker->thread_contexts[ 0 ] ),
+	     NULL,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to queue directory.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		number_of_started_threads = libcdirectory_internal_parallel_walker_start_threads(
+		                             internal_parallel_walker,
+		                             &libcdirectory_parallel_walker_thread_context_run );
+
+		/* The calling thread is used as the first thread
+		 */
+		libcdirectory_parallel_walker_thread_context_run(
+		 (void *) &( internal_parallel_walker->thread_contexts[ 0 ] ) );
+
+		if( libcdirectory_internal_parallel_walker_join_threads(
+		     internal_parallel_walker,
+		     number_of_started_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join threads.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* Return the first error of the threads
+	 */
+	if( libcdirectory_internal_parallel_walker_finalize_walk(
+	     internal_parallel_walker,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk directory: %s.",
+		 function,
+		 path );
+	}
+	return( result );
+}
+
+/* Queues a listing
+ * The listing is read before the listings that were queued before
+ * The mutex must be grabbed by the caller
+ */
+void libcdirectory_internal_parallel_walker_queue_listing(
+      libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+      libcdirectory_listing_t *listing )
+{
+	if( ( internal_parallel_walker == NULL )
+	 || ( listing == NULL ) )
+	{
+		return;
+	}
+	listing->previous_listing = NULL;
+	listing->next_listing     = internal_parallel_walker->queued_listings;
+
+	if( internal_parallel_walker->queued_listings != NULL )
+	{
+		internal_parallel_walker->queued_listings->previous_listing = listing;
+	}
+	internal_parallel_walker->queued_listings = listing;
+}
+
+/* Removes a listing from the queue
+ * The mutex must be grabbed by the caller
+ */
+void libcdirectory_internal_parallel_walker_unqueue_listing(
+      libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+      libcdirectory_listing_t *listing )
+{
+	if( ( internal_parallel_walker == NULL )
+	 || ( listing == NULL ) )
+	{
+		return;
+	}
+	if( listing->previous_listing != NULL )
+	{
+		listing->previous_listing->next_listing = listing->next_listing;
+	}
+	else if( internal_parallel_walker->queued_listings == listing )
+	{
+		internal_parallel_walker->queued_listings = listing->next_listing;
+	}
+	if( listing->next_listing != NULL )
+	{
+		listing->next_listing->previous_listing = listing->previous_listing;
+	}
+	listing->previous_listing = NULL;
+	listing->next_listing     = NULL;
+}
+
+/* Waits until the condition is signalled
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_wait(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_wait";
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	int result            = 0;
+#endif
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	internal_parallel_walker->number_of_waiting_threads += 1;
+
+	result = libcdirectory_threads_condition_wait(
+	          &( internal_parallel_walker->condition ),
+	          &( internal_parallel_walker->mutex ),
+	          error );
+
+	internal_parallel_walker->number_of_waiting_threads -= 1;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unable to wait without multi-thread support.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Reads the entries of the directory of a listing into the listing
+ * A listing is created, but not queued, for every subdirectory that is descended into
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_read_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error )
+{
+	libcdirectory_listing_t *sub_listing = NULL;
+	const char *name                     = NULL;
+	static char *function                = "libcdirectory_internal_parallel_walker_read_listing";
+	size_t name_length                   = 0;
+	size_t name_offset                   = 0;
+	uint64_t inode_number                = 0;
+	uint32_t attributes                  = 0;
+	uint8_t entry_type                   = 0;
+	int depth                            = 0;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread context.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing->path_length == 0 )
+	{
+		result = libcdirectory_directory_open(
+		          thread_context->directory,
+		          internal_parallel_walker->root_path,
+		          error );
+
+		name_offset = internal_parallel_walker->root_path_length;
+	}
+	else
+	{
+		if( libcdirectory_parallel_walker_thread_context_set_path(
+		     thread_context,
+		     internal_parallel_walker->root_path_length,
+		     listing->path,
+		     listing->path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			return( -1 );
+		}
+		result = libcdirectory_directory_open(
+		          thread_context->directory,
+		          thread_context->path,
+		          error );
+
+		name_offset = internal_parallel_walker->root_path_length + listing->path_length + 1;
+	}
+	if( result != 1 )
+	{
+		if( ( listing->path_length > 0 )
+		 && ( ( internal_parallel_walker->flags & LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 1 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		return( -1 );
+	}
+	depth = listing->depth + 1;
+
+	while( 1 )
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          (libcdirectory_internal_directory_t *) thread_context->directory,
+		          (libcdirectory_internal_directory_entry_t *) thread_context->directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     thread_context->directory_entry,
+		     (char **) &name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( name[ 0 ] == '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		name_length = narrow_string_length(
+		               name );
+
+		/* The type is retrieved first since it can resolve an unknown type
+		 */
+		if( libcdirectory_directory_entry_get_type(
+		     thread_context->directory_entry,
+		     &entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdirectory_internal_directory_entry_get_detached_values(
+		     (libcdirectory_internal_directory_entry_t *) thread_context->directory_entry,
+		     &attributes,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdirectory_listing_append_entry(
+		     listing,
+		     name,
+		     name_length,
+		     entry_type,
+		     attributes,
+		     inode_number,
+		     &entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to listing.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		 && ( ( internal_parallel_walker->maximum_depth == 0 )
+		  || ( depth < internal_parallel_walker->maximum_depth ) ) )
+		{
+			if( libcdirectory_parallel_walker_thread_context_set_path(
+			     thread_context,
+			     name_offset,
+			     name,
+			     name_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path.",
+				 function );
+
+				goto on_error;
+			}
+			if( listing->path_length > 0 )
+			{
+				thread_context->path[ name_offset - 1 ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+			}
+			if( libcdirectory_listing_initialize(
+			     &sub_listing,
+			     &( thread_context->path[ internal_parallel_walker->root_path_length ] ),
+			     name_offset + name_length - internal_parallel_walker->root_path_length,
+			     depth,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub listing.",
+				 function );
+
+				goto on_error;
+			}
+			listing->entries[ entry_index ].sub_listing = sub_listing;
+
+			sub_listing = NULL;
+		}
+	}
+	if( libcdirectory_directory_close(
+	     thread_context->directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcdirectory_directory_close(
+	 thread_context->directory,
+	 NULL );
+
+	for( entry_index = 0;
+	     entry_index < listing->number_of_entries;
+	     entry_index++ )
+	{
+		if( listing->entries[ entry_index ].sub_listing != NULL )
+		{
+			libcdirectory_listing_free(
+			 &( listing->entries[ entry_index ].sub_listing ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Reads a listing and queues the listings of its subdirectories
+ * An error reading the directory is stored in the listing, since it is only
+ * returned when the listing is passed to the callback
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_process_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_process_listing";
+	size_t allocated_size = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdirectory_internal_parallel_walker_read_listing(
+	          internal_parallel_walker,
+	          thread_context,
+	          listing,
+	          &( listing->error ) );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &( listing->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory: %s.",
+		 function,
+		 listing->path );
+	}
+	if( libcdirectory_listing_get_allocated_size(
+	     listing,
+	     &allocated_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve listing allocated size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		/* The listings are queued in reverse order so that the listing of the first subdirectory is read first
+		 */
+		for( entry_index = listing->number_of_entries - 1;
+		     entry_index >= 0;
+		     entry_index-- )
+		{
+			if( listing->entries[ entry_index ].sub_listing != NULL )
+			{
+				libcdirectory_internal_parallel_walker_queue_listing(
+				 internal_parallel_walker,
+				 listing->entries[ entry_index ].sub_listing );
+			}
+		}
+		listing->state = LIBCDIRECTORY_LISTING_STATE_READ;
+	}
+	else
+	{
+		listing->state = LIBCDIRECTORY_LISTING_STATE_FAILED;
+	}
+	/* The size is retained so that releasing the listing subtracts exactly the size that was added
+	 */
+	listing->buffered_size                   = allocated_size;
+	internal_parallel_walker->buffered_size += allocated_size;
+
+	result = 1;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_parallel_walker->number_of_waiting_threads > 0 )
+	{
+		if( libcdirectory_threads_condition_broadcast(
+		     &( internal_parallel_walker->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next queued listing to read
+ * A listing is only retrieved when the size of the listings that are read ahead
+ * is less than the maximum buffer size, otherwise the thread waits until listings are released
+ * Returns 1 if successful, 0 if the walk is finished or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_get_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_get_listing";
+	int result            = 0;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( internal_parallel_walker->abort == 0 )
+	{
+		if( ( internal_parallel_walker->queued_listings != NULL )
+		 && ( internal_parallel_walker->buffered_size < internal_parallel_walker->maximum_buffer_size ) )
+		{
+			*listing = internal_parallel_walker->queued_listings;
+
+			libcdirectory_internal_parallel_walker_unqueue_listing(
+			 internal_parallel_walker,
+			 *listing );
+
+			( *listing )->state = LIBCDIRECTORY_LISTING_STATE_READING;
+
+			result = 1;
+
+			break;
+		}
+		if( libcdirectory_internal_parallel_walker_wait(
+		     internal_parallel_walker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for listing.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Acquires a listing to pass its entries to the callback
+ * The listing is read by the calling thread if no other thread started reading it,
+ * which ensures progress regardless of the maximum buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_acquire_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_parallel_walker_acquire_listing";
+	int read_listing      = 0;
+	int result            = 1;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( listing->state == LIBCDIRECTORY_LISTING_STATE_READING )
+	{
+		if( internal_parallel_walker->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: walk was aborted.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( libcdirectory_internal_parallel_walker_wait(
+		     internal_parallel_walker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for listing.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( listing->state == LIBCDIRECTORY_LISTING_STATE_QUEUED )
+	{
+		libcdirectory_internal_parallel_walker_unqueue_listing(
+		 internal_parallel_walker,
+		 listing );
+
+		listing->state = LIBCDIRECTORY_LISTING_STATE_READING;
+
+		read_listing = 1;
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( ( result == 1 )
+	 && ( read_listing != 0 ) )
+	{
+		if( libcdirectory_internal_parallel_walker_process_listing(
+		     internal_parallel_walker,
+		     thread_context,
+		     listing,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to process listing.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( listing->state == LIBCDIRECTORY_LISTING_STATE_FAILED ) )
+	{
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = listing->error;
+
+			listing->error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory: %s.",
+		 function,
+		 listing->path );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Releases a listing and the listings of its subdirectories that were not acquired
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_parallel_walker_release_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error )
+{
+	libcdirectory_listing_t *sub_listing = NULL;
+	static char *function                = "libcdirectory_internal_parallel_walker_release_listing";
+	int entry_index                      = 0;
+	int result                           = 1;
+
+	if( internal_parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *listing == NULL )
+	{
+		return( 1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcdirectory_threads_mutex_grab(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* A listing that is being read cannot be freed until the reading thread is done with it
+	 */
+	while( ( *listing )->state == LIBCDIRECTORY_LISTING_STATE_READING )
+	{
+		if( libcdirectory_internal_parallel_walker_wait(
+		     internal_parallel_walker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for listing.",
+			 function );
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+			libcdirectory_threads_mutex_release(
+			 &( internal_parallel_walker->mutex ),
+			 NULL );
+#endif
+			return( -1 );
+		}
+	}
+	if( ( *listing )->state == LIBCDIRECTORY_LISTING_STATE_QUEUED )
+	{
+		libcdirectory_internal_parallel_walker_unqueue_listing(
+		 internal_parallel_walker,
+		 *listing );
+	}
+	/* The buffered size is only updated while holding the mutex and after the reading thread is done with the listing
+	 */
+	internal_parallel_walker->buffered_size -= ( *listing )->buffered_size;
+
+	( *listing )->buffered_size = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	/* Wake the threads that are waiting for the buffered size to decrease
+	 */
+	if( internal_parallel_walker->number_of_waiting_threads > 0 )
+	{
+		if( libcdirectory_threads_condition_broadcast(
+		     &( internal_parallel_walker->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdirectory_threads_mutex_release(
+	     &( internal_parallel_walker->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	for( entry_index = 0;
+	     entry_index < ( *listing )->number_of_entries;
+	     entry_index++ )
+	{
+		sub_listing = ( *listing )->entries[ entry_index ].sub_listing;
+
+		if( sub_listing != NULL )
+		{
+			( *listing )->entries[ entry_index ].sub_listing = NULL;
+
+			if( libcdirectory_internal_parallel_walker_release_listing(
+			     internal_parallel_walker,
+			     &sub_listing,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release sub listing.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( libcdirectory_listing_free(
+	     listing,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free listing.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Runs a thread of an ordered walk
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_thread_context_run_ordered(
+     void *arguments )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	libcdirectory_listing_t *listing                                   = NULL;
+	libcdirectory_parallel_walker_thread_context_t *thread_context     = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_thread_context_run_ordered";
+	int result                                                         = 0;
+
+	thread_context = (libcdirectory_parallel_walker_thread_context_t *) arguments;
+
+	if( thread_context == NULL )
+	{
+		return( -1 );
+	}
+	internal_parallel_walker = thread_context->internal_parallel_walker;
+
+	while( 1 )
+	{
+		listing = NULL;
+
+		result = libcdirectory_internal_parallel_walker_get_listing(
+		          internal_parallel_walker,
+		          &listing,
+		          &( thread_context->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( thread_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve listing.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_internal_parallel_walker_process_listing(
+		     internal_parallel_walker,
+		     thread_context,
+		     listing,
+		     &( thread_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( thread_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to process listing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcdirectory_internal_parallel_walker_abort(
+	 internal_parallel_walker,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Walks a directory tree using multiple threads and passes the entries to the callback
+ * in the same order as a single-threaded depth-first walk
+ * The other threads read the directories ahead of the calling thread, which passes the
+ * entries to the callback. The entries of directories that were read ahead are buffered,
+ * where the size of the buffered entries is limited by the maximum buffer size. The threads
+ * wait while the buffer is full and the calling thread reads a directory itself if it was
+ * not read ahead, hence the buffer can exceed the maximum buffer size by the directories
+ * that are being passed to the callback
+ * The callback is called for every entry, except for "." and "..", from the calling thread.
+ * The directory entry is detached from the directory it was read from, hence its name and
+ * type are available but its file statistics are not. The directory entry and path are
+ * valid until the callback returns
+ * The callback returns 1 to continue, 0 to not descend into a directory or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_parallel_walker_walk_ordered(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     const char *path,
+     int (*callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker = NULL;
+	libcdirectory_listing_entry_t *listing_entry                       = NULL;
+	libcdirectory_listing_t *listing                                   = NULL;
+	libcdirectory_listing_t *parent_listing                            = NULL;
+	libcdirectory_listing_t *sub_listing                               = NULL;
+	libcdirectory_parallel_walker_thread_context_t *thread_context     = NULL;
+	static char *function                                              = "libcdirectory_parallel_walker_walk_ordered";
+	size_t name_offset                                                 = 0;
+	size_t path_length                                                 = 0;
+	int callback_result                                                = 0;
+	int number_of_started_threads                                      = 0;
+	int result                                                         = 1;
+
+	if( parallel_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parallel_walker = (libcdirectory_internal_parallel_walker_t *) parallel_walker;
+
+	if( libcdirectory_internal_parallel_walker_initialize_walk(
+	     internal_parallel_walker,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize walk.",
+		 function );
+
+		return( -1 );
+	}
+	thread_context = &( internal_parallel_walker->thread_contexts[ 0 ] );
+
+	/* The listing of the walked directory is queued before the threads are started
+	 */
+	if( libcdirectory_listing_initialize(
+	     &listing,
+	     NULL,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create listing.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		libcdirectory_internal_parallel_walker_queue_listing(
+		 internal_parallel_walker,
+		 listing );
+
+		number_of_started_threads = libcdirectory_internal_parallel_walker_start_threads(
+		                             internal_parallel_walker,
+		                             &libcdirectory_parallel_walker_thread_context_run_ordered );
+
+		if( libcdirectory_internal_parallel_walker_acquire_listing(
+		     internal_parallel_walker,
+		     thread_context,
+		     listing,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire listing.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The listings that are being passed to the callback are linked by their parent listing
+	 */
+	while( ( result == 1 )
+	    && ( listing != NULL ) )
+	{
+		if( listing->entry_index >= listing->number_of_entries )
+		{
+			parent_listing = listing->parent_listing;
+
+			if( libcdirectory_internal_parallel_walker_release_listing(
+			     internal_parallel_walker,
+			     &listing,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release listing.",
+				 function );
+
+				result = -1;
+			}
+			listing = parent_listing;
+
+			continue;
+		}
+		listing_entry = &( listing->entries[ listing->entry_index ] );
+
+		listing->entry_index += 1;
+
+		name_offset = internal_parallel_walker->root_path_length;
+
+		if( listing->path_length > 0 )
+		{
+			if( libcdirectory_parallel_walker_thread_context_set_path(
+			     thread_context,
+			     name_offset,
+			     listing->path,
+			     listing->path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set path.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			name_offset += listing->path_length + 1;
+		}
+		if( libcdirectory_parallel_walker_thread_context_set_path(
+		     thread_context,
+		     name_offset,
+		     &( listing->names[ listing_entry->name_offset ] ),
+		     listing_entry->name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( listing->path_length > 0 )
+		{
+			thread_context->path[ name_offset - 1 ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+		}
+		path_length = name_offset + listing_entry->name_length - internal_parallel_walker->root_path_length;
+
+		callback_result = 1;
+
+		if( callback != NULL )
+		{
+			if( libcdirectory_internal_directory_entry_set_detached_values(
+			     (libcdirectory_internal_directory_entry_t *) thread_context->directory_entry,
+			     &( listing->names[ listing_entry->name_offset ] ),
+			     listing_entry->name_length,
+			     listing_entry->attributes,
+			     listing_entry->inode_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set directory entry values.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			callback_result = callback(
+			                   thread_context->directory_entry,
+			                   &( thread_context->path[ internal_parallel_walker->root_path_length ] ),
+			                   path_length,
+			                   listing->depth + 1,
+			                   callback_data,
+			                   error );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback failed for entry: %s.",
+				 function,
+				 &( thread_context->path[ internal_parallel_walker->root_path_length ] ) );
+
+				result = -1;
+
+				break;
+			}
+		}
+		sub_listing = listing_entry->sub_listing;
+
+		if( sub_listing == NULL )
+		{
+			continue;
+		}
+		listing_entry->sub_listing = NULL;
+
+		if( callback_result == 0 )
+		{
+			if( libcdirectory_internal_parallel_walker_release_listing(
+			     internal_parallel_walker,
+			     &sub_listing,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release sub listing.",
+				 function );
+
+				result = -1;
+			}
+			continue;
+		}
+		sub_listing->parent_listing = listing;
+
+		listing = sub_listing;
+
+		if( libcdirectory_internal_parallel_walker_acquire_listing(
+		     internal_parallel_walker,
+		     thread_context,
+		     listing,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire listing.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The threads are stopped before the remaining listings are released
+	 */
+	libcdirectory_internal_parallel_walker_abort(
+	 internal_parallel_walker,
+	 NULL );
+
+	if( libcdirectory_internal_parallel_walker_join_threads(
+	     internal_parallel_walker,
+	     number_of_started_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join threads.",
+		 function );
+
+		result = -1;
+	}
+	while( listing != NULL )
+	{
+		parent_listing = listing->parent_listing;
+
+		if( libcdirectory_internal_parallel_walker_release_listing(
+		     internal_parallel_walker,
+		     &listing,
+		     NULL ) != 1 )
+		{
+			libcdirectory_listing_free(
+			 &listing,
+			 NULL );
+		}
+		listing = parent_listing;
+	}
+	if( libcdirectory_internal_parallel_walker_finalize_walk(
+	     internal_parallel_walker,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk directory: %s.",
+		 function,
+		 path );
+	}
+	return( result );
+}
+
@@ -0,0 +1,436 @@
+/*
+ * Parallel walker functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_PARALLEL_WALKER_H )
+#define _LIBCDIRECTORY_PARALLEL_WALKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_extern.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_listing.h"
+#include "libcdirectory_threads.h"
+#include "libcdirectory_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default and maximum number of threads
+ */
+#define LIBCDIRECTORY_PARALLEL_WALKER_DEFAULT_NUMBER_OF_THREADS		4
+#define LIBCDIRECTORY_PARALLEL_WALKER_MAXIMUM_NUMBER_OF_THREADS		256
+
+/* The initial number of items of a deque, which must be a power of 2
+ */
+#define LIBCDIRECTORY_PARALLEL_WALKER_INITIAL_NUMBER_OF_ITEMS		64
+
+/* The default maximum size of the listings that are read ahead by an ordered walk
+ */
+#define LIBCDIRECTORY_PARALLEL_WALKER_DEFAULT_MAXIMUM_BUFFER_SIZE	( 32 * 1024 * 1024 )
+
+typedef struct libcdirectory_parallel_walker_item libcdirectory_parallel_walker_item_t;
+
+struct libcdirectory_parallel_walker_item
+{
+	/* The relative path of the directory
+	 */
+	char *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The depth of the directory, where the walked directory has depth 0
+	 */
+	int depth;
+};
+
+typedef struct libcdirectory_parallel_walker_deque libcdirectory_parallel_walker_deque_t;
+
+struct libcdirectory_parallel_walker_deque
+{
+	/* The items, which are stored in a ring buffer
+	 */
+	libcdirectory_parallel_walker_item_t *items;
+
+	/* The number of allocated items, which is a power of 2
+	 */
+	int number_of_allocated_items;
+
+	/* The index of the first item
+	 */
+	int first_item_index;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcdirectory_threads_mutex_t mutex;
+#endif
+};
+
+typedef struct libcdirectory_internal_parallel_walker libcdirectory_internal_parallel_walker_t;
+
+typedef struct libcdirectory_parallel_walker_thread_context libcdirectory_parallel_walker_thread_context_t;
+
+struct libcdirectory_parallel_walker_thread_context
+{
+	/* The parallel walker
+	 */
+	libcdirectory_internal_parallel_walker_t *internal_parallel_walker;
+
+	/* The thread index
+	 */
+	int thread_index;
+
+	/* The deque of directories that are not yet read
+	 */
+	libcdirectory_parallel_walker_deque_t deque;
+
+	/* The directory, which is reused for every directory read by the thread
+	 */
+	libcdirectory_directory_t *directory;
+
+	/* The directory entry, which is reused for every entry read by the thread
+	 */
+	libcdirectory_directory_entry_t *directory_entry;
+
+	/* The path, which contains the path of the walked directory followed by the relative path
+	 */
+	char *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The error of the thread
+	 */
+	libcerror_error_t *error;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcdirectory_threads_thread_t thread;
+#endif
+};
+
+struct libcdirectory_internal_parallel_walker
+{
+	/* The read buffer size of the directories
+	 */
+	size_t read_buffer_size;
+
+	/* The maximum depth, where 0 represents no maximum
+	 */
+	int maximum_depth;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The thread contexts of the walk
+	 */
+	libcdirectory_parallel_walker_thread_context_t *thread_contexts;
+
+	/* The number of thread contexts
+	 */
+	int number_of_thread_contexts;
+
+	/* The path of the walked directory
+	 */
+	const char *root_path;
+
+	/* The length of the path of the walked directory in the thread context path, including the path separator
+	 */
+	size_t root_path_length;
+
+	/* The entry callback
+	 */
+	int (*callback)(
+	       libcdirectory_directory_entry_t *directory_entry,
+	       const char *path,
+	       size_t path_length,
+	       int depth,
+	       int thread_index,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The entry callback data
+	 */
+	void *callback_data;
+
+	/* The number of directories that are queued or being read
+	 */
+	int number_of_pending_items;
+
+	/* The number of directories that are queued
+	 */
+	int number_of_queued_items;
+
+	/* The number of threads that are waiting for a directory
+	 */
+	int number_of_waiting_threads;
+
+	/* Value to indicate the walk was aborted
+	 */
+	uint8_t abort;
+
+	/* The maximum size of the listings that are read ahead by an ordered walk
+	 */
+	size_t maximum_buffer_size;
+
+	/* The size of the listings that are read and not yet released
+	 */
+	size_t buffered_size;
+
+	/* The listings that are queued, where the first listing is read first
+	 */
+	libcdirectory_listing_t *queued_listings;
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the counters
+	 */
+	libcdirectory_threads_mutex_t mutex;
+
+	/* The condition that is signalled when a directory is queued or the walk is finished
+	 */
+	libcdirectory_threads_condition_t condition;
+#endif
+};
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_initialize(
+     libcdirectory_parallel_walker_t **parallel_walker,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_free(
+     libcdirectory_parallel_walker_t **parallel_walker,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_set_number_of_threads(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_set_read_buffer_size(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     size_t read_buffer_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_set_maximum_depth(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     int maximum_depth,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_set_maximum_buffer_size(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     size_t maximum_buffer_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_set_flags(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_deque_initialize(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_deque_free(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_deque_push_back(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_deque_pop_back(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_deque_pop_front(
+     libcdirectory_parallel_walker_deque_t *deque,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_thread_context_initialize(
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     int thread_index,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_thread_context_free(
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_thread_context_set_path(
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     size_t path_offset,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_push_item(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     const char *path,
+     size_t path_length,
+     int depth,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_get_item(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_finish_item(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_abort(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_read_directory(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_parallel_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_thread_context_run(
+     void *arguments );
+
+int libcdirectory_internal_parallel_walker_initialize_walk(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     const char *path,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_start_threads(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     int (*start_function)(
+            void *arguments ) );
+
+int libcdirectory_internal_parallel_walker_join_threads(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     int number_of_started_threads,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_finalize_walk(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_walk(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     const char *path,
+     int (*callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            int thread_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+void libcdirectory_internal_parallel_walker_queue_listing(
+      libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+      libcdirectory_listing_t *listing );
+
+void libcdirectory_internal_parallel_walker_unqueue_listing(
+      libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+      libcdirectory_listing_t *listing );
+
+int libcdirectory_internal_parallel_walker_wait(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_read_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_process_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_get_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_acquire_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_parallel_walker_thread_context_t *thread_context,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_parallel_walker_release_listing(
+     libcdirectory_internal_parallel_walker_t *internal_parallel_walker,
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error );
+
+int libcdirectory_parallel_walker_thread_context_run_ordered(
+     void *arguments );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_parallel_walker_walk_ordered(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     const char *path,
+     int (*callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_PARALLEL_WALKER_H ) */
+
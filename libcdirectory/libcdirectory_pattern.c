@@ -0,0 +1,427 @@
+/*
+ * Pattern functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_pattern.h"
+
+/* Creates a pattern
+ * Make sure the value pattern is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_pattern_initialize(
+     libcdirectory_pattern_t **pattern,
+     const char *pattern_string,
+     size_t pattern_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_pattern_initialize";
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pattern != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pattern value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*pattern = memory_allocate_structure(
+	            libcdirectory_pattern_t );
+
+	if( *pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_pattern_compile(
+	     *pattern,
+	     pattern_string,
+	     pattern_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to compile pattern.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *pattern != NULL )
+	{
+		memory_free(
+		 *pattern );
+
+		*pattern = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_pattern_free(
+     libcdirectory_pattern_t **pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_pattern_free";
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pattern != NULL )
+	{
+		memory_free(
+		 *pattern );
+
+		*pattern = NULL;
+	}
+	return( 1 );
+}
+
+/* Compiles a pattern
+ * The pattern string uses the fnmatch syntax without flags:
+ * '*' matches any string, '?' matches any byte, '[...]' matches a byte in
+ * the set, where '!' or '^' negates the set and '-' denotes a range, and
+ * '\' escapes the next character. An unterminated '[' matches itself.
+ *
+ * Every single byte element is stored as a bit in the element masks of the
+ * byte values it matches, so that a name is matched by a fixed number of
+ * operations per byte, without backtracking
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_pattern_compile(
+     libcdirectory_pattern_t *pattern,
+     const char *pattern_string,
+     size_t pattern_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t class_bitmap[ 32 ];
+
+	static char *function      = "libcdirectory_pattern_compile";
+	size_t class_index         = 0;
+	size_t class_start_index   = 0;
+	size_t string_index        = 0;
+	uint64_t element_bit       = 0;
+	uint16_t byte_value        = 0;
+	uint8_t class_is_negated   = 0;
+	uint8_t class_is_set       = 0;
+	uint8_t first_byte_value   = 0;
+	uint8_t last_byte_value    = 0;
+	uint8_t pattern_byte_value = 0;
+	int previous_is_any_string = 0;
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern string.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid pattern string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     pattern,
+	     0,
+	     sizeof( libcdirectory_pattern_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pattern.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_index < pattern_string_length )
+	{
+		pattern_byte_value = (uint8_t) pattern_string[ string_index++ ];
+
+		/* Consecutive any string elements are equivalent to a single one
+		 */
+		if( ( pattern_byte_value == (uint8_t) '*' )
+		 && ( previous_is_any_string != 0 ) )
+		{
+			continue;
+		}
+		if( pattern->number_of_elements >= LIBCDIRECTORY_PATTERN_MAXIMUM_NUMBER_OF_ELEMENTS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid pattern string - number of elements value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		element_bit = (uint64_t) 1 << pattern->number_of_elements;
+
+		pattern->number_of_elements += 1;
+
+		if( pattern_byte_value == (uint8_t) '*' )
+		{
+			pattern->any_string_mask |= element_bit;
+			previous_is_any_string    = 1;
+
+			continue;
+		}
+		previous_is_any_string = 0;
+
+		pattern->minimum_name_length += 1;
+
+		if( pattern_byte_value == (uint8_t) '?' )
+		{
+			for( byte_value = 0;
+			     byte_value < 256;
+			     byte_value++ )
+			{
+				pattern->byte_masks[ byte_value ] |= element_bit;
+			}
+			continue;
+		}
+		class_is_set = 0;
+
+		if( pattern_byte_value == (uint8_t) '[' )
+		{
+			if( memory_set(
+			     class_bitmap,
+			     0,
+			     32 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear class bitmap.",
+				 function );
+
+				return( -1 );
+			}
+			class_index      = string_index;
+			class_is_negated = 0;
+
+			if( ( class_index < pattern_string_length )
+			 && ( ( pattern_string[ class_index ] == '!' )
+			  || ( pattern_string[ class_index ] == '^' ) ) )
+			{
+				class_is_negated = 1;
+
+				class_index++;
+			}
+			/* A ']' directly following the start of the set is part of the set
+			 */
+			class_start_index = class_index;
+
+			while( class_index < pattern_string_length )
+			{
+				first_byte_value = (uint8_t) pattern_string[ class_index ];
+
+				if( ( first_byte_value == (uint8_t) ']' )
+				 && ( class_index > class_start_index ) )
+				{
+					class_is_set = 1;
+
+					class_index++;
+
+					break;
+				}
+				if( ( first_byte_value == (uint8_t) '\\' )
+				 && ( ( class_index + 1 ) < pattern_string_length ) )
+				{
+					class_index++;
+
+					first_byte_value = (uint8_t) pattern_string[ class_index ];
+				}
+				class_index++;
+
+				last_byte_value = first_byte_value;
+
+				if( ( ( class_index + 1 ) < pattern_string_length )
+				 && ( pattern_string[ class_index ] == '-' )
+				 && ( pattern_string[ class_index + 1 ] != ']' ) )
+				{
+					class_index++;
+
+					last_byte_value = (uint8_t) pattern_string[ class_index ];
+
+					if( ( last_byte_value == (uint8_t) '\\' )
+					 && ( ( class_index + 1 ) < pattern_string_length ) )
+					{
+						class_index++;
+
+						last_byte_value = (uint8_t) pattern_string[ class_index ];
+					}
+					class_index++;
+				}
+				for( byte_value = first_byte_value;
+				     byte_value <= last_byte_value;
+				     byte_value++ )
+				{
+					class_bitmap[ byte_value >> 3 ] |= (uint8_t) ( 1 << ( byte_value & 0x07 ) );
+				}
+			}
+			if( class_is_set != 0 )
+			{
+				for( byte_value = 0;
+				     byte_value < 256;
+				     byte_value++ )
+				{
+					if( ( ( class_bitmap[ byte_value >> 3 ] >> ( byte_value & 0x07 ) ) & 0x01 ) != class_is_negated )
+					{
+						pattern->byte_masks[ byte_value ] |= element_bit;
+					}
+				}
+				string_index = class_index;
+			}
+		}
+		else if( ( pattern_byte_value == (uint8_t) '\\' )
+		      && ( string_index < pattern_string_length ) )
+		{
+			pattern_byte_value = (uint8_t) pattern_string[ string_index++ ];
+		}
+		if( class_is_set == 0 )
+		{
+			pattern->byte_masks[ pattern_byte_value ] |= element_bit;
+		}
+	}
+	/* Bit N of the match state is set if the first N elements match, an any
+	 * string element can match the empty string hence its successor is also set
+	 */
+	pattern->initial_state = 1;
+
+	if( ( pattern->any_string_mask & 1 ) != 0 )
+	{
+		pattern->initial_state |= 2;
+	}
+	pattern->final_state = (uint64_t) 1 << pattern->number_of_elements;
+
+	if( pattern->any_string_mask != 0 )
+	{
+		pattern->maximum_name_length = (size_t) SSIZE_MAX;
+	}
+	else
+	{
+		pattern->maximum_name_length = pattern->minimum_name_length;
+	}
+	return( 1 );
+}
+
+/* Determines if a name matches a pattern
+ * The pattern and name are expected to be validated by the caller
+ * Returns 1 if the name matches or 0 if not
+ */
+int libcdirectory_pattern_match(
+     const libcdirectory_pattern_t *pattern,
+     const char *name,
+     size_t name_length )
+{
+	uint64_t state    = 0;
+	size_t name_index = 0;
+
+	if( ( name_length < pattern->minimum_name_length )
+	 || ( name_length > pattern->maximum_name_length ) )
+	{
+		return( 0 );
+	}
+	state = pattern->initial_state;
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		state = ( ( state & pattern->byte_masks[ (uint8_t) name[ name_index ] ] ) << 1 )
+		      | ( state & pattern->any_string_mask );
+
+		state |= ( state & pattern->any_string_mask ) << 1;
+
+		if( state == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( state & pattern->final_state ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
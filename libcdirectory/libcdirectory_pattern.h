@@ -0,0 +1,99 @@
+/*
+ * Pattern functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_PATTERN_H )
+#define _LIBCDIRECTORY_PATTERN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of elements of a pattern, every element is represented
+ * by a bit in the match state and the final state requires an additional bit
+ */
+#define LIBCDIRECTORY_PATTERN_MAXIMUM_NUMBER_OF_ELEMENTS	63
+
+typedef struct libcdirectory_pattern libcdirectory_pattern_t;
+
+struct libcdirectory_pattern
+{
+	/* The element masks per byte value, where bit N is set if
+	 * element N is a single byte element that matches the byte value
+	 */
+	uint64_t byte_masks[ 256 ];
+
+	/* The mask of the elements that match any string
+	 */
+	uint64_t any_string_mask;
+
+	/* The initial match state
+	 */
+	uint64_t initial_state;
+
+	/* The final match state
+	 */
+	uint64_t final_state;
+
+	/* The number of elements
+	 */
+	int number_of_elements;
+
+	/* The minimum length of a matching name
+	 */
+	size_t minimum_name_length;
+
+	/* The maximum length of a matching name
+	 */
+	size_t maximum_name_length;
+};
+
+int libcdirectory_pattern_initialize(
+     libcdirectory_pattern_t **pattern,
+     const char *pattern_string,
+     size_t pattern_string_length,
+     libcerror_error_t **error );
+
+int libcdirectory_pattern_free(
+     libcdirectory_pattern_t **pattern,
+     libcerror_error_t **error );
+
+int libcdirectory_pattern_compile(
+     libcdirectory_pattern_t *pattern,
+     const char *pattern_string,
+     size_t pattern_string_length,
+     libcerror_error_t **error );
+
+int libcdirectory_pattern_match(
+     const libcdirectory_pattern_t *pattern,
+     const char *name,
+     size_t name_length );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_PATTERN_H ) */
+
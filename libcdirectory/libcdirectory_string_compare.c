@@ -0,0 +1,787 @@
+/*
+ * Caseless string compare functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libcdirectory_string_compare.h"
+#include "libcdirectory_wide_string.h"
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+#define LIBCDIRECTORY_TARGET_AVX2	__attribute__ (( __target__( "avx2" ) ))
+#endif
+
+/* Compares two narrow strings of the same length, ignoring case
+ * Blocks of characters are compared with the widest compare kernel supported
+ * by the CPU, the AVX2 kernel is selected at run-time
+ * Characters are compared with ASCII case folding, the first pair of differing
+ * characters of which either is not ASCII is passed to narrow_string_compare_no_case
+ * together with the remainder of the strings
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_narrow_no_case(
+     const char *string1,
+     const char *string2,
+     size_t string_length )
+{
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+	if( ( string_length >= 32 )
+	 && ( __builtin_cpu_supports( "avx2" ) != 0 ) )
+	{
+		return( libcdirectory_string_compare_narrow_no_case_avx2(
+		         string1,
+		         string2,
+		         string_length ) );
+	}
+#endif
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+	if( string_length >= 16 )
+	{
+		return( libcdirectory_string_compare_narrow_no_case_sse2(
+		         string1,
+		         string2,
+		         string_length ) );
+	}
+#elif defined( LIBCDIRECTORY_HAVE_NEON )
+	if( string_length >= 16 )
+	{
+		return( libcdirectory_string_compare_narrow_no_case_neon(
+		         string1,
+		         string2,
+		         string_length ) );
+	}
+#endif
+	return( libcdirectory_string_compare_narrow_no_case_scalar(
+	         string1,
+	         string2,
+	         string_length ) );
+}
+
+/* Compares two narrow strings of the same length, ignoring case, one character at a time
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_narrow_no_case_scalar(
+     const char *string1,
+     const char *string2,
+     size_t string_length )
+{
+	size_t string_index = 0;
+	uint8_t character1  = 0;
+	uint8_t character2  = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character1 = (uint8_t) string1[ string_index ];
+		character2 = (uint8_t) string2[ string_index ];
+
+		if( character1 == character2 )
+		{
+			continue;
+		}
+		if( ( character1 >= 0x80 )
+		 || ( character2 >= 0x80 ) )
+		{
+			return( narrow_string_compare_no_case(
+			         &( string1[ string_index ] ),
+			         &( string2[ string_index ] ),
+			         string_length - string_index ) );
+		}
+		if( ( character1 >= (uint8_t) 'A' )
+		 && ( character1 <= (uint8_t) 'Z' ) )
+		{
+			character1 += (uint8_t) ( 'a' - 'A' );
+		}
+		if( ( character2 >= (uint8_t) 'A' )
+		 && ( character2 <= (uint8_t) 'Z' ) )
+		{
+			character2 += (uint8_t) ( 'a' - 'A' );
+		}
+		if( character1 != character2 )
+		{
+			return( (int) character1 - (int) character2 );
+		}
+	}
+	return( 0 );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+/* Compares two narrow strings of the same length, ignoring case, 16 characters at a time
+ * The block that contains the first difference and the remaining characters
+ * are compared by the scalar kernel
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_narrow_no_case_sse2(
+     const char *string1,
+     const char *string2,
+     size_t string_length )
+{
+	__m128i block1      = _mm_setzero_si128();
+	__m128i block2      = _mm_setzero_si128();
+	__m128i case_bit    = _mm_set1_epi8( 0x20 );
+	__m128i case_mask   = _mm_setzero_si128();
+	__m128i range_bound = _mm_set1_epi8( (char) ( -128 + 26 ) );
+	__m128i range_shift = _mm_set1_epi8( (char) ( 128 - 'A' ) );
+	size_t string_index = 0;
+
+	/* The characters are shifted so that 'A' - 'Z' map onto the lowest
+	 * 26 values of a signed byte
+	 */
+	while( ( string_length - string_index ) >= 16 )
+	{
+		block1 = _mm_loadu_si128(
+		          (const __m128i *) &( string1[ string_index ] ) );
+		block2 = _mm_loadu_si128(
+		          (const __m128i *) &( string2[ string_index ] ) );
+
+		case_mask = _mm_cmplt_epi8(
+		             _mm_add_epi8(
+		              block1,
+		              range_shift ),
+		             range_bound );
+		block1 = _mm_or_si128(
+		          block1,
+		          _mm_and_si128(
+		           case_mask,
+		           case_bit ) );
+
+		case_mask = _mm_cmplt_epi8(
+		             _mm_add_epi8(
+		              block2,
+		              range_shift ),
+		             range_bound );
+		block2 = _mm_or_si128(
+		          block2,
+		          _mm_and_si128(
+		           case_mask,
+		           case_bit ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      block1,
+		      block2 ) ) != 0x0000ffff )
+		{
+			break;
+		}
+		string_index += 16;
+	}
+	return( libcdirectory_string_compare_narrow_no_case_scalar(
+	         &( string1[ string_index ] ),
+	         &( string2[ string_index ] ),
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+/* Compares two narrow strings of the same length, ignoring case, 32 characters at a time
+ * The block that contains the first difference and the remaining characters
+ * are compared by the SSE2 kernel
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+LIBCDIRECTORY_TARGET_AVX2 \
+int libcdirectory_string_compare_narrow_no_case_avx2(
+     const char *string1,
+     const char *string2,
+     size_t string_length )
+{
+	__m256i block1      = _mm256_setzero_si256();
+	__m256i block2      = _mm256_setzero_si256();
+	__m256i case_bit    = _mm256_set1_epi8( 0x20 );
+	__m256i case_mask   = _mm256_setzero_si256();
+	__m256i range_bound = _mm256_set1_epi8( (char) ( -128 + 26 ) );
+	__m256i range_shift = _mm256_set1_epi8( (char) ( 128 - 'A' ) );
+	size_t string_index = 0;
+
+	while( ( string_length - string_index ) >= 32 )
+	{
+		block1 = _mm256_loadu_si256(
+		          (const __m256i *) &( string1[ string_index ] ) );
+		block2 = _mm256_loadu_si256(
+		          (const __m256i *) &( string2[ string_index ] ) );
+
+		case_mask = _mm256_cmpgt_epi8(
+		             range_bound,
+		             _mm256_add_epi8(
+		              block1,
+		              range_shift ) );
+		block1 = _mm256_or_si256(
+		          block1,
+		          _mm256_and_si256(
+		           case_mask,
+		           case_bit ) );
+
+		case_mask = _mm256_cmpgt_epi8(
+		             range_bound,
+		             _mm256_add_epi8(
+		              block2,
+		              range_shift ) );
+		block2 = _mm256_or_si256(
+		          block2,
+		          _mm256_and_si256(
+		           case_mask,
+		           case_bit ) );
+
+		if( (uint32_t) _mm256_movemask_epi8(
+		                _mm256_cmpeq_epi8(
+		                 block1,
+		                 block2 ) ) != 0xffffffffUL )
+		{
+			break;
+		}
+		string_index += 32;
+	}
+	return( libcdirectory_string_compare_narrow_no_case_sse2(
+	         &( string1[ string_index ] ),
+	         &( string2[ string_index ] ),
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+/* Compares two narrow strings of the same length, ignoring case, 16 characters at a time
+ * The block that contains the first difference and the remaining characters
+ * are compared by the scalar kernel
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_narrow_no_case_neon(
+     const char *string1,
+     const char *string2,
+     size_t string_length )
+{
+	uint8x16_t block1      = vdupq_n_u8( 0 );
+	uint8x16_t block2      = vdupq_n_u8( 0 );
+	uint8x16_t case_bit    = vdupq_n_u8( 0x20 );
+	uint8x16_t case_mask   = vdupq_n_u8( 0 );
+	uint8x16_t range_bound = vdupq_n_u8( 26 );
+	uint8x16_t range_shift = vdupq_n_u8( (uint8_t) ( 256 - 'A' ) );
+	size_t string_index    = 0;
+
+	while( ( string_length - string_index ) >= 16 )
+	{
+		block1 = vld1q_u8(
+		          (const uint8_t *) &( string1[ string_index ] ) );
+		block2 = vld1q_u8(
+		          (const uint8_t *) &( string2[ string_index ] ) );
+
+		case_mask = vcltq_u8(
+		             vaddq_u8(
+		              block1,
+		              range_shift ),
+		             range_bound );
+		block1 = vorrq_u8(
+		          block1,
+		          vandq_u8(
+		           case_mask,
+		           case_bit ) );
+
+		case_mask = vcltq_u8(
+		             vaddq_u8(
+		              block2,
+		              range_shift ),
+		             range_bound );
+		block2 = vorrq_u8(
+		          block2,
+		          vandq_u8(
+		           case_mask,
+		           case_bit ) );
+
+		if( vminvq_u8(
+		     vceqq_u8(
+		      block1,
+		      block2 ) ) != 0xff )
+		{
+			break;
+		}
+		string_index += 16;
+	}
+	return( libcdirectory_string_compare_narrow_no_case_scalar(
+	         &( string1[ string_index ] ),
+	         &( string2[ string_index ] ),
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Compares two wide strings of the same length, ignoring case
+ * Blocks of characters are compared with the widest compare kernel supported
+ * by the CPU, the AVX2 kernel is selected at run-time
+ * Characters are compared with ASCII case folding, the first pair of differing
+ * characters of which either is not ASCII is passed to wide_string_compare_no_case
+ * together with the remainder of the strings
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_wide_no_case(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length )
+{
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+	if( ( string_length >= ( 32 / sizeof( wchar_t ) ) )
+	 && ( __builtin_cpu_supports( "avx2" ) != 0 ) )
+	{
+		return( libcdirectory_string_compare_wide_no_case_avx2(
+		         string1,
+		         string2,
+		         string_length ) );
+	}
+#endif
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+	if( string_length >= ( 16 / sizeof( wchar_t ) ) )
+	{
+		return( libcdirectory_string_compare_wide_no_case_sse2(
+		         string1,
+		         string2,
+		         string_length ) );
+	}
+#elif defined( LIBCDIRECTORY_HAVE_NEON )
+	if( string_length >= ( 16 / sizeof( wchar_t ) ) )
+	{
+		return( libcdirectory_string_compare_wide_no_case_neon(
+		         string1,
+		         string2,
+		         string_length ) );
+	}
+#endif
+	return( libcdirectory_string_compare_wide_no_case_scalar(
+	         string1,
+	         string2,
+	         string_length ) );
+}
+
+/* Compares two wide strings of the same length, ignoring case, one character at a time
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_wide_no_case_scalar(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length )
+{
+	size_t string_index = 0;
+	uint32_t character1 = 0;
+	uint32_t character2 = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character1 = (uint32_t) string1[ string_index ];
+		character2 = (uint32_t) string2[ string_index ];
+
+		if( character1 == character2 )
+		{
+			continue;
+		}
+		if( ( character1 >= 0x80 )
+		 || ( character2 >= 0x80 ) )
+		{
+			return( wide_string_compare_no_case(
+			         &( string1[ string_index ] ),
+			         &( string2[ string_index ] ),
+			         string_length - string_index ) );
+		}
+		if( ( character1 >= (uint32_t) 'A' )
+		 && ( character1 <= (uint32_t) 'Z' ) )
+		{
+			character1 += (uint32_t) ( 'a' - 'A' );
+		}
+		if( ( character2 >= (uint32_t) 'A' )
+		 && ( character2 <= (uint32_t) 'Z' ) )
+		{
+			character2 += (uint32_t) ( 'a' - 'A' );
+		}
+		if( character1 != character2 )
+		{
+			return( (int) character1 - (int) character2 );
+		}
+	}
+	return( 0 );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+/* Compares two wide strings of the same length, ignoring case, 16 bytes at a time
+ * The block that contains the first difference and the remaining characters
+ * are compared by the scalar kernel
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_wide_no_case_sse2(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length )
+{
+#if ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 )
+	__m128i block1       = _mm_setzero_si128();
+	__m128i block2       = _mm_setzero_si128();
+	__m128i case_bit     = _mm_setzero_si128();
+	__m128i case_mask    = _mm_setzero_si128();
+	__m128i lower_bound  = _mm_setzero_si128();
+	__m128i upper_bound  = _mm_setzero_si128();
+	size_t block_length  = 16 / sizeof( wchar_t );
+	size_t string_index  = 0;
+
+#if SIZEOF_WCHAR_T == 2
+	case_bit    = _mm_set1_epi16( 0x20 );
+	lower_bound = _mm_set1_epi16( 'A' - 1 );
+	upper_bound = _mm_set1_epi16( 'Z' + 1 );
+#else
+	case_bit    = _mm_set1_epi32( 0x20 );
+	lower_bound = _mm_set1_epi32( 'A' - 1 );
+	upper_bound = _mm_set1_epi32( 'Z' + 1 );
+#endif
+	/* Characters outside the signed range of the lanes are never in 'A' - 'Z'
+	 */
+	while( ( string_length - string_index ) >= block_length )
+	{
+		block1 = _mm_loadu_si128(
+		          (const __m128i *) &( string1[ string_index ] ) );
+		block2 = _mm_loadu_si128(
+		          (const __m128i *) &( string2[ string_index ] ) );
+
+#if SIZEOF_WCHAR_T == 2
+		case_mask = _mm_and_si128(
+		             _mm_cmpgt_epi16(
+		              block1,
+		              lower_bound ),
+		             _mm_cmplt_epi16(
+		              block1,
+		              upper_bound ) );
+#else
+		case_mask = _mm_and_si128(
+		             _mm_cmpgt_epi32(
+		              block1,
+		              lower_bound ),
+		             _mm_cmplt_epi32(
+		              block1,
+		              upper_bound ) );
+#endif
+		block1 = _mm_or_si128(
+		          block1,
+		          _mm_and_si128(
+		           case_mask,
+		           case_bit ) );
+
+#if SIZEOF_WCHAR_T == 2
+		case_mask = _mm_and_si128(
+		             _mm_cmpgt_epi16(
+		              block2,
+		              lower_bound ),
+		             _mm_cmplt_epi16(
+		              block2,
+		              upper_bound ) );
+#else
+		case_mask = _mm_and_si128(
+		             _mm_cmpgt_epi32(
+		              block2,
+		              lower_bound ),
+		             _mm_cmplt_epi32(
+		              block2,
+		              upper_bound ) );
+#endif
+		block2 = _mm_or_si128(
+		          block2,
+		          _mm_and_si128(
+		           case_mask,
+		           case_bit ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      block1,
+		      block2 ) ) != 0x0000ffff )
+		{
+			break;
+		}
+		string_index += block_length;
+	}
+	return( libcdirectory_string_compare_wide_no_case_scalar(
+	         &( string1[ string_index ] ),
+	         &( string2[ string_index ] ),
+	         string_length - string_index ) );
+#else
+	return( libcdirectory_string_compare_wide_no_case_scalar(
+	         string1,
+	         string2,
+	         string_length ) );
+#endif /* ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) */
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+/* Compares two wide strings of the same length, ignoring case, 32 bytes at a time
+ * The block that contains the first difference and the remaining characters
+ * are compared by the SSE2 kernel
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+LIBCDIRECTORY_TARGET_AVX2 \
+int libcdirectory_string_compare_wide_no_case_avx2(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length )
+{
+#if ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 )
+	__m256i block1       = _mm256_setzero_si256();
+	__m256i block2       = _mm256_setzero_si256();
+	__m256i case_bit     = _mm256_setzero_si256();
+	__m256i case_mask    = _mm256_setzero_si256();
+	__m256i lower_bound  = _mm256_setzero_si256();
+	__m256i upper_bound  = _mm256_setzero_si256();
+	size_t block_length  = 32 / sizeof( wchar_t );
+	size_t string_index  = 0;
+
+#if SIZEOF_WCHAR_T == 2
+	case_bit    = _mm256_set1_epi16( 0x20 );
+	lower_bound = _mm256_set1_epi16( 'A' - 1 );
+	upper_bound = _mm256_set1_epi16( 'Z' + 1 );
+#else
+	case_bit    = _mm256_set1_epi32( 0x20 );
+	lower_bound = _mm256_set1_epi32( 'A' - 1 );
+	upper_bound = _mm256_set1_epi32( 'Z' + 1 );
+#endif
+	while( ( string_length - string_index ) >= block_length )
+	{
+		block1 = _mm256_loadu_si256(
+		          (const __m256i *) &( string1[ string_index ] ) );
+		block2 = _mm256_loadu_si256(
+		          (const __m256i *) &( string2[ string_index ] ) );
+
+#if SIZEOF_WCHAR_T == 2
+		case_mask = _mm256_and_si256(
+		             _mm256_cmpgt_epi16(
+		              block1,
+		              lower_bound ),
+		             _mm256_cmpgt_epi16(
+		              upper_bound,
+		              block1 ) );
+#else
+		case_mask = _mm256_and_si256(
+		             _mm256_cmpgt_epi32(
+		              block1,
+		              lower_bound ),
+		             _mm256_cmpgt_epi32(
+		              upper_bound,
+		              block1 ) );
+#endif
+		block1 = _mm256_or_si256(
+		          block1,
+		          _mm256_and_si256(
+		           case_mask,
+		           case_bit ) );
+
+#if SIZEOF_WCHAR_T == 2
+		case_mask = _mm256_and_si256(
+		             _mm256_cmpgt_epi16(
+		              block2,
+		              lower_bound ),
+		             _mm256_cmpgt_epi16(
+		              upper_bound,
+		              block2 ) );
+#else
+		case_mask = _mm256_and_si256(
+		             _mm256_cmpgt_epi32(
+		              block2,
+		              lower_bound ),
+		             _mm256_cmpgt_epi32(
+		              upper_bound,
+		              block2 ) );
+#endif
+		block2 = _mm256_or_si256(
+		          block2,
+		          _mm256_and_si256(
+		           case_mask,
+		           case_bit ) );
+
+		if( (uint32_t) _mm256_movemask_epi8(
+		                _mm256_cmpeq_epi8(
+		                 block1,
+		                 block2 ) ) != 0xffffffffUL )
+		{
+			break;
+		}
+		string_index += block_length;
+	}
+	return( libcdirectory_string_compare_wide_no_case_sse2(
+	         &( string1[ string_index ] ),
+	         &( string2[ string_index ] ),
+	         string_length - string_index ) );
+#else
+	return( libcdirectory_string_compare_wide_no_case_scalar(
+	         string1,
+	         string2,
+	         string_length ) );
+#endif /* ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) */
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+/* Compares two wide strings of the same length, ignoring case, 16 bytes at a time
+ * The block that contains the first difference and the remaining characters
+ * are compared by the scalar kernel
+ * Returns 0 if the strings are equal, less than zero if string1 is less than string2
+ * or greater than zero if string1 is greater than string2
+ */
+int libcdirectory_string_compare_wide_no_case_neon(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length )
+{
+#if SIZEOF_WCHAR_T == 2
+	uint16x8_t block1      = vdupq_n_u16( 0 );
+	uint16x8_t block2      = vdupq_n_u16( 0 );
+	uint16x8_t case_bit    = vdupq_n_u16( 0x20 );
+	uint16x8_t case_mask   = vdupq_n_u16( 0 );
+	uint16x8_t range_bound = vdupq_n_u16( 26 );
+	uint16x8_t range_start = vdupq_n_u16( 'A' );
+	size_t block_length    = 8;
+#elif SIZEOF_WCHAR_T == 4
+	uint32x4_t block1      = vdupq_n_u32( 0 );
+	uint32x4_t block2      = vdupq_n_u32( 0 );
+	uint32x4_t case_bit    = vdupq_n_u32( 0x20 );
+	uint32x4_t case_mask   = vdupq_n_u32( 0 );
+	uint32x4_t range_bound = vdupq_n_u32( 26 );
+	uint32x4_t range_start = vdupq_n_u32( 'A' );
+	size_t block_length    = 4;
+#endif
+	size_t string_index    = 0;
+
+#if ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 )
+	/* Characters below 'A' wrap around and are never in range
+	 */
+	while( ( string_length - string_index ) >= block_length )
+	{
+#if SIZEOF_WCHAR_T == 2
+		block1 = vld1q_u16(
+		          (const uint16_t *) &( string1[ string_index ] ) );
+		block2 = vld1q_u16(
+		          (const uint16_t *) &( string2[ string_index ] ) );
+
+		case_mask = vcltq_u16(
+		             vsubq_u16(
+		              block1,
+		              range_start ),
+		             range_bound );
+		block1 = vorrq_u16(
+		          block1,
+		          vandq_u16(
+		           case_mask,
+		           case_bit ) );
+
+		case_mask = vcltq_u16(
+		             vsubq_u16(
+		              block2,
+		              range_start ),
+		             range_bound );
+		block2 = vorrq_u16(
+		          block2,
+		          vandq_u16(
+		           case_mask,
+		           case_bit ) );
+
+		if( vminvq_u16(
+		     vceqq_u16(
+		      block1,
+		      block2 ) ) != 0xffff )
+		{
+			break;
+		}
+#else
+		block1 = vld1q_u32(
+		          (const uint32_t *) &( string1[ string_index ] ) );
+		block2 = vld1q_u32(
+		          (const uint32_t *) &( string2[ string_index ] ) );
+
+		case_mask = vcltq_u32(
+		             vsubq_u32(
+		              block1,
+		              range_start ),
+		             range_bound );
+		block1 = vorrq_u32(
+		          block1,
+		          vandq_u32(
+		           case_mask,
+		           case_bit ) );
+
+		case_mask = vcltq_u32(
+		             vsubq_u32(
+		              block2,
+		              range_start ),
+		             range_bound );
+		block2 = vorrq_u32(
+		          block2,
+		          vandq_u32(
+		           case_mask,
+		           case_bit ) );
+
+		if( vminvq_u32(
+		     vceqq_u32(
+		      block1,
+		      block2 ) ) != 0xffffffffUL )
+		{
+			break;
+		}
+#endif
+		string_index += block_length;
+	}
+#endif /* ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) */
+
+	return( libcdirectory_string_compare_wide_no_case_scalar(
+	         &( string1[ string_index ] ),
+	         &( string2[ string_index ] ),
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
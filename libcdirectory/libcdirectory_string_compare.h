@@ -0,0 +1,136 @@
+/*
+ * Caseless string compare functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_STRING_COMPARE_H )
+#define _LIBCDIRECTORY_STRING_COMPARE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SIMD compare kernels can be disabled to force the scalar code path
+ */
+#if !defined( LIBCDIRECTORY_DISABLE_SIMD )
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBCDIRECTORY_HAVE_SSE2	1
+#endif
+
+/* The AVX2 compare kernels are selected at run-time and require compiler
+ * support for the target function attribute and __builtin_cpu_supports
+ */
+#if defined( LIBCDIRECTORY_HAVE_SSE2 ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) )
+#define LIBCDIRECTORY_HAVE_AVX2	1
+#endif
+
+#if defined( __aarch64__ ) && defined( __ARM_NEON )
+#define LIBCDIRECTORY_HAVE_NEON	1
+#endif
+
+#endif /* !defined( LIBCDIRECTORY_DISABLE_SIMD ) */
+
+int libcdirectory_string_compare_narrow_no_case(
+     const char *string1,
+     const char *string2,
+     size_t string_length );
+
+int libcdirectory_string_compare_narrow_no_case_scalar(
+     const char *string1,
+     const char *string2,
+     size_t string_length );
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+int libcdirectory_string_compare_narrow_no_case_sse2(
+     const char *string1,
+     const char *string2,
+     size_t string_length );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+int libcdirectory_string_compare_narrow_no_case_avx2(
+     const char *string1,
+     const char *string2,
+     size_t string_length );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+int libcdirectory_string_compare_narrow_no_case_neon(
+     const char *string1,
+     const char *string2,
+     size_t string_length );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libcdirectory_string_compare_wide_no_case(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length );
+
+int libcdirectory_string_compare_wide_no_case_scalar(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length );
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+int libcdirectory_string_compare_wide_no_case_sse2(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+int libcdirectory_string_compare_wide_no_case_avx2(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+int libcdirectory_string_compare_wide_no_case_neon(
+     const wchar_t *string1,
+     const wchar_t *string2,
+     size_t string_length );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_STRING_COMPARE_H ) */
+
@@ -0,0 +1,699 @@
+/*
+ * Thread functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_threads.h"
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+
+/* Initializes a mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_mutex_initialize(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_mutex_initialize";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	InitializeCriticalSection(
+	 mutex );
+#else
+	pthread_result = pthread_mutex_init(
+	                  mutex,
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 pthread_result,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Frees a mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_mutex_free(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_mutex_free";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	DeleteCriticalSection(
+	 mutex );
+#else
+	pthread_result = pthread_mutex_destroy(
+	                  mutex );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 pthread_result,
+		 "%s: unable to destroy mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Grabs a mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_mutex_grab(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_mutex_grab";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	EnterCriticalSection(
+	 mutex );
+#else
+	pthread_result = pthread_mutex_lock(
+	                  mutex );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 pthread_result,
+		 "%s: unable to lock mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_mutex_release(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_mutex_release";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	LeaveCriticalSection(
+	 mutex );
+#else
+	pthread_result = pthread_mutex_unlock(
+	                  mutex );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 pthread_result,
+		 "%s: unable to unlock mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Initializes a condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_condition_initialize(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_condition_initialize";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	InitializeConditionVariable(
+	 condition );
+#else
+	pthread_result = pthread_cond_init(
+	                  condition,
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 pthread_result,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Frees a condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_condition_free(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_condition_free";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI )
+	/* A Windows condition variable does not need to be freed
+	 */
+	pthread_result = pthread_cond_destroy(
+	                  condition );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 pthread_result,
+		 "%s: unable to destroy condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Wakes all threads that are waiting on a condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_condition_broadcast(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_condition_broadcast";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	WakeAllConditionVariable(
+	 condition );
+#else
+	pthread_result = pthread_cond_broadcast(
+	                  condition );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 pthread_result,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Wakes a single thread that is waiting on a condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_condition_signal(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_condition_signal";
+
+#if !defined( WINAPI )
+	int pthread_result    = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	WakeConditionVariable(
+	 condition );
+#else
+	pthread_result = pthread_cond_signal(
+	                  condition );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 pthread_result,
+		 "%s: unable to signal condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits on a condition
+ * The mutex must be grabbed by the calling thread and is released while waiting
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_condition_wait(
+     libcdirectory_threads_condition_t *condition,
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_condition_wait";
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#else
+	int pthread_result    = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( SleepConditionVariableCS(
+	     condition,
+	     mutex,
+	     INFINITE ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	pthread_result = pthread_cond_wait(
+	                  condition,
+	                  mutex );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 pthread_result,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Calls the start function of a thread
+ * Returns 0
+ */
+DWORD WINAPI libcdirectory_threads_thread_start_function_helper(
+              LPVOID arguments )
+{
+	libcdirectory_threads_thread_t *thread = NULL;
+
+	thread = (libcdirectory_threads_thread_t *) arguments;
+
+	if( thread != NULL )
+	{
+		thread->result = thread->start_function(
+		                  thread->arguments );
+	}
+	return( 0 );
+}
+
+#else
+
+/* Calls the start function of a thread
+ * Returns NULL
+ */
+void *libcdirectory_threads_thread_start_function_helper(
+       void *arguments )
+{
+	libcdirectory_threads_thread_t *thread = NULL;
+
+	thread = (libcdirectory_threads_thread_t *) arguments;
+
+	if( thread != NULL )
+	{
+		thread->result = thread->start_function(
+		                  thread->arguments );
+	}
+	return( NULL );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Creates a thread that runs the start function
+ * The thread must remain valid until it is joined
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_thread_create(
+     libcdirectory_threads_thread_t *thread,
+     int (*start_function)(
+            void *arguments ),
+     void *arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_thread_create";
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#else
+	int pthread_result    = 0;
+#endif
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start function.",
+		 function );
+
+		return( -1 );
+	}
+	thread->start_function = start_function;
+	thread->arguments      = arguments;
+	thread->result         = -1;
+
+#if defined( WINAPI )
+	thread->handle = CreateThread(
+	                  NULL,
+	                  0,
+	                  &libcdirectory_threads_thread_start_function_helper,
+	                  (LPVOID) thread,
+	                  0,
+	                  NULL );
+
+	if( thread->handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 error_code,
+		 "%s: unable to create thread.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	pthread_result = pthread_create(
+	                  &( thread->thread ),
+	                  NULL,
+	                  &libcdirectory_threads_thread_start_function_helper,
+	                  (void *) thread );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 pthread_result,
+		 "%s: unable to create thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits for a thread to finish
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_threads_thread_join(
+     libcdirectory_threads_thread_t *thread,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_threads_thread_join";
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#else
+	int pthread_result    = 0;
+#endif
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( WaitForSingleObject(
+	     thread->handle,
+	     INFINITE ) == WAIT_FAILED )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to join thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( CloseHandle(
+	     thread->handle ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 error_code,
+		 "%s: unable to close thread handle.",
+		 function );
+
+		return( -1 );
+	}
+	thread->handle = NULL;
+#else
+	pthread_result = pthread_join(
+	                  thread->thread,
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 pthread_result,
+		 "%s: unable to join thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT ) */
+
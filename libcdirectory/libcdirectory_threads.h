@@ -0,0 +1,155 @@
+/*
+ * Thread functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_THREADS_H )
+#define _LIBCDIRECTORY_THREADS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+#include <windows.h>
+
+#elif !defined( WINAPI ) && defined( HAVE_PTHREAD_H ) && defined( HAVE_PTHREAD_CREATE )
+#include <pthread.h>
+
+#endif
+
+#include "libcdirectory_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Condition variables are only available on Windows Vista and later
+ */
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+#define LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT
+
+typedef CRITICAL_SECTION libcdirectory_threads_mutex_t;
+typedef CONDITION_VARIABLE libcdirectory_threads_condition_t;
+
+#elif !defined( WINAPI ) && defined( HAVE_PTHREAD_H ) && defined( HAVE_PTHREAD_CREATE )
+#define LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT
+
+typedef pthread_mutex_t libcdirectory_threads_mutex_t;
+typedef pthread_cond_t libcdirectory_threads_condition_t;
+
+#endif
+
+#if defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcdirectory_threads_thread libcdirectory_threads_thread_t;
+
+struct libcdirectory_threads_thread
+{
+#if defined( WINAPI )
+	/* The thread handle
+	 */
+	HANDLE handle;
+#else
+	/* The thread
+	 */
+	pthread_t thread;
+#endif
+
+	/* The start function
+	 */
+	int (*start_function)(
+	       void *arguments );
+
+	/* The start function arguments
+	 */
+	void *arguments;
+
+	/* The start function result
+	 */
+	int result;
+};
+
+int libcdirectory_threads_mutex_initialize(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_mutex_free(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_mutex_grab(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_mutex_release(
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_condition_initialize(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_condition_free(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_condition_broadcast(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_condition_signal(
+     libcdirectory_threads_condition_t *condition,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_condition_wait(
+     libcdirectory_threads_condition_t *condition,
+     libcdirectory_threads_mutex_t *mutex,
+     libcerror_error_t **error );
+
+#if defined( WINAPI )
+
+DWORD WINAPI libcdirectory_threads_thread_start_function_helper(
+              LPVOID arguments );
+
+#else
+
+void *libcdirectory_threads_thread_start_function_helper(
+       void *arguments );
+
+#endif /* defined( WINAPI ) */
+
+int libcdirectory_threads_thread_create(
+     libcdirectory_threads_thread_t *thread,
+     int (*start_function)(
+            void *arguments ),
+     void *arguments,
+     libcerror_error_t **error );
+
+int libcdirectory_threads_thread_join(
+     libcdirectory_threads_thread_t *thread,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_THREADS_H ) */
+
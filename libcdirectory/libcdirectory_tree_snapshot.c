@@ -0,0 +1,3274 @@
+/*
+ * Tree snapshot functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if !defined( WINAPI )
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#endif /* !defined( WINAPI ) */
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC	0
+#endif
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_tree_snapshot.h"
+#include "libcdirectory_types.h"
+#include "libcdirectory_walker.h"
+
+/* The tree snapshot data is stored in little-endian as:
+ * offset  0, size 4: the signature "cdsn"
+ * offset  4, size 4: the format version
+ * offset  8, size 4: the number of records
+ * offset 12, size 4: the number of directories
+ * offset 16, size 4: the maximum path size
+ * offset 20, size 4: reserved
+ * offset 24, size 8: the size of the front coded paths
+ *
+ * followed by the records, where every record is stored as:
+ * offset  0, size 8: the size
+ * offset  8, size 8: the modification time
+ * offset 16, size 8: the inode number
+ * offset 24, size 4: the index of the parent directory or 0xffffffff for none
+ * offset 28, size 1: the type
+ * offset 29, size 3: reserved
+ *
+ * followed by the offsets of the front coded paths of every block of 16 records,
+ * where every offset is stored as:
+ * offset  0, size 8: the offset of the path of the first record of the block
+ *
+ * followed by the directories, where every directory is stored as:
+ * offset  0, size 4: the index of the record of the directory
+ * offset  4, size 4: the index of the record of the first entry
+ * offset  8, size 4: the number of entries
+ *
+ * followed by the front coded paths, where every path is stored as:
+ * offset  0, size 2: the length of the prefix that is shared with the path of the previous record
+ * offset  2, size 2: the length of the suffix
+ * offset  4, size  : the suffix
+ *
+ * The first record is the directory of the tree and the records are stored in breadth-first
+ * order, where the entries of a directory are stored consecutively and sorted by name. The
+ * directories are stored in the order of their records. The paths are relative to the
+ * directory of the tree and the first path of every block does not share a prefix
+ */
+static const uint8_t libcdirectory_tree_snapshot_signature[ 4 ] = {
+	'c', 'd', 's', 'n' };
+
+/* Creates a tree snapshot
+ * Make sure the value tree_snapshot is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_initialize(
+     libcdirectory_tree_snapshot_t **tree_snapshot,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_initialize";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_snapshot != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree snapshot value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = memory_allocate_structure(
+	                          libcdirectory_internal_tree_snapshot_t );
+
+	if( internal_tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tree snapshot.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_tree_snapshot,
+	     0,
+	     sizeof( libcdirectory_internal_tree_snapshot_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree snapshot.",
+		 function );
+
+		goto on_error;
+	}
+	*tree_snapshot = (libcdirectory_tree_snapshot_t *) internal_tree_snapshot;
+
+	return( 1 );
+
+on_error:
+	if( internal_tree_snapshot != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot );
+	}
+	return( -1 );
+}
+
+/* Frees a tree snapshot
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_free(
+     libcdirectory_tree_snapshot_t **tree_snapshot,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_free";
+	int result                                                     = 1;
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_snapshot != NULL )
+	{
+		internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) *tree_snapshot;
+		*tree_snapshot         = NULL;
+
+		if( libcdirectory_internal_tree_snapshot_clear(
+		     internal_tree_snapshot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear tree snapshot.",
+			 function );
+
+			result = -1;
+		}
+		libcdirectory_internal_tree_snapshot_free_build_values(
+		 internal_tree_snapshot );
+
+		memory_free(
+		 internal_tree_snapshot );
+	}
+	return( result );
+}
+
+/* Clears a tree snapshot
+ * The data that was built is freed, the data that was mapped is unmapped
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_snapshot_clear(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_tree_snapshot_clear";
+	int result            = 1;
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#endif
+
+	if( internal_tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_snapshot->built_data != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->built_data );
+
+		internal_tree_snapshot->built_data = NULL;
+	}
+	if( internal_tree_snapshot->mapped_data != NULL )
+	{
+#if defined( WINAPI )
+		if( UnmapViewOfFile(
+		     internal_tree_snapshot->mapped_data ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 error_code,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+#elif defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+		if( munmap(
+		     internal_tree_snapshot->mapped_data,
+		     internal_tree_snapshot->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		internal_tree_snapshot->mapped_data = NULL;
+	}
+	internal_tree_snapshot->data                  = NULL;
+	internal_tree_snapshot->data_size             = 0;
+	internal_tree_snapshot->number_of_records     = 0;
+	internal_tree_snapshot->number_of_directories = 0;
+	internal_tree_snapshot->maximum_path_size     = 0;
+	internal_tree_snapshot->records_data          = NULL;
+	internal_tree_snapshot->blocks_data           = NULL;
+	internal_tree_snapshot->directories_data      = NULL;
+	internal_tree_snapshot->paths_data            = NULL;
+	internal_tree_snapshot->paths_data_size       = 0;
+
+	return( result );
+}
+
+/* Frees the values of a build
+ */
+void libcdirectory_internal_tree_snapshot_free_build_values(
+      libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot )
+{
+	if( internal_tree_snapshot == NULL )
+	{
+		return;
+	}
+	if( internal_tree_snapshot->records_buffer.data != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->records_buffer.data );
+	}
+	if( internal_tree_snapshot->blocks_buffer.data != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->blocks_buffer.data );
+	}
+	if( internal_tree_snapshot->directories_buffer.data != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->directories_buffer.data );
+	}
+	if( internal_tree_snapshot->paths_buffer.data != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->paths_buffer.data );
+	}
+	if( internal_tree_snapshot->names_buffer.data != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->names_buffer.data );
+	}
+	if( internal_tree_snapshot->entries != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->entries );
+	}
+	if( internal_tree_snapshot->path != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->path );
+	}
+	if( internal_tree_snapshot->previous_record_path != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->previous_record_path );
+	}
+	if( internal_tree_snapshot->record_path != NULL )
+	{
+		memory_free(
+		 internal_tree_snapshot->record_path );
+	}
+	internal_tree_snapshot->records_buffer.data                    = NULL;
+	internal_tree_snapshot->records_buffer.data_size               = 0;
+	internal_tree_snapshot->records_buffer.allocated_data_size     = 0;
+	internal_tree_snapshot->blocks_buffer.data                     = NULL;
+	internal_tree_snapshot->blocks_buffer.data_size                = 0;
+	internal_tree_snapshot->blocks_buffer.allocated_data_size      = 0;
+	internal_tree_snapshot->directories_buffer.data                = NULL;
+	internal_tree_snapshot->directories_buffer.data_size           = 0;
+	internal_tree_snapshot->directories_buffer.allocated_data_size = 0;
+	internal_tree_snapshot->paths_buffer.data                      = NULL;
+	internal_tree_snapshot->paths_buffer.data_size                 = 0;
+	internal_tree_snapshot->paths_buffer.allocated_data_size       = 0;
+	internal_tree_snapshot->names_buffer.data                      = NULL;
+	internal_tree_snapshot->names_buffer.data_size                 = 0;
+	internal_tree_snapshot->names_buffer.allocated_data_size       = 0;
+	internal_tree_snapshot->entries                                = NULL;
+	internal_tree_snapshot->number_of_entries                      = 0;
+	internal_tree_snapshot->number_of_allocated_entries            = 0;
+	internal_tree_snapshot->path                                   = NULL;
+	internal_tree_snapshot->root_path_length                       = 0;
+	internal_tree_snapshot->previous_record_path                   = NULL;
+	internal_tree_snapshot->previous_record_path_length            = 0;
+	internal_tree_snapshot->record_path                            = NULL;
+	internal_tree_snapshot->maximum_path_length                    = 0;
+	internal_tree_snapshot->root_device_number                     = 0;
+}
+
+/* Appends data to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_buffer_append(
+     libcdirectory_tree_snapshot_buffer_t *buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_data  = NULL;
+	static char *function      = "libcdirectory_tree_snapshot_buffer_append";
+	size_t allocated_data_size = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - buffer->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer->data_size + data_size ) > buffer->allocated_data_size )
+	{
+		if( buffer->allocated_data_size == 0 )
+		{
+			allocated_data_size = LIBCDIRECTORY_TREE_SNAPSHOT_INITIAL_BUFFER_SIZE;
+		}
+		else if( buffer->allocated_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		else
+		{
+			allocated_data_size = buffer->allocated_data_size * 2;
+		}
+		if( allocated_data_size < ( buffer->data_size + data_size ) )
+		{
+			allocated_data_size = buffer->data_size + data_size;
+		}
+		reallocated_data = (uint8_t *) memory_reallocate(
+		                                buffer->data,
+		                                sizeof( uint8_t ) * allocated_data_size );
+
+		if( reallocated_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data                = reallocated_data;
+		buffer->allocated_data_size = allocated_data_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( buffer->data[ buffer->data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data_size += data_size;
+	}
+	return( 1 );
+}
+
+/* Decodes the front coded path of a record
+ * The path is decoded from the first record of the block that contains the record,
+ * which requires at most 16 front coded paths to be decoded
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_decode_path(
+     const uint8_t *blocks_data,
+     const uint8_t *paths_data,
+     size_t paths_data_size,
+     int record_index,
+     char *path,
+     size_t path_size,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcdirectory_tree_snapshot_decode_path";
+	size_t data_offset      = 0;
+	size_t safe_path_length = 0;
+	uint64_t block_offset   = 0;
+	uint16_t prefix_length  = 0;
+	uint16_t suffix_length  = 0;
+	int block_index         = 0;
+	int path_index          = 0;
+
+	if( blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blocks data.",
+		 function );
+
+		return( -1 );
+	}
+	if( paths_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_size == 0 )
+	 || ( path_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	block_index = record_index / LIBCDIRECTORY_TREE_SNAPSHOT_NUMBER_OF_RECORDS_PER_BLOCK;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( blocks_data[ (size_t) block_index * LIBCDIRECTORY_TREE_SNAPSHOT_BLOCK_DATA_SIZE ] ),
+	 block_offset );
+
+	if( block_offset > (uint64_t) paths_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = (size_t) block_offset;
+
+	for( path_index = block_index * LIBCDIRECTORY_TREE_SNAPSHOT_NUMBER_OF_RECORDS_PER_BLOCK;
+	     path_index <= record_index;
+	     path_index++ )
+	{
+		if( ( paths_data_size - data_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid paths data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( paths_data[ data_offset ] ),
+		 prefix_length );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( paths_data[ data_offset + 2 ] ),
+		 suffix_length );
+
+		data_offset += 4;
+
+		if( (size_t) prefix_length > safe_path_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid prefix length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) suffix_length > ( paths_data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid suffix length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( (size_t) prefix_length + (size_t) suffix_length ) >= path_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid path size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( suffix_length > 0 )
+		{
+			if( memory_copy(
+			     &( path[ prefix_length ] ),
+			     &( paths_data[ data_offset ] ),
+			     (size_t) suffix_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy suffix.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		safe_path_length = (size_t) prefix_length + (size_t) suffix_length;
+		data_offset     += (size_t) suffix_length;
+	}
+	path[ safe_path_length ] = 0;
+
+	*path_length = safe_path_length;
+
+	return( 1 );
+}
+
+/* Sets the data of a tree snapshot
+ * Only the header is read, the records, directories and paths are read from the data on access
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_snapshot_set_data(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libcdirectory_internal_tree_snapshot_set_data";
+	uint64_t paths_data_size       = 0;
+	uint64_t tables_data_size      = 0;
+	uint32_t format_version        = 0;
+	uint32_t maximum_path_size     = 0;
+	uint32_t number_of_blocks      = 0;
+	uint32_t number_of_directories = 0;
+	uint32_t number_of_records     = 0;
+
+	if( internal_tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     libcdirectory_tree_snapshot_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported tree snapshot signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 format_version );
+
+	if( format_version != LIBCDIRECTORY_TREE_SNAPSHOT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported tree snapshot format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 number_of_records );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 number_of_directories );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 maximum_path_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 paths_data_size );
+
+	if( number_of_records > (uint32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directories > number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directories value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_path_size > ( LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = ( number_of_records / LIBCDIRECTORY_TREE_SNAPSHOT_NUMBER_OF_RECORDS_PER_BLOCK )
+	                 + ( ( number_of_records % LIBCDIRECTORY_TREE_SNAPSHOT_NUMBER_OF_RECORDS_PER_BLOCK ) != 0 );
+
+	tables_data_size = LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE
+	                 + ( (uint64_t) number_of_records * LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE )
+	                 + ( (uint64_t) number_of_blocks * LIBCDIRECTORY_TREE_SNAPSHOT_BLOCK_DATA_SIZE )
+	                 + ( (uint64_t) number_of_directories * LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE );
+
+	if( ( tables_data_size > (uint64_t) data_size )
+	 || ( paths_data_size != ( (uint64_t) data_size - tables_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value does not match tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot->data                  = data;
+	internal_tree_snapshot->data_size             = data_size;
+	internal_tree_snapshot->number_of_records     = (int) number_of_records;
+	internal_tree_snapshot->number_of_directories = (int) number_of_directories;
+	internal_tree_snapshot->maximum_path_size     = (size_t) maximum_path_size;
+	internal_tree_snapshot->records_data          = &( data[ LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE ] );
+	internal_tree_snapshot->blocks_data           = &( internal_tree_snapshot->records_data[ (size_t) number_of_records * LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE ] );
+	internal_tree_snapshot->directories_data      = &( internal_tree_snapshot->blocks_data[ (size_t) number_of_blocks * LIBCDIRECTORY_TREE_SNAPSHOT_BLOCK_DATA_SIZE ] );
+	internal_tree_snapshot->paths_data            = &( internal_tree_snapshot->directories_data[ (size_t) number_of_directories * LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE ] );
+	internal_tree_snapshot->paths_data_size       = (size_t) paths_data_size;
+
+	return( 1 );
+}
+
+/* Appends a record to the buffers of a build
+ * The path of the record consists of the relative path of the parent directory and the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_snapshot_append_record(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     const char *parent_path,
+     size_t parent_path_length,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint64_t size,
+     int64_t modification_time,
+     uint64_t inode_number,
+     int parent_index,
+     libcerror_error_t **error )
+{
+	uint8_t path_data[ 4 ];
+	uint8_t record_data[ LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE ];
+
+	char *record_path     = NULL;
+	static char *function = "libcdirectory_internal_tree_snapshot_append_record";
+	size_t path_length    = 0;
+	size_t prefix_length  = 0;
+	size_t record_index   = 0;
+
+	if( internal_tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_tree_snapshot->previous_record_path == NULL )
+	 || ( internal_tree_snapshot->record_path == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tree snapshot - missing record path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_path == NULL )
+	 && ( parent_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name == NULL )
+	 && ( name_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_path_length > LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH )
+	 || ( name_length > LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	record_index = internal_tree_snapshot->records_buffer.data_size / LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE;
+
+	if( record_index >= (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = parent_path_length + name_length;
+
+	if( ( parent_path_length > 0 )
+	 && ( name_length > 0 ) )
+	{
+		path_length += 1;
+	}
+	if( path_length > LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	record_path = internal_tree_snapshot->record_path;
+
+	if( parent_path_length > 0 )
+	{
+		if( memory_copy(
+		     record_path,
+		     parent_path,
+		     parent_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy parent path.",
+			 function );
+
+			return( -1 );
+		}
+		if( name_length > 0 )
+		{
+			record_path[ parent_path_length ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+		}
+	}
+	if( name_length > 0 )
+	{
+		if( memory_copy(
+		     &( record_path[ path_length - name_length ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The path of the first record of a block is stored in full so that a path
+	 * can be decoded without decoding the paths of the preceding blocks
+	 */
+	if( ( record_index % LIBCDIRECTORY_TREE_SNAPSHOT_NUMBER_OF_RECORDS_PER_BLOCK ) == 0 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 record_data,
+		 (uint64_t) internal_tree_snapshot->paths_buffer.data_size );
+
+		if( libcdirectory_tree_snapshot_buffer_append(
+		     &( internal_tree_snapshot->blocks_buffer ),
+		     record_data,
+		     LIBCDIRECTORY_TREE_SNAPSHOT_BLOCK_DATA_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		while( ( prefix_length < path_length )
+		    && ( prefix_length < internal_tree_snapshot->previous_record_path_length )
+		    && ( record_path[ prefix_length ] == internal_tree_snapshot->previous_record_path[ prefix_length ] ) )
+		{
+			prefix_length++;
+		}
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( path_data[ 0 ] ),
+	 (uint16_t) prefix_length );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( path_data[ 2 ] ),
+	 (uint16_t) ( path_length - prefix_length ) );
+
+	if( libcdirectory_tree_snapshot_buffer_append(
+	     &( internal_tree_snapshot->paths_buffer ),
+	     path_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_tree_snapshot_buffer_append(
+	     &( internal_tree_snapshot->paths_buffer ),
+	     (uint8_t *) &( record_path[ prefix_length ] ),
+	     path_length - prefix_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path suffix.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( record_data[ 0 ] ),
+	 size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( record_data[ 8 ] ),
+	 (uint64_t) modification_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( record_data[ 16 ] ),
+	 inode_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 24 ] ),
+	 (uint32_t) parent_index );
+
+	record_data[ 28 ] = type;
+	record_data[ 29 ] = 0;
+	record_data[ 30 ] = 0;
+	record_data[ 31 ] = 0;
+
+	if( libcdirectory_tree_snapshot_buffer_append(
+	     &( internal_tree_snapshot->records_buffer ),
+	     record_data,
+	     LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path of the record becomes the previous path of the next record
+	 */
+	internal_tree_snapshot->record_path                 = internal_tree_snapshot->previous_record_path;
+	internal_tree_snapshot->previous_record_path        = record_path;
+	internal_tree_snapshot->previous_record_path_length = path_length;
+
+	if( path_length > internal_tree_snapshot->maximum_path_length )
+	{
+		internal_tree_snapshot->maximum_path_length = path_length;
+	}
+	return( 1 );
+}
+
+/* Appends an entry of the directory that is read by a build
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_snapshot_append_entry(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libcdirectory_tree_snapshot_entry_t *entries = NULL;
+	libcdirectory_tree_snapshot_entry_t *entry   = NULL;
+	static char *function                        = "libcdirectory_internal_tree_snapshot_append_entry";
+	uint64_t inode_number                        = 0;
+	uint64_t size                                = 0;
+	int64_t modification_time                    = 0;
+	uint8_t entry_type                           = 0;
+	int number_of_allocated_entries              = 0;
+	int result                                   = 0;
+
+	if( internal_tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The type is retrieved first since it can resolve an unknown type
+	 */
+	if( libcdirectory_directory_entry_get_type(
+	     directory_entry,
+	     &entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry type.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H )
+	/* Read all the file statistics with a single system call, the values are
+	 * retrieved from the directory entry afterwards
+	 */
+	result = libcdirectory_internal_directory_entry_read_file_statistics(
+	          (libcdirectory_internal_directory_entry_t *) directory_entry,
+	          LIBCDIRECTORY_TREE_SNAPSHOT_FILE_STATISTICS_FLAGS,
+	          error );
+
+	if( result == -1 )
+	{
+		/* The entry could have been removed after it was read, its values are stored as 0
+		 */
+		libcerror_error_free(
+		 error );
+	}
+#endif
+	if( result != -1 )
+	{
+		if( libcdirectory_directory_entry_get_size(
+		     directory_entry,
+		     &size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_directory_entry_get_modification_time(
+		     directory_entry,
+		     &modification_time,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_directory_entry_get_inode_number(
+		     directory_entry,
+		     &inode_number,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_tree_snapshot->number_of_entries >= internal_tree_snapshot->number_of_allocated_entries )
+	{
+		if( internal_tree_snapshot->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBCDIRECTORY_TREE_SNAPSHOT_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else if( internal_tree_snapshot->number_of_allocated_entries > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_tree_snapshot_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tree snapshot - number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_entries = internal_tree_snapshot->number_of_allocated_entries * 2;
+		}
+		entries = (libcdirectory_tree_snapshot_entry_t *) memory_reallocate(
+		                                                   internal_tree_snapshot->entries,
+		                                                   sizeof( libcdirectory_tree_snapshot_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_tree_snapshot->entries                     = entries;
+		internal_tree_snapshot->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( internal_tree_snapshot->entries[ internal_tree_snapshot->number_of_entries ] );
+
+	entry->name              = NULL;
+	entry->name_offset       = internal_tree_snapshot->names_buffer.data_size;
+	entry->name_length       = name_length;
+	entry->size              = size;
+	entry->modification_time = modification_time;
+	entry->inode_number      = inode_number;
+	entry->type              = entry_type;
+
+	if( libcdirectory_tree_snapshot_buffer_append(
+	     &( internal_tree_snapshot->names_buffer ),
+	     (uint8_t *) name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Compares two entries by their name
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
+ */
+int libcdirectory_tree_snapshot_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libcdirectory_tree_snapshot_entry_t *first  = (const libcdirectory_tree_snapshot_entry_t *) first_entry;
+	const libcdirectory_tree_snapshot_entry_t *second = (const libcdirectory_tree_snapshot_entry_t *) second_entry;
+	size_t compare_length                             = 0;
+	int result                                        = 0;
+
+	compare_length = first->name_length;
+
+	if( second->name_length < compare_length )
+	{
+		compare_length = second->name_length;
+	}
+	if( compare_length > 0 )
+	{
+		result = memory_compare(
+		          first->name,
+		          second->name,
+		          compare_length );
+	}
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first->name_length < second->name_length )
+	{
+		return( -1 );
+	}
+	else if( first->name_length > second->name_length )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the directory of a record and appends the records of its entries
+ * Returns 1 if successful, 0 if the directory was skipped or -1 on error
+ */
+int libcdirectory_internal_tree_snapshot_read_directory(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     int record_index,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	uint8_t directory_data[ LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE ];
+
+	libcdirectory_tree_snapshot_entry_t *entry = NULL;
+	const char *name                           = NULL;
+	char *relative_path                        = NULL;
+	static char *function                      = "libcdirectory_internal_tree_snapshot_read_directory";
+	size_t name_length                         = 0;
+	size_t path_length                         = 0;
+	int directory_index                        = 0;
+	int entry_index                            = 0;
+	int first_entry_record_index               = 0;
+	int is_open                                = 0;
+	int result                                 = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	uint8_t *record_data                       = NULL;
+	uint64_t device_number                     = 0;
+	uint64_t inode_number                      = 0;
+	int64_t inode_change_time                  = 0;
+	int64_t modification_time                  = 0;
+#endif
+
+	if( internal_tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_snapshot->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tree snapshot - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( (size_t) record_index >= ( internal_tree_snapshot->records_buffer.data_size / LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The relative path of the directory is decoded from the paths that were built
+	 * after the path of the tree in the path
+	 */
+	relative_path = &( internal_tree_snapshot->path[ internal_tree_snapshot->root_path_length ] );
+
+	if( libcdirectory_tree_snapshot_decode_path(
+	     internal_tree_snapshot->blocks_buffer.data,
+	     internal_tree_snapshot->paths_buffer.data,
+	     internal_tree_snapshot->paths_buffer.data_size,
+	     record_index,
+	     relative_path,
+	     LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH + 1,
+	     &path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode path of record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_open(
+	     directory,
+	     internal_tree_snapshot->path,
+	     error ) != 1 )
+	{
+		if( ( record_index > 0 )
+		 && ( ( flags & LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	is_open = 1;
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	if( libcdirectory_internal_directory_get_change_values(
+	     (libcdirectory_internal_directory_t *) directory,
+	     &device_number,
+	     &inode_number,
+	     &modification_time,
+	     &inode_change_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory change values.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_index == 0 )
+	{
+		/* The directory of the tree is not an entry of a directory that was read,
+		 * its values are set once it is opened
+		 */
+		internal_tree_snapshot->root_device_number = device_number;
+
+		record_data = internal_tree_snapshot->records_buffer.data;
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( record_data[ 8 ] ),
+		 (uint64_t) modification_time );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( record_data[ 16 ] ),
+		 inode_number );
+	}
+	else if( ( ( flags & LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM ) != 0 )
+	      && ( device_number != internal_tree_snapshot->root_device_number ) )
+	{
+		is_open = 0;
+
+		if( libcdirectory_directory_close(
+		     directory,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close directory.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER ) */
+
+	internal_tree_snapshot->number_of_entries      = 0;
+	internal_tree_snapshot->names_buffer.data_size = 0;
+
+	while( 1 )
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          (libcdirectory_internal_directory_t *) directory,
+		          (libcdirectory_internal_directory_entry_t *) directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     directory_entry,
+		     (char **) &name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( name[ 0 ] == '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		name_length = narrow_string_length(
+		               name );
+
+		if( libcdirectory_internal_tree_snapshot_append_entry(
+		     internal_tree_snapshot,
+		     directory_entry,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	is_open = 0;
+
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* The names are referenced once all entries were read since the names buffer
+	 * can be reallocated while the entries are read
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_tree_snapshot->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_tree_snapshot->entries[ entry_index ] );
+
+		entry->name = (const char *) &( internal_tree_snapshot->names_buffer.data[ entry->name_offset ] );
+	}
+	if( internal_tree_snapshot->number_of_entries > 1 )
+	{
+		qsort(
+		 internal_tree_snapshot->entries,
+		 (size_t) internal_tree_snapshot->number_of_entries,
+		 sizeof( libcdirectory_tree_snapshot_entry_t ),
+		 &libcdirectory_tree_snapshot_entry_compare );
+	}
+	directory_index          = (int) ( internal_tree_snapshot->directories_buffer.data_size / LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE );
+	first_entry_record_index = (int) ( internal_tree_snapshot->records_buffer.data_size / LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( directory_data[ 0 ] ),
+	 (uint32_t) record_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( directory_data[ 4 ] ),
+	 (uint32_t) first_entry_record_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( directory_data[ 8 ] ),
+	 (uint32_t) internal_tree_snapshot->number_of_entries );
+
+	if( libcdirectory_tree_snapshot_buffer_append(
+	     &( internal_tree_snapshot->directories_buffer ),
+	     directory_data,
+	     LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_tree_snapshot->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_tree_snapshot->entries[ entry_index ] );
+
+		if( libcdirectory_internal_tree_snapshot_append_record(
+		     internal_tree_snapshot,
+		     relative_path,
+		     path_length,
+		     entry->name,
+		     entry->name_length,
+		     entry->type,
+		     entry->size,
+		     entry->modification_time,
+		     entry->inode_number,
+		     directory_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( is_open != 0 )
+	{
+		libcdirectory_directory_close(
+		 directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds a tree snapshot of a directory tree
+ * The directories are read breadth-first and the entries of every directory are sorted by name.
+ * Symbolic links are not followed. The supported flags are LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE
+ * and LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM, where a directory that is skipped is stored
+ * as a record without entries. On error the tree snapshot is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_build(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     const char *path,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *directory_entry               = NULL;
+	libcdirectory_directory_t *directory                           = NULL;
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	uint8_t *data                                                  = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_build";
+	size_t data_offset                                             = 0;
+	size_t data_size                                               = 0;
+	size_t path_length                                             = 0;
+	size_t path_size                                               = 0;
+	int number_of_records                                          = 0;
+	int record_index                                               = 0;
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCDIRECTORY_TREE_SNAPSHOT_SUPPORTED_FLAGS ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_tree_snapshot_clear(
+	     internal_tree_snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	libcdirectory_internal_tree_snapshot_free_build_values(
+	 internal_tree_snapshot );
+
+	/* The path consists of the path of the tree, a separator and the relative path
+	 * of the directory that is read
+	 */
+	path_size = path_length + LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH + 2;
+
+	internal_tree_snapshot->path = narrow_string_allocate(
+	                                path_size );
+
+	if( internal_tree_snapshot->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_tree_snapshot->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	if( path[ path_length - 1 ] != (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR )
+	{
+		internal_tree_snapshot->path[ path_length++ ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+	}
+	internal_tree_snapshot->path[ path_length ] = 0;
+
+	internal_tree_snapshot->root_path_length = path_length;
+
+	internal_tree_snapshot->previous_record_path = narrow_string_allocate(
+	                                                LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH + 1 );
+
+	if( internal_tree_snapshot->previous_record_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create previous record path.",
+		 function );
+
+		goto on_error;
+	}
+	internal_tree_snapshot->record_path = narrow_string_allocate(
+	                                       LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH + 1 );
+
+	if( internal_tree_snapshot->record_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_internal_tree_snapshot_append_record(
+	     internal_tree_snapshot,
+	     NULL,
+	     0,
+	     NULL,
+	     0,
+	     LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	     0,
+	     0,
+	     0,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records that were appended form the queue of the breadth-first read,
+	 * the entries of every directory record are appended after the last record
+	 */
+	number_of_records = 1;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( internal_tree_snapshot->records_buffer.data[ ( (size_t) record_index * LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE ) + 28 ] != LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		{
+			continue;
+		}
+		if( libcdirectory_internal_tree_snapshot_read_directory(
+		     internal_tree_snapshot,
+		     directory,
+		     directory_entry,
+		     record_index,
+		     flags,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory of record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		number_of_records = (int) ( internal_tree_snapshot->records_buffer.data_size / LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE );
+	}
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records, block offsets and directories are bounded by the maximum allocation size
+	 * of their buffers, the paths buffer is checked against the remaining size
+	 */
+	data_size = LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE
+	          + internal_tree_snapshot->records_buffer.data_size
+	          + internal_tree_snapshot->blocks_buffer.data_size
+	          + internal_tree_snapshot->directories_buffer.data_size;
+
+	if( ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( internal_tree_snapshot->paths_buffer.data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	data_size += internal_tree_snapshot->paths_buffer.data_size;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data,
+	     libcdirectory_tree_snapshot_signature,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 LIBCDIRECTORY_TREE_SNAPSHOT_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 (uint32_t) number_of_records );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 (uint32_t) ( internal_tree_snapshot->directories_buffer.data_size / LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 (uint32_t) ( internal_tree_snapshot->maximum_path_length + 1 ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 20 ] ),
+	 0 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 (uint64_t) internal_tree_snapshot->paths_buffer.data_size );
+
+	data_offset = LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE;
+
+	if( memory_copy(
+	     &( data[ data_offset ] ),
+	     internal_tree_snapshot->records_buffer.data,
+	     internal_tree_snapshot->records_buffer.data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy records.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += internal_tree_snapshot->records_buffer.data_size;
+
+	if( memory_copy(
+	     &( data[ data_offset ] ),
+	     internal_tree_snapshot->blocks_buffer.data,
+	     internal_tree_snapshot->blocks_buffer.data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block offsets.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += internal_tree_snapshot->blocks_buffer.data_size;
+
+	if( internal_tree_snapshot->directories_buffer.data_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     internal_tree_snapshot->directories_buffer.data,
+		     internal_tree_snapshot->directories_buffer.data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directories.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += internal_tree_snapshot->directories_buffer.data_size;
+	}
+	if( internal_tree_snapshot->paths_buffer.data_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     internal_tree_snapshot->paths_buffer.data,
+		     internal_tree_snapshot->paths_buffer.data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy paths.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	libcdirectory_internal_tree_snapshot_free_build_values(
+	 internal_tree_snapshot );
+
+	if( libcdirectory_internal_tree_snapshot_set_data(
+	     internal_tree_snapshot,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_tree_snapshot->built_data = data;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	libcdirectory_internal_tree_snapshot_free_build_values(
+	 internal_tree_snapshot );
+
+	libcdirectory_internal_tree_snapshot_clear(
+	 internal_tree_snapshot,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the size of the data of the tree snapshot
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_data_size(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_data_size";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( internal_tree_snapshot->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tree snapshot - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_tree_snapshot->data_size;
+
+	return( 1 );
+}
+
+/* Writes the data of the tree snapshot
+ * The data can be written to a file that is opened with libcdirectory_tree_snapshot_open
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_write_data(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_write_data";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( internal_tree_snapshot->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tree snapshot - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < internal_tree_snapshot->data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     internal_tree_snapshot->data,
+	     internal_tree_snapshot->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the data of a tree snapshot
+ * The data is referenced and not copied, it must remain available until the tree snapshot
+ * is closed, freed or another snapshot is built, set or opened. Only the header of the data
+ * is read, the records, directories and paths are read from the data on access
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_set_data(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_set_data";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( libcdirectory_internal_tree_snapshot_clear(
+	     internal_tree_snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_tree_snapshot_set_data(
+	     internal_tree_snapshot,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a tree snapshot file
+ * The file is mapped into memory read-only and shared, so that the pages of the file are shared
+ * by the processes that open it. Only the header of the data is read, the records, directories
+ * and paths are read from the mapped file on access
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_open(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_open";
+
+#if defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+	void *mapped_data                                              = NULL;
+	size_t mapped_data_size                                        = 0;
+	uint64_t file_size                                             = 0;
+#endif
+
+#if defined( WINAPI )
+	HANDLE file_handle                                             = INVALID_HANDLE_VALUE;
+	HANDLE mapping_handle                                          = NULL;
+	DWORD error_code                                               = 0;
+	DWORD file_size_lower                                          = 0;
+	DWORD file_size_upper                                          = 0;
+
+#elif defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+	struct stat file_statistics;
+
+	int file_descriptor                                            = -1;
+#endif
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_tree_snapshot_clear(
+	     internal_tree_snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileA(
+	               (LPCSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	file_size_lower = GetFileSize(
+	                   file_handle,
+	                   &file_size_upper );
+
+	if( file_size_lower == INVALID_FILE_SIZE )
+	{
+		error_code = GetLastError();
+
+		if( error_code != NO_ERROR )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 error_code,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_size = ( (uint64_t) file_size_upper << 32 ) | file_size_lower;
+
+#elif defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY | O_CLOEXEC );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_statistics.st_size < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_size = (uint64_t) file_statistics.st_size;
+
+#endif /* defined( WINAPI ) */
+
+#if defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+	if( ( file_size < LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE )
+	 || ( file_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file size: %" PRIu64 ".",
+		 function,
+		 file_size );
+
+		goto on_error;
+	}
+	mapped_data_size = (size_t) file_size;
+
+#if defined( WINAPI )
+	mapping_handle = CreateFileMappingA(
+	                  file_handle,
+	                  NULL,
+	                  PAGE_READONLY,
+	                  0,
+	                  0,
+	                  NULL );
+
+	if( mapping_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	mapped_data = MapViewOfFile(
+	               mapping_handle,
+	               FILE_MAP_READ,
+	               0,
+	               0,
+	               0 );
+
+	if( mapped_data == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to map file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The view of the file remains valid after the handles are closed
+	 */
+	CloseHandle(
+	 mapping_handle );
+
+	mapping_handle = NULL;
+
+	CloseHandle(
+	 file_handle );
+
+	file_handle = INVALID_HANDLE_VALUE;
+
+#else
+	mapped_data = mmap(
+	               NULL,
+	               mapped_data_size,
+	               PROT_READ,
+	               MAP_SHARED,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file.",
+		 function );
+
+		mapped_data = NULL;
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		file_descriptor = -1;
+
+		goto on_error;
+	}
+	file_descriptor = -1;
+
+#endif /* defined( WINAPI ) */
+
+	if( libcdirectory_internal_tree_snapshot_set_data(
+	     internal_tree_snapshot,
+	     (const uint8_t *) mapped_data,
+	     mapped_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_tree_snapshot->mapped_data = mapped_data;
+
+	return( 1 );
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: mapping a file is not supported.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING ) */
+
+#if defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+on_error:
+#if defined( WINAPI )
+	if( mapped_data != NULL )
+	{
+		UnmapViewOfFile(
+		 mapped_data );
+	}
+	if( mapping_handle != NULL )
+	{
+		CloseHandle(
+		 mapping_handle );
+	}
+	if( file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 file_handle );
+	}
+#else
+	if( mapped_data != NULL )
+	{
+		munmap(
+		 mapped_data,
+		 mapped_data_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+#endif /* defined( WINAPI ) */
+
+	libcdirectory_internal_tree_snapshot_clear(
+	 internal_tree_snapshot,
+	 NULL );
+
+	return( -1 );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING ) */
+}
+
+/* Closes a tree snapshot
+ * The data that was built is freed, the file that was opened is unmapped
+ * Returns 0 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_close(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_tree_snapshot_close";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_tree_snapshot_clear(
+	     (libcdirectory_internal_tree_snapshot_t *) tree_snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to clear tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_number_of_records(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_number_of_records";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_tree_snapshot->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the number of directories
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_number_of_directories(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int *number_of_directories,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_number_of_directories";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directories = internal_tree_snapshot->number_of_directories;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum path size
+ * The size includes the end-of-string character and is sufficient for the path of every record
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_maximum_path_size(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     size_t *maximum_path_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_maximum_path_size";
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( maximum_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum path size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_path_size = internal_tree_snapshot->maximum_path_size;
+
+	return( 1 );
+}
+
+/* Retrieves a specific directory
+ * The entries of the directory are the records from the first entry record index
+ * up to the number of entries, which are sorted by name
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_directory(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int directory_index,
+     int *record_index,
+     int *first_entry_record_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	const uint8_t *directory_data                                  = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_directory";
+	uint32_t safe_first_entry_record_index                         = 0;
+	uint32_t safe_number_of_entries                                = 0;
+	uint32_t safe_record_index                                     = 0;
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_tree_snapshot->number_of_directories ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_entry_record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first entry record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	directory_data = &( internal_tree_snapshot->directories_data[ (size_t) directory_index * LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( directory_data[ 0 ] ),
+	 safe_record_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( directory_data[ 4 ] ),
+	 safe_first_entry_record_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( directory_data[ 8 ] ),
+	 safe_number_of_entries );
+
+	if( ( safe_record_index >= (uint32_t) internal_tree_snapshot->number_of_records )
+	 || ( safe_first_entry_record_index > (uint32_t) internal_tree_snapshot->number_of_records )
+	 || ( safe_number_of_entries > ( (uint32_t) internal_tree_snapshot->number_of_records - safe_first_entry_record_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory: %d - record index value out of bounds.",
+		 function,
+		 directory_index );
+
+		return( -1 );
+	}
+	*record_index             = (int) safe_record_index;
+	*first_entry_record_index = (int) safe_first_entry_record_index;
+	*number_of_entries        = (int) safe_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the directory of a specific record
+ * The directories are stored in the order of their records, which allows a binary search
+ * Returns 1 if successful, 0 if the record has no directory or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_directory_index(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int record_index,
+     int *directory_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_directory_index";
+	uint32_t directory_record_index                                = 0;
+	int lower_index                                                = 0;
+	int middle_index                                               = 0;
+	int upper_index                                                = 0;
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( ( record_index < 0 )
+	 || ( record_index >= internal_tree_snapshot->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = internal_tree_snapshot->number_of_directories;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_tree_snapshot->directories_data[ (size_t) middle_index * LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE ] ),
+		 directory_record_index );
+
+		if( directory_record_index == (uint32_t) record_index )
+		{
+			*directory_index = middle_index;
+
+			return( 1 );
+		}
+		else if( directory_record_index < (uint32_t) record_index )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the values of a specific record
+ * The modification time is a signed POSIX time in number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * The parent index is the index of the directory that contains the record or -1 for the directory of the tree
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_record(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int record_index,
+     uint8_t *type,
+     uint64_t *size,
+     int64_t *modification_time,
+     uint64_t *inode_number,
+     int *parent_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	const uint8_t *record_data                                     = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_record";
+	uint64_t value_64bit                                           = 0;
+	uint32_t safe_parent_index                                     = 0;
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( ( record_index < 0 )
+	 || ( record_index >= internal_tree_snapshot->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent index.",
+		 function );
+
+		return( -1 );
+	}
+	record_data = &( internal_tree_snapshot->records_data[ (size_t) record_index * LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( record_data[ 24 ] ),
+	 safe_parent_index );
+
+	if( ( safe_parent_index != 0xffffffffUL )
+	 && ( safe_parent_index >= (uint32_t) internal_tree_snapshot->number_of_directories ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record: %d - parent index value out of bounds.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( record_data[ 0 ] ),
+	 *size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( record_data[ 8 ] ),
+	 value_64bit );
+
+	*modification_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( record_data[ 16 ] ),
+	 *inode_number );
+
+	*type = record_data[ 28 ];
+
+	if( safe_parent_index == 0xffffffffUL )
+	{
+		*parent_index = -1;
+	}
+	else
+	{
+		*parent_index = (int) safe_parent_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the path of a specific record
+ * The path is relative to the directory of the tree, where the directory of the tree
+ * has an empty path. A path size of the maximum path size is sufficient for every record
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_snapshot_get_record_path(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int record_index,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot = NULL;
+	static char *function                                          = "libcdirectory_tree_snapshot_get_record_path";
+	size_t path_length                                             = 0;
+
+	if( tree_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_snapshot = (libcdirectory_internal_tree_snapshot_t *) tree_snapshot;
+
+	if( ( record_index < 0 )
+	 || ( record_index >= internal_tree_snapshot->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_tree_snapshot_decode_path(
+	     internal_tree_snapshot->blocks_data,
+	     internal_tree_snapshot->paths_data,
+	     internal_tree_snapshot->paths_data_size,
+	     record_index,
+	     path,
+	     path_size,
+	     &path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode path of record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
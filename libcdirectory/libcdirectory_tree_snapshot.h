@@ -0,0 +1,422 @@
+/*
+ * Tree snapshot functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_TREE_SNAPSHOT_H )
+#define _LIBCDIRECTORY_TREE_SNAPSHOT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_extern.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A tree snapshot file can be mapped into memory with a file mapping or mmap
+ */
+#if defined( WINAPI ) || ( defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) )
+#define LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING
+#endif
+
+/* The tree snapshot format version
+ */
+#define LIBCDIRECTORY_TREE_SNAPSHOT_FORMAT_VERSION			1
+
+/* The sizes of the tree snapshot data header, record, path block offset and directory
+ */
+#define LIBCDIRECTORY_TREE_SNAPSHOT_HEADER_DATA_SIZE			32
+#define LIBCDIRECTORY_TREE_SNAPSHOT_RECORD_DATA_SIZE			32
+#define LIBCDIRECTORY_TREE_SNAPSHOT_BLOCK_DATA_SIZE			8
+#define LIBCDIRECTORY_TREE_SNAPSHOT_DIRECTORY_DATA_SIZE			12
+
+/* The number of records of which the paths are front coded relative to the
+ * path of the previous record, the path of the first record of a block is stored in full
+ */
+#define LIBCDIRECTORY_TREE_SNAPSHOT_NUMBER_OF_RECORDS_PER_BLOCK		16
+
+/* The maximum length of a relative path that can be front coded
+ */
+#define LIBCDIRECTORY_TREE_SNAPSHOT_MAXIMUM_PATH_LENGTH			0xffff
+
+/* The initial sizes of the buffers and the number of entries of a build
+ */
+#define LIBCDIRECTORY_TREE_SNAPSHOT_INITIAL_BUFFER_SIZE			4096
+#define LIBCDIRECTORY_TREE_SNAPSHOT_INITIAL_NUMBER_OF_ENTRIES		64
+
+/* The file statistics that are read for every entry
+ */
+#define LIBCDIRECTORY_TREE_SNAPSHOT_FILE_STATISTICS_FLAGS \
+	( LIBCDIRECTORY_FILE_STATISTICS_FLAG_SIZE | LIBCDIRECTORY_FILE_STATISTICS_FLAG_MODIFICATION_TIME \
+	| LIBCDIRECTORY_FILE_STATISTICS_FLAG_INODE_NUMBER )
+
+/* The walker flags that are supported by a build
+ */
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+#define LIBCDIRECTORY_TREE_SNAPSHOT_SUPPORTED_FLAGS \
+	( LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE | LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM )
+#else
+#define LIBCDIRECTORY_TREE_SNAPSHOT_SUPPORTED_FLAGS \
+	LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE
+#endif
+
+typedef struct libcdirectory_tree_snapshot_buffer libcdirectory_tree_snapshot_buffer_t;
+
+struct libcdirectory_tree_snapshot_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+};
+
+typedef struct libcdirectory_tree_snapshot_entry libcdirectory_tree_snapshot_entry_t;
+
+/* An entry of the directory that is read by a build, before it is sorted by name
+ */
+struct libcdirectory_tree_snapshot_entry
+{
+	/* The name, which is set once all entries of the directory were read
+	 */
+	const char *name;
+
+	/* The offset of the name in the entry names buffer
+	 */
+	size_t name_offset;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The size
+	 */
+	uint64_t size;
+
+	/* The modification time
+	 */
+	int64_t modification_time;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The type
+	 */
+	uint8_t type;
+};
+
+typedef struct libcdirectory_internal_tree_snapshot libcdirectory_internal_tree_snapshot_t;
+
+/* A tree snapshot contains the records of the entries of a directory tree in a format
+ * that is used as-is when the snapshot is read from memory or mapped from a file
+ */
+struct libcdirectory_internal_tree_snapshot
+{
+	/* The snapshot data, which is built, mapped or referenced
+	 */
+	const uint8_t *data;
+
+	/* The snapshot data size
+	 */
+	size_t data_size;
+
+	/* The data of a snapshot that was built
+	 */
+	uint8_t *built_data;
+
+	/* The data of a snapshot file that was mapped
+	 */
+	void *mapped_data;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of directories
+	 */
+	int number_of_directories;
+
+	/* The maximum path size
+	 */
+	size_t maximum_path_size;
+
+	/* The records data
+	 */
+	const uint8_t *records_data;
+
+	/* The path block offsets data
+	 */
+	const uint8_t *blocks_data;
+
+	/* The directories data
+	 */
+	const uint8_t *directories_data;
+
+	/* The front coded paths data
+	 */
+	const uint8_t *paths_data;
+
+	/* The front coded paths data size
+	 */
+	size_t paths_data_size;
+
+	/* The records buffer of a build
+	 */
+	libcdirectory_tree_snapshot_buffer_t records_buffer;
+
+	/* The path block offsets buffer of a build
+	 */
+	libcdirectory_tree_snapshot_buffer_t blocks_buffer;
+
+	/* The directories buffer of a build
+	 */
+	libcdirectory_tree_snapshot_buffer_t directories_buffer;
+
+	/* The front coded paths buffer of a build
+	 */
+	libcdirectory_tree_snapshot_buffer_t paths_buffer;
+
+	/* The names buffer of the entries of the directory that is read by a build
+	 */
+	libcdirectory_tree_snapshot_buffer_t names_buffer;
+
+	/* The entries of the directory that is read by a build
+	 */
+	libcdirectory_tree_snapshot_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The path of the directory that is read by a build, which starts with
+	 * the path of the tree and a separator
+	 */
+	char *path;
+
+	/* The length of the path of the tree and separator in the path
+	 */
+	size_t root_path_length;
+
+	/* The relative path of the previous record that was built
+	 */
+	char *previous_record_path;
+
+	/* The length of the relative path of the previous record
+	 */
+	size_t previous_record_path_length;
+
+	/* The relative path of the record that is built
+	 */
+	char *record_path;
+
+	/* The maximum relative path length of the records that were built
+	 */
+	size_t maximum_path_length;
+
+	/* The device number of the directory of the tree
+	 */
+	uint64_t root_device_number;
+};
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_initialize(
+     libcdirectory_tree_snapshot_t **tree_snapshot,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_free(
+     libcdirectory_tree_snapshot_t **tree_snapshot,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_snapshot_clear(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     libcerror_error_t **error );
+
+void libcdirectory_internal_tree_snapshot_free_build_values(
+      libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot );
+
+int libcdirectory_tree_snapshot_buffer_append(
+     libcdirectory_tree_snapshot_buffer_t *buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdirectory_tree_snapshot_decode_path(
+     const uint8_t *blocks_data,
+     const uint8_t *paths_data,
+     size_t paths_data_size,
+     int record_index,
+     char *path,
+     size_t path_size,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_snapshot_set_data(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_snapshot_append_record(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     const char *parent_path,
+     size_t parent_path_length,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
+     uint64_t size,
+     int64_t modification_time,
+     uint64_t inode_number,
+     int parent_index,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_snapshot_append_entry(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libcdirectory_tree_snapshot_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libcdirectory_internal_tree_snapshot_read_directory(
+     libcdirectory_internal_tree_snapshot_t *internal_tree_snapshot,
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     int record_index,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_build(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     const char *path,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_data_size(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_write_data(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_set_data(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_open(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_close(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_number_of_records(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_number_of_directories(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int *number_of_directories,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_maximum_path_size(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     size_t *maximum_path_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_directory(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int directory_index,
+     int *record_index,
+     int *first_entry_record_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_directory_index(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int record_index,
+     int *directory_index,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_record(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int record_index,
+     uint8_t *type,
+     uint64_t *size,
+     int64_t *modification_time,
+     uint64_t *inode_number,
+     int *parent_index,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_snapshot_get_record_path(
+     libcdirectory_tree_snapshot_t *tree_snapshot,
+     int record_index,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_TREE_SNAPSHOT_H ) */
+
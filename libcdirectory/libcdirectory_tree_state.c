@@ -0,0 +1,2759 @@
+/*
+ * Tree state functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_listing.h"
+#include "libcdirectory_tree_state.h"
+#include "libcdirectory_types.h"
+#include "libcdirectory_walker.h"
+
+/* The tree state data is stored in little-endian as:
+ * offset  0, size 4: the signature "cdts"
+ * offset  4, size 4: the format version
+ * offset  8, size 8: the scan time
+ * offset 16, size 4: the number of directories
+ *
+ * followed by the directories in pre-order, where every directory is stored as:
+ * offset  0, size 4: the index of the parent directory or 0xffffffff for none
+ * offset  4, size 4: the index of the entry of the directory in the parent directory
+ * offset  8, size 8: the device number
+ * offset 16, size 8: the inode number
+ * offset 24, size 8: the modification time
+ * offset 32, size 8: the inode change time
+ * offset 40, size 4: the number of entries
+ * offset 44, size 4: the size of the names
+ *
+ * followed by the entries of the directory, where every entry is stored as:
+ * offset  0, size 8: the inode number
+ * offset  8, size 4: the attributes
+ * offset 12, size 4: the name length
+ * offset 16, size 1: the type
+ *
+ * followed by the names of the entries, which are stored with an end-of-string character
+ */
+static const uint8_t libcdirectory_tree_state_signature[ 4 ] = {
+	'c', 'd', 't', 's' };
+
+/* Creates a tree state
+ * Make sure the value tree_state is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_initialize(
+     libcdirectory_tree_state_t **tree_state,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_initialize";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = memory_allocate_structure(
+	                       libcdirectory_internal_tree_state_t );
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tree state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_tree_state,
+	     0,
+	     sizeof( libcdirectory_internal_tree_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree state.",
+		 function );
+
+		goto on_error;
+	}
+	*tree_state = (libcdirectory_tree_state_t *) internal_tree_state;
+
+	return( 1 );
+
+on_error:
+	if( internal_tree_state != NULL )
+	{
+		memory_free(
+		 internal_tree_state );
+	}
+	return( -1 );
+}
+
+/* Frees a tree state
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_free(
+     libcdirectory_tree_state_t **tree_state,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_free";
+	int result                                               = 1;
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_state != NULL )
+	{
+		internal_tree_state = (libcdirectory_internal_tree_state_t *) *tree_state;
+		*tree_state         = NULL;
+
+		if( libcdirectory_internal_tree_state_clear(
+		     internal_tree_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear tree state.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_tree_state->directories != NULL )
+		{
+			memory_free(
+			 internal_tree_state->directories );
+		}
+		if( internal_tree_state->levels != NULL )
+		{
+			memory_free(
+			 internal_tree_state->levels );
+		}
+		if( internal_tree_state->path != NULL )
+		{
+			memory_free(
+			 internal_tree_state->path );
+		}
+		memory_free(
+		 internal_tree_state );
+	}
+	return( result );
+}
+
+/* Clears a tree state
+ * The listings are freed, the allocated directories and levels are retained to be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_state_clear(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_tree_state_clear";
+	int result            = 1;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_state->root_listing != NULL )
+	{
+		if( libcdirectory_listing_free_tree(
+		     &( internal_tree_state->root_listing ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root listing.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_tree_state->number_of_directories      = 0;
+	internal_tree_state->number_of_read_directories = 0;
+	internal_tree_state->number_of_levels           = 0;
+	internal_tree_state->scan_time                  = 0;
+
+	return( result );
+}
+
+/* Appends a directory to a tree state
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_state_append_directory(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_listing_t *listing,
+     int parent_index,
+     int parent_entry_index,
+     int *directory_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_tree_state_directory_t *directories = NULL;
+	static char *function                             = "libcdirectory_internal_tree_state_append_directory";
+	int number_of_allocated_directories               = 0;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_state->number_of_directories >= internal_tree_state->number_of_allocated_directories )
+	{
+		if( internal_tree_state->number_of_allocated_directories == 0 )
+		{
+			number_of_allocated_directories = LIBCDIRECTORY_TREE_STATE_INITIAL_NUMBER_OF_DIRECTORIES;
+		}
+		else if( internal_tree_state->number_of_allocated_directories > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_tree_state_directory_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tree state - number of allocated directories value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_directories = internal_tree_state->number_of_allocated_directories * 2;
+		}
+		directories = (libcdirectory_tree_state_directory_t *) memory_reallocate(
+		                                                        internal_tree_state->directories,
+		                                                        sizeof( libcdirectory_tree_state_directory_t ) * number_of_allocated_directories );
+
+		if( directories == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize directories.",
+			 function );
+
+			return( -1 );
+		}
+		internal_tree_state->directories                     = directories;
+		internal_tree_state->number_of_allocated_directories = number_of_allocated_directories;
+	}
+	*directory_index = internal_tree_state->number_of_directories;
+
+	internal_tree_state->directories[ *directory_index ].listing            = listing;
+	internal_tree_state->directories[ *directory_index ].parent_index       = parent_index;
+	internal_tree_state->directories[ *directory_index ].parent_entry_index = parent_entry_index;
+
+	internal_tree_state->number_of_directories += 1;
+
+	return( 1 );
+}
+
+/* Pushes a level onto the levels of a scan
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_state_push_level(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_listing_t *listing,
+     int directory_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_tree_state_level_t *levels = NULL;
+	static char *function                    = "libcdirectory_internal_tree_state_push_level";
+	int number_of_allocated_levels           = 0;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_state->number_of_levels >= internal_tree_state->number_of_allocated_levels )
+	{
+		if( internal_tree_state->number_of_allocated_levels == 0 )
+		{
+			number_of_allocated_levels = LIBCDIRECTORY_TREE_STATE_INITIAL_NUMBER_OF_LEVELS;
+		}
+		else if( internal_tree_state->number_of_allocated_levels > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcdirectory_tree_state_level_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tree state - number of allocated levels value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_levels = internal_tree_state->number_of_allocated_levels * 2;
+		}
+		levels = (libcdirectory_tree_state_level_t *) memory_reallocate(
+		                                               internal_tree_state->levels,
+		                                               sizeof( libcdirectory_tree_state_level_t ) * number_of_allocated_levels );
+
+		if( levels == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize levels.",
+			 function );
+
+			return( -1 );
+		}
+		internal_tree_state->levels                     = levels;
+		internal_tree_state->number_of_allocated_levels = number_of_allocated_levels;
+	}
+	internal_tree_state->levels[ internal_tree_state->number_of_levels ].listing         = listing;
+	internal_tree_state->levels[ internal_tree_state->number_of_levels ].directory_index = directory_index;
+
+	internal_tree_state->number_of_levels += 1;
+
+	return( 1 );
+}
+
+/* Sets the path of the directory that is scanned
+ * The path consists of the scanned path, the relative path of the parent directory and the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_state_set_path(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     const char *parent_path,
+     size_t parent_path_length,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	char *path            = NULL;
+	static char *function = "libcdirectory_internal_tree_state_set_path";
+	size_t path_offset    = 0;
+	size_t path_size      = 0;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_path == NULL )
+	 && ( parent_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name == NULL )
+	 && ( name_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) )
+	 || ( internal_tree_state->root_path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	path_size = internal_tree_state->root_path_length + parent_path_length + name_length + 2;
+
+	if( path_size > internal_tree_state->path_size )
+	{
+		if( path_size < ( internal_tree_state->path_size * 2 ) )
+		{
+			path_size = internal_tree_state->path_size * 2;
+		}
+		path = (char *) memory_reallocate(
+		                 internal_tree_state->path,
+		                 sizeof( char ) * path_size );
+
+		if( path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		internal_tree_state->path      = path;
+		internal_tree_state->path_size = path_size;
+	}
+	path_offset = internal_tree_state->root_path_length;
+
+	if( parent_path_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_tree_state->path[ path_offset ] ),
+		     parent_path,
+		     parent_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy parent path.",
+			 function );
+
+			return( -1 );
+		}
+		path_offset += parent_path_length;
+
+		if( name_length > 0 )
+		{
+			internal_tree_state->path[ path_offset++ ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+		}
+	}
+	if( name_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_tree_state->path[ path_offset ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+		path_offset += name_length;
+	}
+	internal_tree_state->path[ path_offset ] = 0;
+
+	internal_tree_state->path_length = path_offset - internal_tree_state->root_path_length;
+
+	return( 1 );
+}
+
+/* Compares two named listings by their name
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
+ */
+int libcdirectory_tree_state_named_listing_compare(
+     const void *first_named_listing,
+     const void *second_named_listing )
+{
+	const libcdirectory_tree_state_named_listing_t *first  = (const libcdirectory_tree_state_named_listing_t *) first_named_listing;
+	const libcdirectory_tree_state_named_listing_t *second = (const libcdirectory_tree_state_named_listing_t *) second_named_listing;
+	size_t compare_length                                  = 0;
+	int result                                             = 0;
+
+	compare_length = first->name_length;
+
+	if( compare_length > second->name_length )
+	{
+		compare_length = second->name_length;
+	}
+	if( compare_length > 0 )
+	{
+		result = memory_compare(
+		          first->name,
+		          second->name,
+		          compare_length );
+	}
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first->name_length < second->name_length )
+	{
+		return( -1 );
+	}
+	else if( first->name_length > second->name_length )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Transfers the listings of the subdirectories of a previous listing to the entries
+ * of a listing of the same directory, that have the same name
+ * The listings of the subdirectories are looked up in a sorted copy of the names
+ * of the previous listing, since the order of the entries can change
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_transfer_sub_listings(
+     libcdirectory_listing_t *previous_listing,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error )
+{
+	libcdirectory_tree_state_named_listing_t *named_listing  = NULL;
+	libcdirectory_tree_state_named_listing_t *named_listings = NULL;
+	libcdirectory_tree_state_named_listing_t search_key;
+
+	static char *function                                    = "libcdirectory_tree_state_transfer_sub_listings";
+	int entry_index                                          = 0;
+	int number_of_named_listings                             = 0;
+
+	if( previous_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < previous_listing->number_of_entries;
+	     entry_index++ )
+	{
+		if( previous_listing->entries[ entry_index ].sub_listing != NULL )
+		{
+			number_of_named_listings++;
+		}
+	}
+	if( number_of_named_listings == 0 )
+	{
+		return( 1 );
+	}
+	named_listings = (libcdirectory_tree_state_named_listing_t *) memory_allocate(
+	                                                               sizeof( libcdirectory_tree_state_named_listing_t ) * number_of_named_listings );
+
+	if( named_listings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create named listings.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_named_listings = 0;
+
+	for( entry_index = 0;
+	     entry_index < previous_listing->number_of_entries;
+	     entry_index++ )
+	{
+		if( previous_listing->entries[ entry_index ].sub_listing == NULL )
+		{
+			continue;
+		}
+		named_listing = &( named_listings[ number_of_named_listings++ ] );
+
+		named_listing->name        = &( previous_listing->names[ previous_listing->entries[ entry_index ].name_offset ] );
+		named_listing->name_length = previous_listing->entries[ entry_index ].name_length;
+		named_listing->entry_index = entry_index;
+	}
+	qsort(
+	 named_listings,
+	 (size_t) number_of_named_listings,
+	 sizeof( libcdirectory_tree_state_named_listing_t ),
+	 &libcdirectory_tree_state_named_listing_compare );
+
+	for( entry_index = 0;
+	     entry_index < listing->number_of_entries;
+	     entry_index++ )
+	{
+		if( listing->entries[ entry_index ].type != LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		{
+			continue;
+		}
+		search_key.name        = &( listing->names[ listing->entries[ entry_index ].name_offset ] );
+		search_key.name_length = listing->entries[ entry_index ].name_length;
+		search_key.entry_index = -1;
+
+		named_listing = (libcdirectory_tree_state_named_listing_t *) bsearch(
+		                                                              &search_key,
+		                                                              named_listings,
+		                                                              (size_t) number_of_named_listings,
+		                                                              sizeof( libcdirectory_tree_state_named_listing_t ),
+		                                                              &libcdirectory_tree_state_named_listing_compare );
+
+		if( named_listing != NULL )
+		{
+			listing->entries[ entry_index ].sub_listing = previous_listing->entries[ named_listing->entry_index ].sub_listing;
+
+			previous_listing->entries[ named_listing->entry_index ].sub_listing = NULL;
+		}
+	}
+	memory_free(
+	 named_listings );
+
+	return( 1 );
+}
+
+/* Reads the entries of an open directory into a listing
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_state_read_listing(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error )
+{
+	const char *name      = NULL;
+	static char *function = "libcdirectory_internal_tree_state_read_listing";
+	size_t name_length    = 0;
+	uint64_t inode_number = 0;
+	uint32_t attributes   = 0;
+	uint8_t entry_type    = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		result = libcdirectory_internal_directory_read_entry(
+		          (libcdirectory_internal_directory_t *) directory,
+		          (libcdirectory_internal_directory_entry_t *) directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     directory_entry,
+		     (char **) &name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( name[ 0 ] == '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		name_length = narrow_string_length(
+		               name );
+
+		/* The type is retrieved first since it can resolve an unknown type
+		 */
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_internal_directory_entry_get_detached_values(
+		     (libcdirectory_internal_directory_entry_t *) directory_entry,
+		     &attributes,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdirectory_listing_append_entry(
+		     listing,
+		     name,
+		     name_length,
+		     entry_type,
+		     attributes,
+		     inode_number,
+		     &entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to listing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the directory of the path of the tree state
+ * The entries of the directory are only read when the directory changed since the previous
+ * listing was created, otherwise the previous listing is reused. The previous listing is
+ * reused or freed, and the listings of its subdirectories are retained for the next scan
+ * Returns 1 if successful, 0 if the directory was skipped or -1 on error
+ */
+int libcdirectory_internal_tree_state_scan_directory(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcdirectory_listing_t *previous_listing,
+     int64_t previous_scan_time,
+     int depth,
+     uint8_t flags,
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error )
+{
+	libcdirectory_listing_t *read_listing = NULL;
+	static char *function                 = "libcdirectory_internal_tree_state_scan_directory";
+	uint64_t device_number                = 0;
+	uint64_t inode_number                 = 0;
+	int64_t inode_change_time             = 0;
+	int64_t modification_time             = 0;
+	int is_open                           = 0;
+	int is_unchanged                      = 0;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_state->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tree state - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *listing != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid listing value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_open(
+	     directory,
+	     internal_tree_state->path,
+	     error ) != 1 )
+	{
+		if( ( depth > 0 )
+		 && ( ( flags & LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			goto on_skip;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	is_open = 1;
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	if( libcdirectory_internal_directory_get_change_values(
+	     (libcdirectory_internal_directory_t *) directory,
+	     &device_number,
+	     &inode_number,
+	     &modification_time,
+	     &inode_change_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory change values.",
+		 function );
+
+		goto on_error;
+	}
+	if( depth == 0 )
+	{
+		internal_tree_state->root_device_number = device_number;
+	}
+	else if( ( ( flags & LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM ) != 0 )
+	      && ( device_number != internal_tree_state->root_device_number ) )
+	{
+		goto on_skip;
+	}
+	/* A directory that was changed shortly before the previous scan can have
+	 * changed again after it was read without a change of its timestamps
+	 */
+	if( ( previous_listing != NULL )
+	 && ( previous_listing->device_number == device_number )
+	 && ( previous_listing->inode_number == inode_number )
+	 && ( previous_listing->modification_time == modification_time )
+	 && ( previous_listing->inode_change_time == inode_change_time )
+	 && ( previous_listing->modification_time < ( previous_scan_time - LIBCDIRECTORY_TREE_STATE_RACY_INTERVAL ) )
+	 && ( previous_listing->inode_change_time < ( previous_scan_time - LIBCDIRECTORY_TREE_STATE_RACY_INTERVAL ) ) )
+	{
+		is_unchanged = 1;
+	}
+#endif /* defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER ) */
+
+	if( is_unchanged != 0 )
+	{
+		read_listing     = previous_listing;
+		previous_listing = NULL;
+
+		read_listing->state = LIBCDIRECTORY_LISTING_STATE_REUSED;
+	}
+	else
+	{
+		if( libcdirectory_listing_initialize(
+		     &read_listing,
+		     &( internal_tree_state->path[ internal_tree_state->root_path_length ] ),
+		     internal_tree_state->path_length,
+		     depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create listing.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdirectory_internal_tree_state_read_listing(
+		     internal_tree_state,
+		     directory,
+		     directory_entry,
+		     read_listing,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read listing.",
+			 function );
+
+			goto on_error;
+		}
+		if( previous_listing != NULL )
+		{
+			if( libcdirectory_tree_state_transfer_sub_listings(
+			     previous_listing,
+			     read_listing,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transfer sub listings.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdirectory_listing_free_tree(
+			     &previous_listing,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free previous listing.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		read_listing->state = LIBCDIRECTORY_LISTING_STATE_READ;
+
+		internal_tree_state->number_of_read_directories += 1;
+	}
+	is_open = 0;
+
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	read_listing->device_number     = device_number;
+	read_listing->inode_number      = inode_number;
+	read_listing->modification_time = modification_time;
+	read_listing->inode_change_time = inode_change_time;
+	read_listing->parent_listing    = NULL;
+	read_listing->entry_index       = 0;
+
+	*listing = read_listing;
+
+	return( 1 );
+
+on_skip:
+	if( is_open != 0 )
+	{
+		if( libcdirectory_directory_close(
+		     directory,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( previous_listing != NULL )
+	{
+		if( libcdirectory_listing_free_tree(
+		     &previous_listing,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous listing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( is_open != 0 )
+	{
+		libcdirectory_directory_close(
+		 directory,
+		 NULL );
+	}
+	if( read_listing != NULL )
+	{
+		libcdirectory_listing_free_tree(
+		 &read_listing,
+		 NULL );
+	}
+	if( previous_listing != NULL )
+	{
+		libcdirectory_listing_free_tree(
+		 &previous_listing,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans a directory tree
+ * The listings of the previous scan or of the data that was read are used for the directories
+ * of which the device number, inode number, modification time and inode change time did not
+ * change, so that only the entries of the directories that changed are read. The subdirectories
+ * of every directory are scanned, since a change of a subdirectory does not change its parent
+ * The supported flags are LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE and
+ * LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM. On error the tree state is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_scan(
+     libcdirectory_tree_state_t *tree_state,
+     const char *path,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *directory_entry         = NULL;
+	libcdirectory_directory_t *directory                     = NULL;
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	libcdirectory_listing_t *listing                         = NULL;
+	libcdirectory_listing_t *previous_listing                = NULL;
+	libcdirectory_listing_t *sub_listing                     = NULL;
+	libcdirectory_tree_state_level_t *level                  = NULL;
+	static char *function                                    = "libcdirectory_tree_state_scan";
+	size_t path_length                                       = 0;
+	time_t current_time                                      = 0;
+	int64_t previous_scan_time                               = 0;
+	int64_t scan_time                                        = 0;
+	int directory_index                                      = 0;
+	int entry_index                                          = 0;
+	int result                                               = 0;
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCDIRECTORY_TREE_STATE_SUPPORTED_FLAGS ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The scan time is determined before any directory is read, a scan time
+	 * that cannot be determined causes every directory to be read by the next scan
+	 */
+	current_time = time(
+	                NULL );
+
+	if( current_time != (time_t) -1 )
+	{
+		scan_time = (int64_t) current_time * 1000000000;
+	}
+	previous_listing   = internal_tree_state->root_listing;
+	previous_scan_time = internal_tree_state->scan_time;
+
+	internal_tree_state->root_listing               = NULL;
+	internal_tree_state->number_of_directories      = 0;
+	internal_tree_state->number_of_read_directories = 0;
+	internal_tree_state->number_of_levels           = 0;
+	internal_tree_state->root_path_length           = 0;
+
+	if( libcdirectory_internal_tree_state_set_path(
+	     internal_tree_state,
+	     NULL,
+	     0,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		goto on_error;
+	}
+	if( path[ path_length - 1 ] != (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR )
+	{
+		internal_tree_state->path[ path_length++ ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+		internal_tree_state->path[ path_length ]   = 0;
+	}
+	internal_tree_state->root_path_length = path_length;
+	internal_tree_state->path_length      = 0;
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	/* The previous listing is passed on to the scan of the directory, which
+	 * reuses or frees it
+	 */
+	listing          = previous_listing;
+	previous_listing = NULL;
+
+	result = libcdirectory_internal_tree_state_scan_directory(
+	          internal_tree_state,
+	          directory,
+	          directory_entry,
+	          listing,
+	          previous_scan_time,
+	          0,
+	          flags,
+	          &( internal_tree_state->root_listing ),
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_internal_tree_state_append_directory(
+	     internal_tree_state,
+	     internal_tree_state->root_listing,
+	     -1,
+	     0,
+	     &directory_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_internal_tree_state_push_level(
+	     internal_tree_state,
+	     internal_tree_state->root_listing,
+	     directory_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push level.",
+		 function );
+
+		goto on_error;
+	}
+	while( internal_tree_state->number_of_levels > 0 )
+	{
+		level   = &( internal_tree_state->levels[ internal_tree_state->number_of_levels - 1 ] );
+		listing = level->listing;
+
+		while( listing->entry_index < listing->number_of_entries )
+		{
+			if( listing->entries[ listing->entry_index ].type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+			{
+				break;
+			}
+			listing->entry_index += 1;
+		}
+		if( listing->entry_index >= listing->number_of_entries )
+		{
+			internal_tree_state->number_of_levels -= 1;
+
+			continue;
+		}
+		entry_index = listing->entry_index;
+
+		listing->entry_index += 1;
+
+		/* The listing of the subdirectory of the previous scan is passed on
+		 * to the scan of the subdirectory, which reuses or frees it
+		 */
+		sub_listing = listing->entries[ entry_index ].sub_listing;
+
+		listing->entries[ entry_index ].sub_listing = NULL;
+
+		if( libcdirectory_internal_tree_state_set_path(
+		     internal_tree_state,
+		     listing->path,
+		     listing->path_length,
+		     &( listing->names[ listing->entries[ entry_index ].name_offset ] ),
+		     listing->entries[ entry_index ].name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			libcdirectory_listing_free_tree(
+			 &sub_listing,
+			 NULL );
+
+			goto on_error;
+		}
+		previous_listing = sub_listing;
+		sub_listing      = NULL;
+
+		result = libcdirectory_internal_tree_state_scan_directory(
+		          internal_tree_state,
+		          directory,
+		          directory_entry,
+		          previous_listing,
+		          previous_scan_time,
+		          listing->depth + 1,
+		          flags,
+		          &sub_listing,
+		          error );
+
+		previous_listing = NULL;
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		listing->entries[ entry_index ].sub_listing = sub_listing;
+
+		if( libcdirectory_internal_tree_state_append_directory(
+		     internal_tree_state,
+		     sub_listing,
+		     level->directory_index,
+		     entry_index,
+		     &directory_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdirectory_internal_tree_state_push_level(
+		     internal_tree_state,
+		     sub_listing,
+		     directory_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push level.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_tree_state->scan_time = scan_time;
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( previous_listing != NULL )
+	{
+		libcdirectory_listing_free_tree(
+		 &previous_listing,
+		 NULL );
+	}
+	libcdirectory_internal_tree_state_clear(
+	 internal_tree_state,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of directories of the last scan
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_get_number_of_directories(
+     libcdirectory_tree_state_t *tree_state,
+     int *number_of_directories,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_get_number_of_directories";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directories = internal_tree_state->number_of_directories;
+
+	return( 1 );
+}
+
+/* Retrieves the number of directories of which the entries were read by the last scan
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_get_number_of_read_directories(
+     libcdirectory_tree_state_t *tree_state,
+     int *number_of_read_directories,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_get_number_of_read_directories";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( number_of_read_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_read_directories = internal_tree_state->number_of_read_directories;
+
+	return( 1 );
+}
+
+/* Retrieves the relative path of a specific directory
+ * The scanned directory has an empty path and is stored at index 0
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_get_directory_path(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	libcdirectory_listing_t *listing                         = NULL;
+	static char *function                                    = "libcdirectory_tree_state_get_directory_path";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_tree_state->number_of_directories ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	listing = internal_tree_state->directories[ directory_index ].listing;
+
+	*path        = listing->path;
+	*path_length = listing->path_length;
+
+	return( 1 );
+}
+
+/* Determines if the entries of a specific directory were read by the last scan
+ * Returns 1 if the entries were read, 0 if the entries of a previous scan were reused or -1 on error
+ */
+int libcdirectory_tree_state_directory_was_read(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_directory_was_read";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_tree_state->number_of_directories ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree_state->directories[ directory_index ].listing->state == LIBCDIRECTORY_LISTING_STATE_READ )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of entries of a specific directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_get_number_of_entries(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_get_number_of_entries";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_tree_state->number_of_directories ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_tree_state->directories[ directory_index ].listing->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry of a specific directory
+ * The name is stored with an end-of-string character and remains valid until the next scan
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_get_entry(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     int entry_index,
+     const char **name,
+     size_t *name_length,
+     uint8_t *type,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	libcdirectory_listing_t *listing                         = NULL;
+	static char *function                                    = "libcdirectory_tree_state_get_entry";
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_tree_state->number_of_directories ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	listing = internal_tree_state->directories[ directory_index ].listing;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= listing->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name length.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	*name         = &( listing->names[ listing->entries[ entry_index ].name_offset ] );
+	*name_length  = listing->entries[ entry_index ].name_length;
+	*type         = listing->entries[ entry_index ].type;
+	*inode_number = listing->entries[ entry_index ].inode_number;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data needed to store a tree state
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_get_data_size(
+     libcdirectory_tree_state_t *tree_state,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	libcdirectory_listing_t *listing                         = NULL;
+	static char *function                                    = "libcdirectory_tree_state_get_data_size";
+	size_t safe_data_size                                    = 0;
+	size_t directory_data_size                               = 0;
+	int directory_index                                      = 0;
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = LIBCDIRECTORY_TREE_STATE_HEADER_DATA_SIZE;
+
+	for( directory_index = 0;
+	     directory_index < internal_tree_state->number_of_directories;
+	     directory_index++ )
+	{
+		listing = internal_tree_state->directories[ directory_index ].listing;
+
+		if( ( listing->number_of_entries > (int) ( UINT32_MAX / LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE ) )
+		 || ( listing->names_size > (size_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid listing: %d - value out of bounds.",
+			 function,
+			 directory_index );
+
+			return( -1 );
+		}
+		directory_data_size = LIBCDIRECTORY_TREE_STATE_DIRECTORY_DATA_SIZE
+		                    + ( (size_t) listing->number_of_entries * LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE )
+		                    + listing->names_size;
+
+		if( safe_data_size > ( (size_t) SSIZE_MAX - directory_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_data_size += directory_data_size;
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes a tree state to data
+ * Use libcdirectory_tree_state_get_data_size to determine the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_write_data(
+     libcdirectory_tree_state_t *tree_state,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	libcdirectory_listing_entry_t *listing_entry             = NULL;
+	libcdirectory_listing_t *listing                         = NULL;
+	libcdirectory_tree_state_directory_t *directory          = NULL;
+	static char *function                                    = "libcdirectory_tree_state_write_data";
+	size_t data_offset                                       = 0;
+	size_t required_data_size                                = 0;
+	uint32_t parent_index                                    = 0;
+	int directory_index                                      = 0;
+	int entry_index                                          = 0;
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_tree_state_get_data_size(
+	     tree_state,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < required_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     libcdirectory_tree_state_signature,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 LIBCDIRECTORY_TREE_STATE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 (uint64_t) internal_tree_state->scan_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 (uint32_t) internal_tree_state->number_of_directories );
+
+	data_offset = LIBCDIRECTORY_TREE_STATE_HEADER_DATA_SIZE;
+
+	for( directory_index = 0;
+	     directory_index < internal_tree_state->number_of_directories;
+	     directory_index++ )
+	{
+		directory = &( internal_tree_state->directories[ directory_index ] );
+		listing   = directory->listing;
+
+		if( directory->parent_index < 0 )
+		{
+			parent_index = 0xffffffffUL;
+		}
+		else
+		{
+			parent_index = (uint32_t) directory->parent_index;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 parent_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 4 ] ),
+		 (uint32_t) directory->parent_entry_index );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 listing->device_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 listing->inode_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 24 ] ),
+		 (uint64_t) listing->modification_time );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 32 ] ),
+		 (uint64_t) listing->inode_change_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 40 ] ),
+		 (uint32_t) listing->number_of_entries );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 44 ] ),
+		 (uint32_t) listing->names_size );
+
+		data_offset += LIBCDIRECTORY_TREE_STATE_DIRECTORY_DATA_SIZE;
+
+		for( entry_index = 0;
+		     entry_index < listing->number_of_entries;
+		     entry_index++ )
+		{
+			listing_entry = &( listing->entries[ entry_index ] );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 listing_entry->inode_number );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 listing_entry->attributes );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + 12 ] ),
+			 (uint32_t) listing_entry->name_length );
+
+			data[ data_offset + 16 ] = listing_entry->type;
+
+			data_offset += LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE;
+		}
+		if( listing->names_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     listing->names,
+			     listing->names_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy names.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += listing->names_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a directory of a tree state from data
+ * The listing of the directory is appended to the listing of its parent directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_tree_state_read_directory_data(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     int directory_index,
+     libcerror_error_t **error )
+{
+	libcdirectory_listing_t *listing        = NULL;
+	libcdirectory_listing_t *parent_listing = NULL;
+	const char *name                        = NULL;
+	const uint8_t *entry_data               = NULL;
+	static char *function                   = "libcdirectory_internal_tree_state_read_directory_data";
+	size_t entries_data_size                = 0;
+	size_t name_offset                      = 0;
+	size_t names_size                       = 0;
+	size_t safe_data_offset                 = 0;
+	uint64_t device_number                  = 0;
+	uint64_t entry_inode_number             = 0;
+	uint64_t inode_number                   = 0;
+	uint64_t value_64bit                    = 0;
+	uint32_t attributes                     = 0;
+	uint32_t name_length                    = 0;
+	uint32_t number_of_entries              = 0;
+	uint32_t parent_entry_index             = 0;
+	uint32_t parent_index                   = 0;
+	int64_t inode_change_time               = 0;
+	int64_t modification_time               = 0;
+	int depth                               = 0;
+	int entry_index                         = 0;
+	int result_entry_index                  = 0;
+
+	if( internal_tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( ( safe_data_offset > data_size )
+	 || ( ( data_size - safe_data_offset ) < LIBCDIRECTORY_TREE_STATE_DIRECTORY_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory: %d data size value out of bounds.",
+		 function,
+		 directory_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset ] ),
+	 parent_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 4 ] ),
+	 parent_entry_index );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ safe_data_offset + 8 ] ),
+	 device_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ safe_data_offset + 16 ] ),
+	 inode_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ safe_data_offset + 24 ] ),
+	 value_64bit );
+
+	modification_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ safe_data_offset + 32 ] ),
+	 value_64bit );
+
+	inode_change_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 40 ] ),
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 44 ] ),
+	 names_size );
+
+	safe_data_offset += LIBCDIRECTORY_TREE_STATE_DIRECTORY_DATA_SIZE;
+
+	if( directory_index == 0 )
+	{
+		if( parent_index != 0xffffffffUL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory: %d parent index value out of bounds.",
+			 function,
+			 directory_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		/* The directories are stored in pre-order, hence the parent directory
+		 * must precede the directory and the entry cannot have a listing yet
+		 */
+		if( parent_index >= (uint32_t) directory_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory: %d parent index value out of bounds.",
+			 function,
+			 directory_index );
+
+			return( -1 );
+		}
+		parent_listing = internal_tree_state->directories[ parent_index ].listing;
+
+		if( ( parent_entry_index >= (uint32_t) parent_listing->number_of_entries )
+		 || ( parent_listing->entries[ parent_entry_index ].type != LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		 || ( parent_listing->entries[ parent_entry_index ].sub_listing != NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory: %d parent entry index value out of bounds.",
+			 function,
+			 directory_index );
+
+			return( -1 );
+		}
+		depth = parent_listing->depth + 1;
+	}
+	if( number_of_entries > (uint32_t) ( INT32_MAX / LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory: %d number of entries value out of bounds.",
+		 function,
+		 directory_index );
+
+		return( -1 );
+	}
+	entries_data_size = (size_t) number_of_entries * LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE;
+
+	if( ( entries_data_size > ( data_size - safe_data_offset ) )
+	 || ( names_size > ( data_size - safe_data_offset - entries_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory: %d entries data size value out of bounds.",
+		 function,
+		 directory_index );
+
+		return( -1 );
+	}
+	if( parent_listing == NULL )
+	{
+		if( libcdirectory_internal_tree_state_set_path(
+		     internal_tree_state,
+		     NULL,
+		     0,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libcdirectory_internal_tree_state_set_path(
+		     internal_tree_state,
+		     parent_listing->path,
+		     parent_listing->path_length,
+		     &( parent_listing->names[ parent_listing->entries[ parent_entry_index ].name_offset ] ),
+		     parent_listing->entries[ parent_entry_index ].name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdirectory_listing_initialize(
+	     &listing,
+	     &( internal_tree_state->path[ internal_tree_state->root_path_length ] ),
+	     internal_tree_state->path_length,
+	     depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create listing.",
+		 function );
+
+		goto on_error;
+	}
+	entry_data = &( data[ safe_data_offset ] );
+	name       = (const char *) &( data[ safe_data_offset + entries_data_size ] );
+
+	for( entry_index = 0;
+	     entry_index < (int) number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 entry_data,
+		 entry_inode_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 8 ] ),
+		 attributes );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 12 ] ),
+		 name_length );
+
+		if( ( name_length == 0 )
+		 || ( (size_t) name_length >= ( names_size - name_offset ) )
+		 || ( name[ name_offset + name_length ] != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory: %d entry: %d name length value out of bounds.",
+			 function,
+			 directory_index,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libcdirectory_listing_append_entry(
+		     listing,
+		     &( name[ name_offset ] ),
+		     (size_t) name_length,
+		     entry_data[ 16 ],
+		     attributes,
+		     entry_inode_number,
+		     &result_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to listing.",
+			 function );
+
+			goto on_error;
+		}
+		entry_data  += LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE;
+		name_offset += (size_t) name_length + 1;
+	}
+	if( name_offset != names_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory: %d names size value out of bounds.",
+		 function,
+		 directory_index );
+
+		goto on_error;
+	}
+	listing->device_number     = device_number;
+	listing->inode_number      = inode_number;
+	listing->modification_time = modification_time;
+	listing->inode_change_time = inode_change_time;
+	listing->state             = LIBCDIRECTORY_LISTING_STATE_REUSED;
+
+	if( libcdirectory_internal_tree_state_append_directory(
+	     internal_tree_state,
+	     listing,
+	     ( parent_listing == NULL ) ? -1 : (int) parent_index,
+	     (int) parent_entry_index,
+	     &result_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( parent_listing == NULL )
+	{
+		internal_tree_state->root_listing = listing;
+	}
+	else
+	{
+		parent_listing->entries[ parent_entry_index ].sub_listing = listing;
+	}
+	*data_offset = safe_data_offset + entries_data_size + names_size;
+
+	return( 1 );
+
+on_error:
+	if( listing != NULL )
+	{
+		libcdirectory_listing_free(
+		 &listing,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a tree state from data
+ * The listings of the tree state are replaced by those of the data, which are
+ * reused by the next scan for the directories that did not change
+ * On error the tree state is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_tree_state_read_data(
+     libcdirectory_tree_state_t *tree_state,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_tree_state_t *internal_tree_state = NULL;
+	static char *function                                    = "libcdirectory_tree_state_read_data";
+	size_t data_offset                                       = 0;
+	uint64_t value_64bit                                     = 0;
+	uint32_t format_version                                  = 0;
+	uint32_t number_of_directories                           = 0;
+	int directory_index                                      = 0;
+
+	if( tree_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state = (libcdirectory_internal_tree_state_t *) tree_state;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBCDIRECTORY_TREE_STATE_HEADER_DATA_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     libcdirectory_tree_state_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported tree state signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 format_version );
+
+	if( format_version != LIBCDIRECTORY_TREE_STATE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported tree state format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 value_64bit );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 number_of_directories );
+
+	/* A negative scan time is not supported since it is used to determine
+	 * the directories that changed shortly before the scan
+	 */
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directories > (uint32_t) ( ( data_size - LIBCDIRECTORY_TREE_STATE_HEADER_DATA_SIZE ) / LIBCDIRECTORY_TREE_STATE_DIRECTORY_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directories value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_tree_state_clear(
+	     internal_tree_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear tree state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_state->root_path_length = 0;
+
+	data_offset = LIBCDIRECTORY_TREE_STATE_HEADER_DATA_SIZE;
+
+	for( directory_index = 0;
+	     directory_index < (int) number_of_directories;
+	     directory_index++ )
+	{
+		if( libcdirectory_internal_tree_state_read_directory_data(
+		     internal_tree_state,
+		     data,
+		     data_size,
+		     &data_offset,
+		     directory_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory: %d.",
+			 function,
+			 directory_index );
+
+			goto on_error;
+		}
+	}
+	internal_tree_state->scan_time = (int64_t) value_64bit;
+
+	return( 1 );
+
+on_error:
+	libcdirectory_internal_tree_state_clear(
+	 internal_tree_state,
+	 NULL );
+
+	return( -1 );
+}
+
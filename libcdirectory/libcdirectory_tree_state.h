@@ -0,0 +1,334 @@
+/*
+ * Tree state functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_TREE_STATE_H )
+#define _LIBCDIRECTORY_TREE_STATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_extern.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_listing.h"
+#include "libcdirectory_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The tree state format version
+ */
+#define LIBCDIRECTORY_TREE_STATE_FORMAT_VERSION			1
+
+/* The sizes of the tree state data header, directory and entry
+ */
+#define LIBCDIRECTORY_TREE_STATE_HEADER_DATA_SIZE		20
+#define LIBCDIRECTORY_TREE_STATE_DIRECTORY_DATA_SIZE		48
+#define LIBCDIRECTORY_TREE_STATE_ENTRY_DATA_SIZE		17
+
+/* The initial number of directories and levels of a tree state
+ */
+#define LIBCDIRECTORY_TREE_STATE_INITIAL_NUMBER_OF_DIRECTORIES	64
+#define LIBCDIRECTORY_TREE_STATE_INITIAL_NUMBER_OF_LEVELS	16
+
+/* The interval in nanoseconds before the start of a scan in which a change
+ * of a directory is not considered reliable, since a timestamp with a coarse
+ * granularity does not change when the directory is changed again within it
+ */
+#define LIBCDIRECTORY_TREE_STATE_RACY_INTERVAL			LIBCDIRECTORY_DIRECTORY_RACY_INTERVAL
+
+/* The walker flags that are supported by a scan
+ */
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+#define LIBCDIRECTORY_TREE_STATE_SUPPORTED_FLAGS \
+	( LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE | LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM )
+#else
+#define LIBCDIRECTORY_TREE_STATE_SUPPORTED_FLAGS \
+	LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE
+#endif
+
+typedef struct libcdirectory_tree_state_directory libcdirectory_tree_state_directory_t;
+
+struct libcdirectory_tree_state_directory
+{
+	/* The listing
+	 */
+	libcdirectory_listing_t *listing;
+
+	/* The index of the parent directory, where -1 represents none
+	 */
+	int parent_index;
+
+	/* The index of the entry of the directory in the parent directory
+	 */
+	int parent_entry_index;
+};
+
+typedef struct libcdirectory_tree_state_level libcdirectory_tree_state_level_t;
+
+struct libcdirectory_tree_state_level
+{
+	/* The listing
+	 */
+	libcdirectory_listing_t *listing;
+
+	/* The index of the directory
+	 */
+	int directory_index;
+};
+
+typedef struct libcdirectory_tree_state_named_listing libcdirectory_tree_state_named_listing_t;
+
+/* A named listing is the listing of a subdirectory of a previous scan
+ * that is looked up by name when its parent directory has changed
+ */
+struct libcdirectory_tree_state_named_listing
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The entry index
+	 */
+	int entry_index;
+};
+
+typedef struct libcdirectory_internal_tree_state libcdirectory_internal_tree_state_t;
+
+/* A tree state contains the listings of the directories of a tree, which are
+ * reused by a subsequent scan for the directories that did not change
+ */
+struct libcdirectory_internal_tree_state
+{
+	/* The listing of the scanned directory, which contains the listings
+	 * of its subdirectories
+	 */
+	libcdirectory_listing_t *root_listing;
+
+	/* The directories, which are stored in pre-order
+	 */
+	libcdirectory_tree_state_directory_t *directories;
+
+	/* The number of directories
+	 */
+	int number_of_directories;
+
+	/* The number of allocated directories
+	 */
+	int number_of_allocated_directories;
+
+	/* The number of directories of which the entries were read by the last scan
+	 */
+	int number_of_read_directories;
+
+	/* The start time of the last scan in POSIX time in nanoseconds
+	 */
+	int64_t scan_time;
+
+	/* The device number of the scanned directory
+	 */
+	uint64_t root_device_number;
+
+	/* The levels of a scan
+	 */
+	libcdirectory_tree_state_level_t *levels;
+
+	/* The number of levels
+	 */
+	int number_of_levels;
+
+	/* The number of allocated levels
+	 */
+	int number_of_allocated_levels;
+
+	/* The path of the directory that is scanned, which starts with the
+	 * scanned path and a separator
+	 */
+	char *path;
+
+	/* The size of the path
+	 */
+	size_t path_size;
+
+	/* The length of the scanned path and separator in the path
+	 */
+	size_t root_path_length;
+
+	/* The length of the path of the directory that is scanned
+	 */
+	size_t path_length;
+};
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_initialize(
+     libcdirectory_tree_state_t **tree_state,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_free(
+     libcdirectory_tree_state_t **tree_state,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_clear(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_append_directory(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_listing_t *listing,
+     int parent_index,
+     int parent_entry_index,
+     int *directory_index,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_push_level(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_listing_t *listing,
+     int directory_index,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_set_path(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     const char *parent_path,
+     size_t parent_path_length,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libcdirectory_tree_state_named_listing_compare(
+     const void *first_named_listing,
+     const void *second_named_listing );
+
+int libcdirectory_tree_state_transfer_sub_listings(
+     libcdirectory_listing_t *previous_listing,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_read_listing(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcdirectory_listing_t *listing,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_scan_directory(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     libcdirectory_directory_t *directory,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcdirectory_listing_t *previous_listing,
+     int64_t previous_scan_time,
+     int depth,
+     uint8_t flags,
+     libcdirectory_listing_t **listing,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_scan(
+     libcdirectory_tree_state_t *tree_state,
+     const char *path,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_get_number_of_directories(
+     libcdirectory_tree_state_t *tree_state,
+     int *number_of_directories,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_get_number_of_read_directories(
+     libcdirectory_tree_state_t *tree_state,
+     int *number_of_read_directories,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_get_directory_path(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_directory_was_read(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_get_number_of_entries(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_get_entry(
+     libcdirectory_tree_state_t *tree_state,
+     int directory_index,
+     int entry_index,
+     const char **name,
+     size_t *name_length,
+     uint8_t *type,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_get_data_size(
+     libcdirectory_tree_state_t *tree_state,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_write_data(
+     libcdirectory_tree_state_t *tree_state,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_tree_state_read_directory_data(
+     libcdirectory_internal_tree_state_t *internal_tree_state,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     int directory_index,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_tree_state_read_data(
+     libcdirectory_tree_state_t *tree_state,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_TREE_STATE_H ) */
+
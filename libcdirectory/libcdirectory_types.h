@@ -36,10 +36,20 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libcdirectory_directory {}	libcdirectory_directory_t;
 typedef struct libcdirectory_directory_entry {}	libcdirectory_directory_entry_t;
+typedef struct libcdirectory_disk_usage {}	libcdirectory_disk_usage_t;
+typedef struct libcdirectory_parallel_walker {}	libcdirectory_parallel_walker_t;
+typedef struct libcdirectory_tree_snapshot {}	libcdirectory_tree_snapshot_t;
+typedef struct libcdirectory_tree_state {}	libcdirectory_tree_state_t;
+typedef struct libcdirectory_walker {}		libcdirectory_walker_t;
 
 #else
 typedef intptr_t libcdirectory_directory_t;
 typedef intptr_t libcdirectory_directory_entry_t;
+typedef intptr_t libcdirectory_disk_usage_t;
+typedef intptr_t libcdirectory_parallel_walker_t;
+typedef intptr_t libcdirectory_tree_snapshot_t;
+typedef intptr_t libcdirectory_tree_state_t;
+typedef intptr_t libcdirectory_walker_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -0,0 +1,2274 @@
+/*
+ * Directory tree walker functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcdirectory_definitions.h"
+#include "libcdirectory_directory.h"
+#include "libcdirectory_directory_entry.h"
+#include "libcdirectory_inode_set.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_types.h"
+#include "libcdirectory_walker.h"
+
+/* Creates a walker
+ * Make sure the value walker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_initialize(
+     libcdirectory_walker_t **walker,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_initialize";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *walker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = memory_allocate_structure(
+	                   libcdirectory_internal_walker_t );
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create walker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_walker,
+	     0,
+	     sizeof( libcdirectory_internal_walker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear walker.",
+		 function );
+
+		goto on_error;
+	}
+	*walker = (libcdirectory_walker_t *) internal_walker;
+
+	return( 1 );
+
+on_error:
+	if( internal_walker != NULL )
+	{
+		memory_free(
+		 internal_walker );
+	}
+	return( -1 );
+}
+
+/* Frees a walker
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_free(
+     libcdirectory_walker_t **walker,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_free";
+	int level_index                                  = 0;
+	int result                                       = 1;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *walker != NULL )
+	{
+		internal_walker = (libcdirectory_internal_walker_t *) *walker;
+
+		if( internal_walker->is_open != 0 )
+		{
+			if( libcdirectory_walker_close(
+			     *walker,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close walker.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_walker->levels != NULL )
+		{
+			for( level_index = 0;
+			     level_index < internal_walker->number_of_allocated_levels;
+			     level_index++ )
+			{
+				if( internal_walker->levels[ level_index ].directory != NULL )
+				{
+					if( libcdirectory_directory_free(
+					     &( internal_walker->levels[ level_index ].directory ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free level: %d directory.",
+						 function,
+						 level_index );
+
+						result = -1;
+					}
+				}
+				if( internal_walker->levels[ level_index ].directory_entry != NULL )
+				{
+					if( libcdirectory_directory_entry_free(
+					     &( internal_walker->levels[ level_index ].directory_entry ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free level: %d directory entry.",
+						 function,
+						 level_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 internal_walker->levels );
+		}
+		if( internal_walker->path != NULL )
+		{
+			memory_free(
+			 internal_walker->path );
+		}
+		if( internal_walker->inode_set != NULL )
+		{
+			if( libcdirectory_inode_set_free(
+			     &( internal_walker->inode_set ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode set.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+		if( internal_walker->open_path != NULL )
+		{
+			memory_free(
+			 internal_walker->open_path );
+		}
+#endif
+		*walker = NULL;
+
+		memory_free(
+		 internal_walker );
+	}
+	return( result );
+}
+
+/* Sets the read buffer size of the directories
+ * A read buffer size of 0 represents the system default
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_set_read_buffer_size(
+     libcdirectory_walker_t *walker,
+     size_t read_buffer_size,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_set_read_buffer_size";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker - walker already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_buffer_size != 0 )
+	 && ( read_buffer_size < LIBCDIRECTORY_DIRECTORY_MINIMUM_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid read buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_size > (size_t) LIBCDIRECTORY_DIRECTORY_MAXIMUM_READ_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker->read_buffer_size = read_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum depth
+ * The entries of the directory the walker was opened with have depth 1
+ * and a maximum depth of 0 represents no maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_set_maximum_depth(
+     libcdirectory_walker_t *walker,
+     int maximum_depth,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_set_maximum_depth";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( maximum_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum depth value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker->maximum_depth = maximum_depth;
+
+	return( 1 );
+}
+
+/* Sets the flags
+ * LIBCDIRECTORY_WALKER_FLAG_DETECT_CYCLES, LIBCDIRECTORY_WALKER_FLAG_DETECT_HARD_LINKS and
+ * LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM are only supported when the device and inode
+ * number of a directory can be retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_set_flags(
+     libcdirectory_walker_t *walker,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_set_flags";
+	uint8_t supported_flags                          = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	supported_flags = LIBCDIRECTORY_WALKER_FLAG_POST_ORDER
+	                | LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE
+	                | LIBCDIRECTORY_WALKER_FLAG_FOLLOW_SYMBOLIC_LINKS;
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	supported_flags |= LIBCDIRECTORY_WALKER_FLAG_DETECT_CYCLES
+	                 | LIBCDIRECTORY_WALKER_FLAG_DETECT_HARD_LINKS
+	                 | LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM;
+#endif
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( internal_walker->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker - walker already open.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker->flags = flags;
+
+	return( 1 );
+}
+
+/* Retrieves a specific level
+ * The levels are allocated on demand and the directory of a level is
+ * reused for every directory that is opened at the level
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_walker_get_level(
+     libcdirectory_internal_walker_t *internal_walker,
+     int level_index,
+     libcdirectory_walker_level_t **level,
+     libcerror_error_t **error )
+{
+	libcdirectory_walker_level_t *levels = NULL;
+	static char *function                = "libcdirectory_internal_walker_get_level";
+	int number_of_allocated_levels       = 0;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( level_index < 0 )
+	 || ( level_index > internal_walker->number_of_allocated_levels ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( level_index == internal_walker->number_of_allocated_levels )
+	{
+		if( internal_walker->number_of_allocated_levels == 0 )
+		{
+			number_of_allocated_levels = 16;
+		}
+		else
+		{
+			if( internal_walker->number_of_allocated_levels > ( ( INT_MAX / 2 ) / (int) sizeof( libcdirectory_walker_level_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated levels value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_levels = internal_walker->number_of_allocated_levels * 2;
+		}
+		levels = (libcdirectory_walker_level_t *) memory_reallocate(
+		                                           internal_walker->levels,
+		                                           sizeof( libcdirectory_walker_level_t ) * number_of_allocated_levels );
+
+		if( levels == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize levels.",
+			 function );
+
+			return( -1 );
+		}
+		internal_walker->levels = levels;
+
+		if( memory_set(
+		     &( levels[ internal_walker->number_of_allocated_levels ] ),
+		     0,
+		     sizeof( libcdirectory_walker_level_t ) * ( number_of_allocated_levels - internal_walker->number_of_allocated_levels ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear levels.",
+			 function );
+
+			return( -1 );
+		}
+		internal_walker->number_of_allocated_levels = number_of_allocated_levels;
+	}
+	if( internal_walker->levels[ level_index ].directory == NULL )
+	{
+		if( libcdirectory_directory_initialize(
+		     &( internal_walker->levels[ level_index ].directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create level: %d directory.",
+			 function,
+			 level_index );
+
+			return( -1 );
+		}
+		/* The entry type is needed to determine if an entry is descended into
+		 */
+		( (libcdirectory_internal_directory_t *) internal_walker->levels[ level_index ].directory )->flags = LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE;
+	}
+	( (libcdirectory_internal_directory_t *) internal_walker->levels[ level_index ].directory )->read_buffer_size = internal_walker->read_buffer_size;
+
+	*level = &( internal_walker->levels[ level_index ] );
+
+	return( 1 );
+}
+
+/* Opens a walker on a directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_open(
+     libcdirectory_walker_t *walker,
+     const char *path,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	libcdirectory_walker_level_t *level              = NULL;
+	static char *function                            = "libcdirectory_walker_open";
+
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+	size_t path_length                               = 0;
+#endif
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker - walker already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_walker_set_path(
+	     internal_walker,
+	     0,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_walker_get_level(
+	     internal_walker,
+	     0,
+	     &level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve level: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_open(
+	     level->directory,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+	path_length = narrow_string_length(
+	               path );
+
+	if( libcdirectory_internal_walker_resize_open_path(
+	     internal_walker,
+	     path_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize open path.",
+		 function );
+
+		libcdirectory_directory_close(
+		 level->directory,
+		 NULL );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_walker->open_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		libcdirectory_directory_close(
+		 level->directory,
+		 NULL );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path[ path_length - 1 ] != (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR ) )
+	{
+		internal_walker->open_path[ path_length++ ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+	}
+	internal_walker->root_path_length = path_length;
+	internal_walker->use_open_path    = 1;
+#endif
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FILE_IDENTIFIER_FLAGS ) != 0 )
+	{
+		if( internal_walker->inode_set != NULL )
+		{
+			if( libcdirectory_inode_set_empty(
+			     internal_walker->inode_set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to empty inode set.",
+				 function );
+
+				libcdirectory_directory_close(
+				 level->directory,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcdirectory_internal_walker_visit_directory(
+		     internal_walker,
+		     level,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit directory.",
+			 function );
+
+			libcdirectory_directory_close(
+			 level->directory,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	level->path_length = 0;
+
+	internal_walker->number_of_open_levels = 1;
+	internal_walker->depth                 = 0;
+	internal_walker->descend_directory     = 0;
+	internal_walker->is_open               = 1;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a walker on a directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_open_wide(
+     libcdirectory_walker_t *walker,
+     const wchar_t *path,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	libcdirectory_walker_level_t *level              = NULL;
+	static char *function                            = "libcdirectory_walker_open_wide";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker - walker already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_walker_set_path(
+	     internal_walker,
+	     0,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_walker_get_level(
+	     internal_walker,
+	     0,
+	     &level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve level: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_open_wide(
+	     level->directory,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+	/* The directories are opened relative to their parent directory
+	 */
+	internal_walker->use_open_path = 0;
+#endif
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FILE_IDENTIFIER_FLAGS ) != 0 )
+	{
+		if( internal_walker->inode_set != NULL )
+		{
+			if( libcdirectory_inode_set_empty(
+			     internal_walker->inode_set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to empty inode set.",
+				 function );
+
+				libcdirectory_directory_close(
+				 level->directory,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcdirectory_internal_walker_visit_directory(
+		     internal_walker,
+		     level,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit directory.",
+			 function );
+
+			libcdirectory_directory_close(
+			 level->directory,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	level->path_length = 0;
+
+	internal_walker->number_of_open_levels = 1;
+	internal_walker->depth                 = 0;
+	internal_walker->descend_directory     = 0;
+	internal_walker->is_open               = 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes a walker
+ * Returns 0 if successful or -1 on error
+ */
+int libcdirectory_walker_close(
+     libcdirectory_walker_t *walker,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_close";
+	int result                                       = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid walker - walker not open.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_walker->number_of_open_levels > 0 )
+	{
+		internal_walker->number_of_open_levels -= 1;
+
+		if( libcdirectory_directory_close(
+		     internal_walker->levels[ internal_walker->number_of_open_levels ].directory,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close level: %d directory.",
+			 function,
+			 internal_walker->number_of_open_levels );
+
+			result = -1;
+		}
+	}
+	internal_walker->path_length       = 0;
+	internal_walker->name_offset       = 0;
+	internal_walker->depth             = 0;
+	internal_walker->descend_directory = 0;
+	internal_walker->is_open           = 0;
+
+	return( result );
+}
+
+/* Sets the relative path to the name of an entry in the directory with the parent path
+ * The path buffer is only resized when the path does not fit
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_walker_set_path(
+     libcdirectory_internal_walker_t *internal_walker,
+     size_t parent_path_length,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	char *path            = NULL;
+	static char *function = "libcdirectory_internal_walker_set_path";
+	size_t name_offset    = 0;
+	size_t path_size      = 0;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name == NULL )
+	 && ( name_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_path_length > internal_walker->path_length )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) - parent_path_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	name_offset = parent_path_length;
+
+	if( parent_path_length > 0 )
+	{
+		name_offset += 1;
+	}
+	if( ( name_offset + name_length + 1 ) > internal_walker->path_size )
+	{
+		path_size = internal_walker->path_size;
+
+		if( path_size == 0 )
+		{
+			path_size = LIBCDIRECTORY_WALKER_INITIAL_PATH_SIZE;
+		}
+		while( path_size < ( name_offset + name_length + 1 ) )
+		{
+			if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				path_size = name_offset + name_length + 1;
+
+				break;
+			}
+			path_size *= 2;
+		}
+		path = (char *) memory_reallocate(
+		                 internal_walker->path,
+		                 sizeof( char ) * path_size );
+
+		if( path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		internal_walker->path      = path;
+		internal_walker->path_size = path_size;
+	}
+	if( parent_path_length > 0 )
+	{
+		internal_walker->path[ parent_path_length ] = (char) LIBCDIRECTORY_WALKER_PATH_SEPARATOR;
+	}
+	if( name_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_walker->path[ name_offset ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_walker->path[ name_offset + name_length ] = 0;
+
+	internal_walker->path_length = name_offset + name_length;
+	internal_walker->name_offset = name_offset;
+
+	return( 1 );
+}
+
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+
+/* Resizes the open path to contain a path of a specific length
+ * The open path is only resized when the path does not fit
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_internal_walker_resize_open_path(
+     libcdirectory_internal_walker_t *internal_walker,
+     size_t open_path_length,
+     libcerror_error_t **error )
+{
+	char *open_path       = NULL;
+	static char *function = "libcdirectory_internal_walker_resize_open_path";
+	size_t open_path_size = 0;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_path_length >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid open path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( open_path_length + 1 ) > internal_walker->open_path_size )
+	{
+		open_path_size = internal_walker->open_path_size;
+
+		if( open_path_size == 0 )
+		{
+			open_path_size = LIBCDIRECTORY_WALKER_INITIAL_PATH_SIZE;
+		}
+		while( open_path_size < ( open_path_length + 1 ) )
+		{
+			if( open_path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				open_path_size = open_path_length + 1;
+
+				break;
+			}
+			open_path_size *= 2;
+		}
+		open_path = (char *) memory_reallocate(
+		                      internal_walker->open_path,
+		                      sizeof( char ) * open_path_size );
+
+		if( open_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize open path.",
+			 function );
+
+			return( -1 );
+		}
+		internal_walker->open_path      = open_path;
+		internal_walker->open_path_size = open_path_size;
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH ) */
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+
+/* Visits the directory of a level when cycles or hard links are detected or
+ * the walk is restricted to one file system
+ * The device number of the directory is retained for the entries of the directory
+ * Returns 1 if successful, 0 if the directory was visited before or is on another
+ * file system or -1 on error
+ */
+int libcdirectory_internal_walker_visit_directory(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_walker_level_t *level,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_walker_visit_directory";
+	uint64_t inode_number = 0;
+	int result            = 1;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_internal_directory_get_file_identifier(
+	     (libcdirectory_internal_directory_t *) level->directory,
+	     &( level->device_number ),
+	     &inode_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory device and inode number.",
+		 function );
+
+		return( -1 );
+	}
+	/* The directory can be on another file system than its directory entry,
+	 * for example when it was opened by a symbolic link
+	 */
+	if( ( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM ) != 0 )
+	 && ( level != internal_walker->levels )
+	 && ( level->device_number != internal_walker->levels[ 0 ].device_number ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_DETECT_CYCLES ) != 0 )
+	{
+		if( internal_walker->inode_set == NULL )
+		{
+			if( libcdirectory_inode_set_initialize(
+			     &( internal_walker->inode_set ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode set.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		result = libcdirectory_inode_set_insert(
+		          internal_walker->inode_set,
+		          level->device_number,
+		          inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert directory into inode set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Visits an entry, other than a directory, when hard links are detected
+ * The inode number is taken from the directory entry as read from the directory,
+ * so that no file statistics are read, and the device number from the directory
+ * Returns 1 if successful, 0 if the entry was visited before or -1 on error
+ */
+int libcdirectory_internal_walker_visit_entry(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_walker_level_t *level,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdirectory_internal_walker_visit_entry";
+	uint64_t inode_number = 0;
+	uint8_t entry_type    = 0;
+	int result            = 0;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_entry_get_type(
+	     directory_entry,
+	     &entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry type.",
+		 function );
+
+		return( -1 );
+	}
+	/* Directories cannot be hard linked and are handled by cycle detection
+	 */
+	if( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+	{
+		return( 1 );
+	}
+	result = libcdirectory_internal_directory_entry_get_entry_inode_number(
+	          (libcdirectory_internal_directory_entry_t *) directory_entry,
+	          &inode_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry inode number.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_walker->inode_set == NULL )
+	{
+		if( libcdirectory_inode_set_initialize(
+		     &( internal_walker->inode_set ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcdirectory_inode_set_insert(
+	          internal_walker->inode_set,
+	          level->device_number,
+	          inode_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert entry into inode set.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if a directory entry is on another file system than the walked directory
+ * The device number is read from the file statistics of the entry, which does not
+ * trigger an automount, so that a mount point is detected before it is opened
+ * Returns 1 if the entry is on another file system, 0 if not or not available or -1 on error
+ */
+int libcdirectory_internal_walker_is_other_file_system(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdirectory_internal_walker_is_other_file_system";
+	uint64_t device_number = 0;
+	int result             = 0;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_walker->levels == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid walker - missing levels.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdirectory_directory_entry_get_device_number(
+	          directory_entry,
+	          &device_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry device number.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( device_number != internal_walker->levels[ 0 ].device_number )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER ) */
+
+/* Descends into the directory of the last entry read
+ * The directory is opened relative to its parent directory, which uses
+ * openat where available, otherwise by its path
+ * A symbolic link is only descended into when it refers to a directory that can be opened
+ * Returns 1 if successful, 0 if the directory is skipped or -1 on error
+ */
+int libcdirectory_internal_walker_descend(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	libcdirectory_walker_level_t *level        = NULL;
+	libcdirectory_walker_level_t *parent_level = NULL;
+	static char *function                      = "libcdirectory_internal_walker_descend";
+	int level_index                            = 0;
+	int result                                 = 0;
+
+	if( internal_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_walker->number_of_open_levels <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid walker - number of open levels value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	level_index = internal_walker->number_of_open_levels;
+
+	if( libcdirectory_internal_walker_get_level(
+	     internal_walker,
+	     level_index,
+	     &level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve level: %d.",
+		 function,
+		 level_index );
+
+		return( -1 );
+	}
+	/* Retrieve the parent level after the levels were resized
+	 */
+	parent_level = &( internal_walker->levels[ level_index - 1 ] );
+
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+	if( internal_walker->use_open_path != 0 )
+	{
+		if( libcdirectory_internal_walker_resize_open_path(
+		     internal_walker,
+		     internal_walker->root_path_length + internal_walker->path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize open path.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( internal_walker->open_path[ internal_walker->root_path_length ] ),
+		     internal_walker->path,
+		     internal_walker->path_length + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+		result = libcdirectory_directory_open(
+		          level->directory,
+		          internal_walker->open_path,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libcdirectory_directory_open_at(
+		          level->directory,
+		          parent_level->directory,
+		          &( internal_walker->path[ internal_walker->name_offset ] ),
+		          error );
+	}
+	if( result != 1 )
+	{
+		if( ( internal_walker->descend_symbolic_link != 0 )
+		 || ( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %s.",
+		 function,
+		 internal_walker->path );
+
+		return( -1 );
+	}
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+	if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FILE_IDENTIFIER_FLAGS ) != 0 )
+	{
+		result = libcdirectory_internal_walker_visit_directory(
+		          internal_walker,
+		          level,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit directory: %s.",
+			 function,
+			 internal_walker->path );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libcdirectory_directory_close(
+			     level->directory,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close directory: %s.",
+				 function,
+				 internal_walker->path );
+
+				return( -1 );
+			}
+			return( 0 );
+		}
+	}
+#endif
+	if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_POST_ORDER ) != 0 )
+	{
+		if( level->directory_entry == NULL )
+		{
+			if( libcdirectory_directory_entry_initialize(
+			     &( level->directory_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create level: %d directory entry.",
+				 function,
+				 level_index );
+
+				goto on_error;
+			}
+		}
+		if( libcdirectory_directory_entry_copy(
+		     level->directory_entry,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy level: %d directory entry.",
+			 function,
+			 level_index );
+
+			goto on_error;
+		}
+	}
+	level->path_length = internal_walker->path_length;
+
+	internal_walker->number_of_open_levels += 1;
+
+	return( 1 );
+
+on_error:
+	libcdirectory_directory_close(
+	 level->directory,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the next entry of the directory tree
+ * The entries are read depth-first, a directory is returned with visit type
+ * LIBCDIRECTORY_WALKER_VISIT_TYPE_PRE_ORDER before its entries and, when
+ * LIBCDIRECTORY_WALKER_FLAG_POST_ORDER is set, with visit type
+ * LIBCDIRECTORY_WALKER_VISIT_TYPE_POST_ORDER after its entries
+ * The directory entry references data owned by the walker and is valid until
+ * the next read, use libcdirectory_directory_entry_copy to retain it
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcdirectory_walker_read_entry(
+     libcdirectory_walker_t *walker,
+     libcdirectory_directory_entry_t *directory_entry,
+     uint8_t *visit_type,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	libcdirectory_walker_level_t *level              = NULL;
+	char *name                                       = NULL;
+	static char *function                            = "libcdirectory_walker_read_entry";
+	size_t name_length                               = 0;
+	uint8_t entry_type                               = 0;
+	int result                                       = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid walker - walker not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( visit_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visit type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_walker->descend_directory != 0 )
+	{
+		internal_walker->descend_directory = 0;
+
+		if( libcdirectory_internal_walker_descend(
+		     internal_walker,
+		     directory_entry,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to descend into directory.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( internal_walker->number_of_open_levels > 0 )
+	{
+		level = &( internal_walker->levels[ internal_walker->number_of_open_levels - 1 ] );
+
+		result = libcdirectory_internal_directory_read_entry(
+		          (libcdirectory_internal_directory_t *) level->directory,
+		          (libcdirectory_internal_directory_entry_t *) directory_entry,
+		          LIBCDIRECTORY_READ_FLAG_ENTRY_VIEW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libcdirectory_directory_close(
+			     level->directory,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close directory.",
+				 function );
+
+				return( -1 );
+			}
+			internal_walker->number_of_open_levels -= 1;
+
+			if( internal_walker->number_of_open_levels == 0 )
+			{
+				break;
+			}
+			/* Truncate the path to that of the directory
+			 */
+			internal_walker->path_length = level->path_length;
+			internal_walker->depth       = internal_walker->number_of_open_levels;
+
+			internal_walker->path[ internal_walker->path_length ] = 0;
+
+			if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_POST_ORDER ) != 0 )
+			{
+				if( libcdirectory_directory_entry_copy(
+				     directory_entry,
+				     level->directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy directory entry.",
+					 function );
+
+					return( -1 );
+				}
+				*visit_type = LIBCDIRECTORY_WALKER_VISIT_TYPE_POST_ORDER;
+
+				return( 1 );
+			}
+			continue;
+		}
+		if( libcdirectory_directory_entry_get_name(
+		     directory_entry,
+		     &name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( name[ 0 ] == '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+		if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_DETECT_HARD_LINKS ) != 0 )
+		{
+			result = libcdirectory_internal_walker_visit_entry(
+			          internal_walker,
+			          level,
+			          directory_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to visit directory entry.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+		}
+#endif
+		name_length = narrow_string_length(
+		               name );
+
+		if( libcdirectory_internal_walker_set_path(
+		     internal_walker,
+		     level->path_length,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			return( -1 );
+		}
+		internal_walker->depth = internal_walker->number_of_open_levels;
+
+		if( ( internal_walker->maximum_depth == 0 )
+		 || ( internal_walker->depth < internal_walker->maximum_depth ) )
+		{
+			if( libcdirectory_directory_entry_get_type(
+			     directory_entry,
+			     &entry_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry type.",
+				 function );
+
+				return( -1 );
+			}
+			if( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+			{
+				internal_walker->descend_directory     = 1;
+				internal_walker->descend_symbolic_link = 0;
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+				if( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM ) != 0 )
+				{
+					result = libcdirectory_internal_walker_is_other_file_system(
+					          internal_walker,
+					          directory_entry,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to determine if directory entry is on another file system.",
+						 function );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						internal_walker->descend_directory = 0;
+					}
+				}
+#endif
+			}
+			else if( ( entry_type == LIBCDIRECTORY_ENTRY_TYPE_LINK )
+			      && ( ( internal_walker->flags & LIBCDIRECTORY_WALKER_FLAG_FOLLOW_SYMBOLIC_LINKS ) != 0 ) )
+			{
+				internal_walker->descend_directory     = 1;
+				internal_walker->descend_symbolic_link = 1;
+			}
+		}
+		*visit_type = LIBCDIRECTORY_WALKER_VISIT_TYPE_PRE_ORDER;
+
+		return( 1 );
+	}
+	internal_walker->path_length = 0;
+	internal_walker->depth       = 0;
+
+	internal_walker->path[ 0 ] = 0;
+
+	return( 0 );
+}
+
+/* Prunes the directory of the last entry read, so that it is not descended into
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_prune(
+     libcdirectory_walker_t *walker,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_prune";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid walker - walker not open.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker->descend_directory = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the relative path of the last entry read
+ * The path references data owned by the walker and is valid until the next read
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_get_path(
+     libcdirectory_walker_t *walker,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_get_path";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid walker - walker not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	*path        = internal_walker->path;
+	*path_length = internal_walker->path_length;
+
+	return( 1 );
+}
+
+/* Retrieves the depth of the last entry read
+ * The entries of the directory the walker was opened with have depth 1
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_get_depth(
+     libcdirectory_walker_t *walker,
+     int *depth,
+     libcerror_error_t **error )
+{
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_get_depth";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid depth.",
+		 function );
+
+		return( -1 );
+	}
+	*depth = internal_walker->depth;
+
+	return( 1 );
+}
+
+/* Walks a directory tree
+ * The pre-order callback is called for every entry before the entries of a
+ * directory are walked and the post-order callback after, where either
+ * callback can be NULL. The pre-order callback returns 1 to continue, 0 to
+ * prune the directory or -1 on error, the post-order callback returns 1
+ * to continue or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdirectory_walker_walk(
+     libcdirectory_walker_t *walker,
+     const char *path,
+     int (*pre_order_callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*post_order_callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcdirectory_internal_walker_t *internal_walker = NULL;
+	static char *function                            = "libcdirectory_walker_walk";
+	uint8_t flags                                    = 0;
+	uint8_t visit_type                               = 0;
+	int callback_result                              = 0;
+	int result                                       = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_walker = (libcdirectory_internal_walker_t *) walker;
+
+	if( internal_walker->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker - walker already open.",
+		 function );
+
+		return( -1 );
+	}
+	/* Post-order visits are only read when there is a post-order callback
+	 */
+	flags = internal_walker->flags;
+
+	if( post_order_callback != NULL )
+	{
+		internal_walker->flags |= LIBCDIRECTORY_WALKER_FLAG_POST_ORDER;
+	}
+	else
+	{
+		internal_walker->flags &= ~( LIBCDIRECTORY_WALKER_FLAG_POST_ORDER );
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_walker_open(
+	     walker,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open walker.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libcdirectory_walker_read_entry(
+		          walker,
+		          directory_entry,
+		          &visit_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( visit_type == LIBCDIRECTORY_WALKER_VISIT_TYPE_PRE_ORDER )
+		{
+			if( pre_order_callback == NULL )
+			{
+				continue;
+			}
+			callback_result = pre_order_callback(
+			          directory_entry,
+			          internal_walker->path,
+			          internal_walker->path_length,
+			          internal_walker->depth,
+			          callback_data,
+			          error );
+
+			if( callback_result == 0 )
+			{
+				internal_walker->descend_directory = 0;
+			}
+		}
+		else
+		{
+			callback_result = post_order_callback(
+			          directory_entry,
+			          internal_walker->path,
+			          internal_walker->path_length,
+			          internal_walker->depth,
+			          callback_data,
+			          error );
+		}
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for entry: %s.",
+			 function,
+			 internal_walker->path );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	if( libcdirectory_walker_close(
+	     walker,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close walker.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	internal_walker->flags = flags;
+
+	return( 1 );
+
+on_error:
+	if( internal_walker->is_open != 0 )
+	{
+		libcdirectory_walker_close(
+		 walker,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	internal_walker->flags = flags;
+
+	return( -1 );
+}
+
@@ -0,0 +1,314 @@
+/*
+ * Directory tree walker functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDIRECTORY_WALKER_H )
+#define _LIBCDIRECTORY_WALKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdirectory_directory.h"
+#include "libcdirectory_extern.h"
+#include "libcdirectory_inode_set.h"
+#include "libcdirectory_libcerror.h"
+#include "libcdirectory_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The path separator of the relative paths
+ */
+#if defined( WINAPI )
+#define LIBCDIRECTORY_WALKER_PATH_SEPARATOR		'\\'
+#else
+#define LIBCDIRECTORY_WALKER_PATH_SEPARATOR		'/'
+#endif
+
+/* The initial path size
+ */
+#define LIBCDIRECTORY_WALKER_INITIAL_PATH_SIZE		256
+
+/* The flags that require the device and inode number of the directories
+ */
+#define LIBCDIRECTORY_WALKER_FILE_IDENTIFIER_FLAGS \
+	( LIBCDIRECTORY_WALKER_FLAG_DETECT_CYCLES | LIBCDIRECTORY_WALKER_FLAG_DETECT_HARD_LINKS | LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM )
+
+/* Without openat a directory is opened by the path of the walked directory
+ * followed by its relative path
+ */
+#if !defined( WINAPI ) && !defined( LIBCDIRECTORY_HAVE_OPENAT )
+#define LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH
+#endif
+
+typedef struct libcdirectory_walker_level libcdirectory_walker_level_t;
+
+struct libcdirectory_walker_level
+{
+	/* The directory, which is reused for every directory opened at the level
+	 */
+	libcdirectory_directory_t *directory;
+
+	/* The directory entry of the directory in its parent directory, used for the post-order visit
+	 */
+	libcdirectory_directory_entry_t *directory_entry;
+
+	/* The length of the relative path of the directory
+	 */
+	size_t path_length;
+
+	/* The device number of the directory, which is only set when cycles or hard links are detected
+	 */
+	uint64_t device_number;
+};
+
+typedef struct libcdirectory_internal_walker libcdirectory_internal_walker_t;
+
+struct libcdirectory_internal_walker
+{
+	/* The read buffer size of the directories
+	 */
+	size_t read_buffer_size;
+
+	/* The maximum depth, where 0 represents no maximum
+	 */
+	int maximum_depth;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* Value to indicate the walker is open
+	 */
+	uint8_t is_open;
+
+	/* The levels
+	 */
+	libcdirectory_walker_level_t *levels;
+
+	/* The number of allocated levels
+	 */
+	int number_of_allocated_levels;
+
+	/* The number of open levels
+	 */
+	int number_of_open_levels;
+
+	/* The relative path of the last entry read
+	 */
+	char *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The offset of the name in the path
+	 */
+	size_t name_offset;
+
+	/* The depth of the last entry read
+	 */
+	int depth;
+
+	/* Value to indicate the last entry read is a directory that is descended into on the next read
+	 */
+	uint8_t descend_directory;
+
+	/* Value to indicate the directory that is descended into is referred to by a symbolic link
+	 */
+	uint8_t descend_symbolic_link;
+
+	/* The device and inode numbers of the directories and files that were visited
+	 * when cycles or hard links are detected
+	 */
+	libcdirectory_inode_set_t *inode_set;
+
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+	/* The path used to open a directory, which starts with the path of the walked directory
+	 */
+	char *open_path;
+
+	/* The open path size
+	 */
+	size_t open_path_size;
+
+	/* The length of the path of the walked directory in the open path, including the path separator
+	 */
+	size_t root_path_length;
+
+	/* Value to indicate the open path is used
+	 */
+	uint8_t use_open_path;
+#endif
+};
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_initialize(
+     libcdirectory_walker_t **walker,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_free(
+     libcdirectory_walker_t **walker,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_set_read_buffer_size(
+     libcdirectory_walker_t *walker,
+     size_t read_buffer_size,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_set_maximum_depth(
+     libcdirectory_walker_t *walker,
+     int maximum_depth,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_set_flags(
+     libcdirectory_walker_t *walker,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_walker_get_level(
+     libcdirectory_internal_walker_t *internal_walker,
+     int level_index,
+     libcdirectory_walker_level_t **level,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_open(
+     libcdirectory_walker_t *walker,
+     const char *path,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_open_wide(
+     libcdirectory_walker_t *walker,
+     const wchar_t *path,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_close(
+     libcdirectory_walker_t *walker,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_walker_set_path(
+     libcdirectory_internal_walker_t *internal_walker,
+     size_t parent_path_length,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#if defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH )
+
+int libcdirectory_internal_walker_resize_open_path(
+     libcdirectory_internal_walker_t *internal_walker,
+     size_t open_path_length,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_WALKER_HAVE_OPEN_PATH ) */
+
+#if defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER )
+
+int libcdirectory_internal_walker_visit_directory(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_walker_level_t *level,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_walker_visit_entry(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_walker_level_t *level,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libcdirectory_internal_walker_is_other_file_system(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_FILE_IDENTIFIER ) */
+
+int libcdirectory_internal_walker_descend(
+     libcdirectory_internal_walker_t *internal_walker,
+     libcdirectory_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_read_entry(
+     libcdirectory_walker_t *walker,
+     libcdirectory_directory_entry_t *directory_entry,
+     uint8_t *visit_type,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_prune(
+     libcdirectory_walker_t *walker,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_get_path(
+     libcdirectory_walker_t *walker,
+     const char **path,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_get_depth(
+     libcdirectory_walker_t *walker,
+     int *depth,
+     libcerror_error_t **error );
+
+LIBCDIRECTORY_EXTERN \
+int libcdirectory_walker_walk(
+     libcdirectory_walker_t *walker,
+     const char *path,
+     int (*pre_order_callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*post_order_callback)(
+            libcdirectory_directory_entry_t *directory_entry,
+            const char *path,
+            size_t path_length,
+            int depth,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDIRECTORY_WALKER_H ) */
+
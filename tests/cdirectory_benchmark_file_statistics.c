@@ -0,0 +1,491 @@
+/*
+ * Benchmark for reading the file statistics of directory entries in the order
+ * the entries were read versus in order of their inode number
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+
+/* The number of directory entries read per call to libcdirectory_directory_read_entries
+ */
+#define CDIRECTORY_BENCHMARK_NUMBER_OF_ENTRIES_PER_READ	65536
+
+/* Retrieves the elapsed time in seconds
+ * The wall clock time is used since reading file statistics is bound by I/O
+ */
+double cdirectory_benchmark_get_time(
+        void )
+{
+#if defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		return( (double) time_value.tv_sec + ( (double) time_value.tv_nsec / 1000000000.0 ) );
+	}
+#endif
+	return( (double) clock() / CLOCKS_PER_SEC );
+}
+
+/* Generates the directory tree, unless it already exists
+ * The tree consists of number_of_directories directories with number_of_files files each
+ * Returns 1 if successful or -1 on error
+ */
+int cdirectory_benchmark_generate_tree(
+     const char *path,
+     int number_of_directories,
+     int number_of_files )
+{
+	char file_path[ 512 ];
+
+	int directory_index = 0;
+	int file_descriptor = 0;
+	int file_index      = 0;
+
+	if( mkdir(
+	     path,
+	     0755 ) != 0 )
+	{
+		if( errno == EEXIST )
+		{
+			return( 1 );
+		}
+		fprintf(
+		 stderr,
+		 "Unable to create directory: %s\n",
+		 path );
+
+		return( -1 );
+	}
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		snprintf(
+		 file_path,
+		 sizeof( file_path ),
+		 "%s/directory%04d",
+		 path,
+		 directory_index );
+
+		if( mkdir(
+		     file_path,
+		     0755 ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create directory: %s\n",
+			 file_path );
+
+			return( -1 );
+		}
+	}
+	/* The files are created round-robin over the directories so that the inode
+	 * numbers of the files of a directory are not contiguous
+	 */
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		for( directory_index = 0;
+		     directory_index < number_of_directories;
+		     directory_index++ )
+		{
+			snprintf(
+			 file_path,
+			 sizeof( file_path ),
+			 "%s/directory%04d/file%08d",
+			 path,
+			 directory_index,
+			 file_index );
+
+			file_descriptor = open(
+			                   file_path,
+			                   O_CREAT | O_WRONLY,
+			                   0644 );
+
+			if( file_descriptor == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create file: %s\n",
+				 file_path );
+
+				return( -1 );
+			}
+			close(
+			 file_descriptor );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads all the entries of a directory and retrieves their size
+ * Returns 1 if successful or -1 on error
+ */
+int cdirectory_benchmark_read_file_statistics(
+     const char *directory_name,
+     libcdirectory_directory_entry_t **directory_entries,
+     uint8_t directory_flags,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory = NULL;
+	static char *function                = "cdirectory_benchmark_read_file_statistics";
+	uint64_t size                        = 0;
+	int entry_index                      = 0;
+	int number_of_read_entries           = 0;
+	int result                           = 0;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_set_flags(
+	     directory,
+	     directory_flags,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_open(
+	     directory,
+	     directory_name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	do
+	{
+		result = libcdirectory_directory_read_entries(
+		          directory,
+		          directory_entries,
+		          CDIRECTORY_BENCHMARK_NUMBER_OF_ENTRIES_PER_READ,
+		          &number_of_read_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_read_entries;
+		     entry_index++ )
+		{
+			if( libcdirectory_directory_entry_get_size(
+			     directory_entries[ entry_index ],
+			     &size,
+			     error ) == -1 )
+			{
+				goto on_error;
+			}
+		}
+		*number_of_entries += number_of_read_entries;
+	}
+	while( result != 0 );
+
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ * Usage: cdirectory_benchmark_file_statistics path [number_of_directories] [number_of_files] [read|inode]
+ *
+ * The directory tree is generated at path, unless it already exists. The tree is not
+ * removed afterwards so that the benchmark can be repeated. Both orders are measured
+ * unless one is specified. To measure the seek behavior of rotational storage, run
+ * each order separately with a cold cache, for example after:
+ * echo 3 > /proc/sys/vm/drop_caches
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	char directory_path[ 512 ];
+
+	libcdirectory_directory_entry_t **directory_entries = NULL;
+	libcerror_error_t *error                            = NULL;
+	const char *order_names[ 2 ]                        = { "read", "inode" };
+	uint8_t directory_flags[ 2 ]                        = { 0, LIBCDIRECTORY_DIRECTORY_FLAG_INODE_ORDER_FILE_STATISTICS };
+	double elapsed_time                                 = 0.0;
+	double start_time                                   = 0.0;
+	int directory_index                                 = 0;
+	int entry_index                                     = 0;
+	int number_of_directories                           = 16;
+	int number_of_entries                               = 0;
+	int number_of_files                                 = 4096;
+	int number_of_orders                                = 2;
+	int order_index                                     = 0;
+	int first_order_index                               = 0;
+
+	if( ( argc < 2 )
+	 || ( argc > 5 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Usage: %s path [number_of_directories] [number_of_files] [read|inode]\n",
+		 argv[ 0 ] );
+
+		return( EXIT_FAILURE );
+	}
+	if( argc > 2 )
+	{
+		number_of_directories = atoi(
+		                         argv[ 2 ] );
+
+		if( ( number_of_directories <= 0 )
+		 || ( number_of_directories > 9999 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of directories: %s\n",
+			 argv[ 2 ] );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( argc > 3 )
+	{
+		number_of_files = atoi(
+		                   argv[ 3 ] );
+
+		if( number_of_files <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of files: %s\n",
+			 argv[ 3 ] );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( argc > 4 )
+	{
+		for( first_order_index = 0;
+		     first_order_index < 2;
+		     first_order_index++ )
+		{
+			if( strcmp(
+			     argv[ 4 ],
+			     order_names[ first_order_index ] ) == 0 )
+			{
+				break;
+			}
+		}
+		if( first_order_index >= 2 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported order: %s\n",
+			 argv[ 4 ] );
+
+			return( EXIT_FAILURE );
+		}
+		number_of_orders = 1;
+	}
+	if( cdirectory_benchmark_generate_tree(
+	     argv[ 1 ],
+	     number_of_directories,
+	     number_of_files ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	directory_entries = (libcdirectory_directory_entry_t **) calloc(
+	                                                          CDIRECTORY_BENCHMARK_NUMBER_OF_ENTRIES_PER_READ,
+	                                                          sizeof( libcdirectory_directory_entry_t * ) );
+
+	if( directory_entries == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create directory entries.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	for( entry_index = 0;
+	     entry_index < CDIRECTORY_BENCHMARK_NUMBER_OF_ENTRIES_PER_READ;
+	     entry_index++ )
+	{
+		if( libcdirectory_directory_entry_initialize(
+		     &( directory_entries[ entry_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create directory entry: %d.\n",
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	for( order_index = first_order_index;
+	     order_index < first_order_index + number_of_orders;
+	     order_index++ )
+	{
+		number_of_entries = 0;
+
+		start_time = cdirectory_benchmark_get_time();
+
+		for( directory_index = 0;
+		     directory_index < number_of_directories;
+		     directory_index++ )
+		{
+			snprintf(
+			 directory_path,
+			 sizeof( directory_path ),
+			 "%s/directory%04d",
+			 argv[ 1 ],
+			 directory_index );
+
+			if( cdirectory_benchmark_read_file_statistics(
+			     directory_path,
+			     directory_entries,
+			     directory_flags[ order_index ],
+			     &number_of_entries,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read file statistics of directory: %s\n",
+				 directory_path );
+
+				goto on_error;
+			}
+		}
+		elapsed_time = cdirectory_benchmark_get_time() - start_time;
+
+		fprintf(
+		 stdout,
+		 "%s order: %d entries, %.3f seconds",
+		 order_names[ order_index ],
+		 number_of_entries,
+		 elapsed_time );
+
+		if( elapsed_time > 0.0 )
+		{
+			fprintf(
+			 stdout,
+			 ", %.0f entries per second",
+			 (double) number_of_entries / elapsed_time );
+		}
+		fprintf(
+		 stdout,
+		 "\n" );
+	}
+	for( entry_index = 0;
+	     entry_index < CDIRECTORY_BENCHMARK_NUMBER_OF_ENTRIES_PER_READ;
+	     entry_index++ )
+	{
+		libcdirectory_directory_entry_free(
+		 &( directory_entries[ entry_index ] ),
+		 NULL );
+	}
+	free(
+	 directory_entries );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entries != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < CDIRECTORY_BENCHMARK_NUMBER_OF_ENTRIES_PER_READ;
+		     entry_index++ )
+		{
+			if( directory_entries[ entry_index ] != NULL )
+			{
+				libcdirectory_directory_entry_free(
+				 &( directory_entries[ entry_index ] ),
+				 NULL );
+			}
+		}
+		free(
+		 directory_entries );
+	}
+	return( EXIT_FAILURE );
+}
+
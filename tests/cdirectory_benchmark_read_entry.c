@@ -0,0 +1,255 @@
+/*
+ * Benchmark for reading directory entries and their type
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+
+/* Reads all the entries of a directory and retrieves their type
+ * Returns 1 if successful or -1 on error
+ */
+int cdirectory_benchmark_read_entries(
+     const char *directory_name,
+     size_t read_buffer_size,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	static char *function                            = "cdirectory_benchmark_read_entries";
+	uint8_t entry_type                               = 0;
+	int result                                       = 0;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = 0;
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_set_read_buffer_size(
+	     directory,
+	     read_buffer_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_open(
+	     directory,
+	     directory_name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	do
+	{
+		result = libcdirectory_directory_read_entry_view(
+		          directory,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcdirectory_directory_entry_get_type(
+			     directory_entry,
+			     &entry_type,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			*number_of_entries += 1;
+		}
+	}
+	while( result != 0 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ * Usage: cdirectory_benchmark_read_entry directory [number_of_iterations] [read_buffer_size]
+ *
+ * The benchmark built as cdirectory_benchmark_read_entry_no_d_type uses the code path
+ * of systems without d_type, in which the entry type is determined with fstatat
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	libcerror_error_t *error   = NULL;
+	clock_t end_time           = 0;
+	clock_t start_time         = 0;
+	double elapsed_time        = 0.0;
+	size_t read_buffer_size    = 0;
+	int iteration              = 0;
+	int number_of_entries      = 0;
+	int number_of_iterations   = 10;
+
+	if( ( argc < 2 )
+	 || ( argc > 4 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Usage: %s directory [number_of_iterations] [read_buffer_size]\n",
+		 argv[ 0 ] );
+
+		return( EXIT_FAILURE );
+	}
+	if( argc > 2 )
+	{
+		number_of_iterations = atoi(
+		                        argv[ 2 ] );
+
+		if( number_of_iterations <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of iterations: %s\n",
+			 argv[ 2 ] );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( argc > 3 )
+	{
+		read_buffer_size = (size_t) strtoul(
+		                             argv[ 3 ],
+		                             NULL,
+		                             10 );
+	}
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( cdirectory_benchmark_read_entries(
+		     argv[ 1 ],
+		     read_buffer_size,
+		     &number_of_entries,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read entries of directory: %s\n",
+			 argv[ 1 ] );
+
+			goto on_error;
+		}
+	}
+	end_time = clock();
+
+	elapsed_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%d entries, %d iterations, %.3f seconds",
+	 number_of_entries,
+	 number_of_iterations,
+	 elapsed_time );
+
+	if( elapsed_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 ", %.0f entries per second",
+		 ( (double) number_of_entries * number_of_iterations ) / elapsed_time );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
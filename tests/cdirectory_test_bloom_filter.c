@@ -0,0 +1,943 @@
+/*
+ * Library Bloom filter type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_bloom_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_bloom_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_bloom_filter_initialize(
+     void )
+{
+	libcdirectory_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error                   = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_bloom_filter_initialize(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_bloom_filter_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bloom_filter = (libcdirectory_bloom_filter_t *) 0x12345678UL;
+
+	result = libcdirectory_bloom_filter_initialize(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bloom_filter = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_bloom_filter_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_bloom_filter_initialize(
+		          &bloom_filter,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( bloom_filter != NULL )
+			{
+				libcdirectory_bloom_filter_free(
+				 &bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "bloom_filter",
+			 bloom_filter );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_bloom_filter_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_bloom_filter_initialize(
+		          &bloom_filter,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( bloom_filter != NULL )
+			{
+				libcdirectory_bloom_filter_free(
+				 &bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "bloom_filter",
+			 bloom_filter );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdirectory_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_bloom_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_bloom_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_bloom_filter_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_bloom_filter_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_bloom_filter_resize(
+     void )
+{
+	libcdirectory_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error                   = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_bloom_filter_initialize(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          0,
+	          LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "bloom_filter->number_of_bits",
+	 bloom_filter->number_of_bits,
+	 (uint64_t) LIBCDIRECTORY_BLOOM_FILTER_MINIMUM_NUMBER_OF_BITS );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          1000,
+	          LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "bloom_filter->number_of_bits",
+	 bloom_filter->number_of_bits,
+	 (uint64_t) 10000 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+	 "bloom_filter->bitmap_size",
+	 bloom_filter->bitmap_size,
+	 (size_t) 1250 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+	 "bloom_filter->number_of_hash_functions",
+	 bloom_filter->number_of_hash_functions,
+	 (uint8_t) 7 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          10,
+	          LIBCDIRECTORY_BLOOM_FILTER_MAXIMUM_BITS_PER_ENTRY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+	 "bloom_filter->number_of_hash_functions",
+	 bloom_filter->number_of_hash_functions,
+	 (uint8_t) 16 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_bloom_filter_resize(
+	          NULL,
+	          10,
+	          LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          -1,
+	          LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          10,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          10,
+	          LIBCDIRECTORY_BLOOM_FILTER_MAXIMUM_BITS_PER_ENTRY + 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdirectory_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_bloom_filter_get_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_bloom_filter_get_name_hash(
+     void )
+{
+	libcdirectory_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint64_t compare_hash                      = 0;
+	uint64_t hash                              = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_bloom_filter_initialize(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          bloom_filter,
+	          "TestFile",
+	          8,
+	          &hash,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Names that only differ in case have the same hash
+	 */
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          bloom_filter,
+	          "TESTFILE",
+	          8,
+	          &compare_hash,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "compare_hash",
+	 compare_hash,
+	 hash );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          bloom_filter,
+	          "TestFile2",
+	          9,
+	          &compare_hash,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "compare_hash",
+	 (int64_t) compare_hash,
+	 (int64_t) hash );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          NULL,
+	          "TestFile",
+	          8,
+	          &hash,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          bloom_filter,
+	          NULL,
+	          8,
+	          &hash,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          bloom_filter,
+	          "TestFile",
+	          8,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdirectory_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_bloom_filter_insert_hash and libcdirectory_bloom_filter_contains_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_bloom_filter_contains_hash(
+     void )
+{
+	char name[ 32 ];
+
+	libcdirectory_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint64_t hash                              = 0;
+	int false_positive_count                   = 0;
+	int name_index                             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_bloom_filter_initialize(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_bloom_filter_resize(
+	          bloom_filter,
+	          1000,
+	          LIBCDIRECTORY_BLOOM_FILTER_DEFAULT_BITS_PER_ENTRY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty Bloom filter
+	 */
+	result = libcdirectory_bloom_filter_get_name_hash(
+	          bloom_filter,
+	          "file0",
+	          5,
+	          &hash,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_bloom_filter_contains_hash(
+	          bloom_filter,
+	          hash );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that every inserted name is contained
+	 */
+	for( name_index = 0;
+	     name_index < 1000;
+	     name_index++ )
+	{
+		narrow_string_snprintf(
+		 name,
+		 32,
+		 "file%d",
+		 name_index );
+
+		result = libcdirectory_bloom_filter_get_name_hash(
+		          bloom_filter,
+		          name,
+		          narrow_string_length(
+		           name ),
+		          &hash,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		libcdirectory_bloom_filter_insert_hash(
+		 bloom_filter,
+		 hash );
+	}
+	for( name_index = 0;
+	     name_index < 1000;
+	     name_index++ )
+	{
+		narrow_string_snprintf(
+		 name,
+		 32,
+		 "FILE%d",
+		 name_index );
+
+		result = libcdirectory_bloom_filter_get_name_hash(
+		          bloom_filter,
+		          name,
+		          narrow_string_length(
+		           name ),
+		          &hash,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdirectory_bloom_filter_contains_hash(
+		          bloom_filter,
+		          hash );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test that the false positive rate of names that were not inserted
+	 * is in the order of 1% for 10 bits per entry
+	 */
+	for( name_index = 0;
+	     name_index < 1000;
+	     name_index++ )
+	{
+		narrow_string_snprintf(
+		 name,
+		 32,
+		 "other%d",
+		 name_index );
+
+		result = libcdirectory_bloom_filter_get_name_hash(
+		          bloom_filter,
+		          name,
+		          narrow_string_length(
+		           name ),
+		          &hash,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		false_positive_count += libcdirectory_bloom_filter_contains_hash(
+		                         bloom_filter,
+		                         hash );
+	}
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "false_positive_count",
+	 false_positive_count,
+	 50 );
+
+	/* Clean up
+	 */
+	result = libcdirectory_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdirectory_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_bloom_filter_initialize",
+	 cdirectory_test_bloom_filter_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_bloom_filter_free",
+	 cdirectory_test_bloom_filter_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_bloom_filter_resize",
+	 cdirectory_test_bloom_filter_resize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_bloom_filter_get_name_hash",
+	 cdirectory_test_bloom_filter_get_name_hash );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_bloom_filter_contains_hash",
+	 cdirectory_test_bloom_filter_contains_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Library case folding functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_case_folding.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_case_folding_get_character function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_case_folding_get_character(
+     void )
+{
+	/* Pairs of a Unicode character and its simple case folding
+	 */
+	libuna_unicode_character_t test_characters[ 30 ] = {
+		0x00000041, 0x00000061,
+		0x0000005a, 0x0000007a,
+		0x00000061, 0x00000061,
+		0x00000030, 0x00000030,
+		0x000000b5, 0x000003bc,
+		0x000000c4, 0x000000e4,
+		0x000000df, 0x000000df,
+		0x00000130, 0x00000130,
+		0x000003a3, 0x000003c3,
+		0x000003c2, 0x000003c3,
+		0x00000410, 0x00000430,
+		0x00001e9e, 0x000000df,
+		0x0000212a, 0x0000006b,
+		0x0000ff21, 0x0000ff41,
+		0x00010400, 0x00010428 };
+
+	libuna_unicode_character_t unicode_character = 0;
+	int test_index                               = 0;
+
+	for( test_index = 0;
+	     test_index < 30;
+	     test_index += 2 )
+	{
+		unicode_character = libcdirectory_case_folding_get_character(
+		                     test_characters[ test_index ] );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT32(
+		 "unicode_character",
+		 (uint32_t) unicode_character,
+		 (uint32_t) test_characters[ test_index + 1 ] );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_case_folding_get_character",
+	 cdirectory_test_case_folding_get_character );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
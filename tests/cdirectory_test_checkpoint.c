@@ -0,0 +1,384 @@
+/*
+ * Library checkpoint functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_checkpoint.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_checkpoint_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_checkpoint_write_data(
+     void )
+{
+	uint8_t data[ LIBCDIRECTORY_CHECKPOINT_DATA_SIZE ];
+
+	uint8_t expected_data[ LIBCDIRECTORY_CHECKPOINT_DATA_SIZE ] = {
+		'c', 'd', 'c', 'p', 0x01, 0x00, 0x00, 0x00,
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+		0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x21, 0x22, 0x23, 0x24, 0x00, 0x00, 0x00, 0x00 };
+
+	libcdirectory_checkpoint_t checkpoint;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	checkpoint.device_number     = 0x0807060504030201UL;
+	checkpoint.inode_number      = 0x1817161514131211UL;
+	checkpoint.modification_time = -1;
+	checkpoint.position          = 0x24232221UL;
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_checkpoint_write_data(
+	          &checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_checkpoint_write_data(
+	          NULL,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_checkpoint_write_data(
+	          &checkpoint,
+	          NULL,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_checkpoint_write_data(
+	          &checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_checkpoint_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_checkpoint_read_data(
+     void )
+{
+	uint8_t data[ LIBCDIRECTORY_CHECKPOINT_DATA_SIZE ];
+
+	libcdirectory_checkpoint_t checkpoint;
+	libcdirectory_checkpoint_t read_checkpoint;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	checkpoint.device_number     = 0x0807060504030201UL;
+	checkpoint.inode_number      = 0x1817161514131211UL;
+	checkpoint.modification_time = -1234567890123456789L;
+	checkpoint.position          = 0x7fffffffffffffffUL;
+
+	result = libcdirectory_checkpoint_write_data(
+	          &checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_checkpoint_read_data(
+	          &read_checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint.device_number",
+	 read_checkpoint.device_number,
+	 checkpoint.device_number );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint.inode_number",
+	 read_checkpoint.inode_number,
+	 checkpoint.inode_number );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT64(
+	 "read_checkpoint.modification_time",
+	 read_checkpoint.modification_time,
+	 checkpoint.modification_time );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint.position",
+	 read_checkpoint.position,
+	 checkpoint.position );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_checkpoint_read_data(
+	          NULL,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_checkpoint_read_data(
+	          &read_checkpoint,
+	          NULL,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_checkpoint_read_data(
+	          &read_checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with an invalid signature
+	 */
+	data[ 0 ] = 'x';
+
+	result = libcdirectory_checkpoint_read_data(
+	          &read_checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	data[ 0 ] = 'c';
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with an unsupported format version
+	 */
+	data[ 4 ] = 0x02;
+
+	result = libcdirectory_checkpoint_read_data(
+	          &read_checkpoint,
+	          data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	data[ 4 ] = 0x01;
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_checkpoint_write_data",
+	 cdirectory_test_checkpoint_write_data );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_checkpoint_read_data",
+	 cdirectory_test_checkpoint_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
@@ -21,12 +21,30 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "cdirectory_test_libcdirectory.h"
 #include "cdirectory_test_libcerror.h"
 #include "cdirectory_test_macros.h"
@@ -641,20 +659,23 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Tests the libcdirectory_directory_close function
+/* Tests the libcdirectory_directory_open_at function
  * Returns 1 if successful or 0 if not
  */
-int cdirectory_test_directory_close(
+int cdirectory_test_directory_open_at(
      void )
 {
-	libcdirectory_directory_t *directory = NULL;
-	libcerror_error_t *error             = NULL;
-	int result                           = 0;
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_t *parent_directory      = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	size_t read_buffer_size                          = 0;
+	int result                                       = 0;
 
 	/* Initialize test
 	 */
 	result = libcdirectory_directory_initialize(
-	          &directory,
+	          &parent_directory,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -663,16 +684,15 @@ int cdirectory_test_directory_close(
 	 1 );
 
 	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
-	 "directory",
-	 directory );
+	 "parent_directory",
+	 parent_directory );
 
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_open(
-	          directory,
-	          ".",
+	result = libcdirectory_directory_initialize(
+	          &directory,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -680,29 +700,37 @@ int cdirectory_test_directory_close(
 	 result,
 	 1 );
 
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test close of directory
-	 */
-	result = libcdirectory_directory_close(
-	          directory,
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
 
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open of directory relative to a parent directory that is not open
 	 */
-	result = libcdirectory_directory_close(
-	          NULL,
+	result = libcdirectory_directory_open_at(
+	          directory,
+	          parent_directory,
+	          ".",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -717,10 +745,9 @@ int cdirectory_test_directory_close(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcdirectory_directory_free(
-	          &directory,
+	result = libcdirectory_directory_open(
+	          parent_directory,
+	          ".",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -728,128 +755,156 @@ int cdirectory_test_directory_close(
 	 result,
 	 1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "directory",
-	 directory );
-
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( directory != NULL )
+	/* Test open of directory relative to a parent directory with the default and buffered read
+	 */
+	for( read_buffer_size = 0;
+	     read_buffer_size <= 65536;
+	     read_buffer_size += 65536 )
 	{
-		libcdirectory_directory_free(
-		 &directory,
-		 NULL );
-	}
-	return( 0 );
-}
+		result = libcdirectory_directory_set_read_buffer_size(
+		          directory,
+		          read_buffer_size,
+		          &error );
 
-/* Tests the libcdirectory_directory_read_entry function
- * Returns 1 if successful or 0 if not
- */
-int cdirectory_test_directory_read_entry(
-     void )
-{
-	libcdirectory_directory_t *directory             = NULL;
-	libcdirectory_directory_entry_t *directory_entry = NULL;
-	libcerror_error_t *error                         = NULL;
-	int result                                       = 0;
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* Initialize test
-	 */
-	result = libcdirectory_directory_initialize(
-	          &directory,
-	          &error );
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		result = libcdirectory_directory_open_at(
+		          directory,
+		          parent_directory,
+		          ".",
+		          &error );
 
-	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
-	 "directory",
-	 directory );
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libcdirectory_directory_open(
-	          directory,
-	          ".",
-	          &error );
+		/* Test open of directory that is already open
+		 */
+		result = libcdirectory_directory_open_at(
+		          directory,
+		          parent_directory,
+		          ".",
+		          &error );
 
-	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	result = libcdirectory_directory_entry_initialize(
-	          &directory_entry,
+		libcerror_error_free(
+		 &error );
+
+		result = libcdirectory_directory_has_entry(
+		          directory,
+		          directory_entry,
+		          "TestFile",
+		          8,
+		          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		          0,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdirectory_directory_close(
+		          directory,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_open_at(
+	          NULL,
+	          parent_directory,
+	          ".",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
-	 "directory_entry",
-	 directory_entry );
-
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test read entry of directory
-	 */
-	result = libcdirectory_directory_read_entry(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_open_at(
 	          directory,
-	          directory_entry,
+	          NULL,
+	          ".",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libcdirectory_directory_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_open_at(
+	          directory,
 	          directory,
+	          ".",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdirectory_directory_read_entry(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_open_at(
+	          directory,
+	          parent_directory,
 	          NULL,
-	          directory_entry,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -864,9 +919,10 @@ int cdirectory_test_directory_read_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_read_entry(
+	result = libcdirectory_directory_open_at(
 	          directory,
-	          NULL,
+	          parent_directory,
+	          "",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -881,9 +937,12 @@ int cdirectory_test_directory_read_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_read_entry(
+	/* Test open of a file
+	 */
+	result = libcdirectory_directory_open_at(
 	          directory,
-	          directory_entry,
+	          parent_directory,
+	          "TestFile",
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -900,6 +959,19 @@ int cdirectory_test_directory_read_entry(
 
 	/* Clean up
 	 */
+	result = libcdirectory_directory_close(
+	          parent_directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libcdirectory_directory_entry_free(
 	          &directory_entry,
 	          &error );
@@ -934,6 +1006,23 @@ int cdirectory_test_directory_read_entry(
 	 "error",
 	 error );
 
+	result = libcdirectory_directory_free(
+	          &parent_directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parent_directory",
+	 parent_directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -954,24 +1043,32 @@ on_error:
 		 &directory,
 		 NULL );
 	}
+	if( parent_directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &parent_directory,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libcdirectory_directory_has_entry function
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcdirectory_directory_open_at_wide function
  * Returns 1 if successful or 0 if not
  */
-int cdirectory_test_directory_has_entry(
+int cdirectory_test_directory_open_at_wide(
      void )
 {
-	libcdirectory_directory_t *directory             = NULL;
-	libcdirectory_directory_entry_t *directory_entry = NULL;
-	libcerror_error_t *error                         = NULL;
-	int result                                       = 0;
+	libcdirectory_directory_t *directory        = NULL;
+	libcdirectory_directory_t *parent_directory = NULL;
+	libcerror_error_t *error                    = NULL;
+	int result                                  = 0;
 
 	/* Initialize test
 	 */
 	result = libcdirectory_directory_initialize(
-	          &directory,
+	          &parent_directory,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -980,15 +1077,15 @@ int cdirectory_test_directory_has_entry(
 	 1 );
 
 	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
-	 "directory",
-	 directory );
+	 "parent_directory",
+	 parent_directory );
 
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_entry_initialize(
-	          &directory_entry,
+	result = libcdirectory_directory_initialize(
+	          &directory,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -997,39 +1094,4521 @@ int cdirectory_test_directory_has_entry(
 	 1 );
 
 	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
-	 "directory_entry",
-	 directory_entry );
+	 "directory",
+	 directory );
 
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI )
+	result = libcdirectory_directory_open_wide(
+	          parent_directory,
+	          L".",
+	          &error );
 
-	/* Test has entry match
-	 */
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open of directory relative to a parent directory
+	 */
+	result = libcdirectory_directory_open_at_wide(
+	          directory,
+	          parent_directory,
+	          L".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_open_at_wide(
+	          NULL,
+	          parent_directory,
+	          L".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_open_at_wide(
+	          directory,
+	          NULL,
+	          L".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_open_at_wide(
+	          directory,
+	          parent_directory,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          parent_directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &parent_directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parent_directory",
+	 parent_directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( parent_directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &parent_directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libcdirectory_directory_close function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_close(
+     void )
+{
+	libcdirectory_directory_t *directory = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test close of directory
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_close(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_set_read_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_set_read_buffer_size(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	char *entry_name                                 = NULL;
+	int found_test_file                              = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set read buffer size
+	 */
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read entries using the read buffer
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			result = libcdirectory_directory_entry_get_name(
+			          directory_entry,
+			          &entry_name,
+			          &error );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "entry_name",
+			 entry_name );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( entry_name[ 0 ] == 'T' )
+			 && ( memory_compare(
+			       entry_name,
+			       "TestFile",
+			       9 ) == 0 ) )
+			{
+				found_test_file = 1;
+			}
+		}
+	}
+	while( result == 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "found_test_file",
+	 found_test_file,
+	 1 );
+
+	/* Test set read buffer size when the directory is open
+	 */
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_set_read_buffer_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_set_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_set_flags(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) || defined( WINAPI )
+	uint8_t compare_flags                            = LIBCDIRECTORY_COMPARE_FLAG_NO_CASE;
+#else
+	uint8_t compare_flags                            = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set flags
+	 */
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test has entry with the unknown type resolved on demand
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          compare_flags,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_set_flags(
+	          NULL,
+	          LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          0xff,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_set_bloom_filter_bits_per_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_set_bloom_filter_bits_per_entry(
+     void )
+{
+	libcdirectory_directory_t *directory = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_directory_set_bloom_filter_bits_per_entry(
+	          directory,
+	          16,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_set_bloom_filter_bits_per_entry(
+	          NULL,
+	          16,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_bloom_filter_bits_per_entry(
+	          directory,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_bloom_filter_bits_per_entry(
+	          directory,
+	          65,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_set_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_set_filter(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	char *entry_name                                 = NULL;
+	uint8_t entry_type                               = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+
+#if defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) || defined( WINAPI )
+	uint8_t compare_flags                            = LIBCDIRECTORY_COMPARE_FLAG_NO_CASE;
+#else
+	uint8_t compare_flags                            = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          LIBCDIRECTORY_DIRECTORY_FLAG_RESOLVE_UNKNOWN_TYPE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set filter with a pattern and entry type
+	 */
+	result = libcdirectory_directory_set_filter(
+	          directory,
+	          "TestF?l[a-z]",
+	          12,
+	          LIBCDIRECTORY_ENTRY_TYPE_FLAG_FILE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_entries = 0;
+
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			result = libcdirectory_directory_entry_get_name(
+			          directory_entry,
+			          &entry_name,
+			          &error );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = narrow_string_compare(
+			          entry_name,
+			          "TestFile",
+			          9 );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			number_of_entries++;
+
+			result = 1;
+		}
+	}
+	while( result == 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set filter with only an entry type
+	 */
+	result = libcdirectory_directory_set_filter(
+	          directory,
+	          NULL,
+	          0,
+	          LIBCDIRECTORY_ENTRY_TYPE_FLAG_DIRECTORY,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_entries = 0;
+
+	do
+	{
+		result = libcdirectory_directory_read_entry_view(
+		          directory,
+		          directory_entry,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			result = libcdirectory_directory_entry_get_type(
+			          directory_entry,
+			          &entry_type,
+			          &error );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+			 "entry_type",
+			 entry_type,
+			 LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY );
+
+			number_of_entries++;
+		}
+	}
+	while( result == 1 );
+
+	/* The directory contains at least the . and .. entries
+	 */
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test has entry ignores the filter
+	 */
+	result = libcdirectory_directory_set_filter(
+	          directory,
+	          "*.none",
+	          6,
+	          LIBCDIRECTORY_ENTRY_TYPE_FLAG_ALL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          compare_flags,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_set_filter(
+	          NULL,
+	          "*",
+	          1,
+	          LIBCDIRECTORY_ENTRY_TYPE_FLAG_ALL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_filter(
+	          directory,
+	          "*",
+	          1,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_filter(
+	          directory,
+	          "0123456789012345678901234567890123456789012345678901234567890123",
+	          64,
+	          LIBCDIRECTORY_ENTRY_TYPE_FLAG_ALL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_read_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_read_entry(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read entry of directory
+	 */
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_read_entry(
+	          NULL,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_read_entry_view function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_read_entry_view(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	char *entry_name                                 = NULL;
+	size_t read_buffer_size                          = 0;
+	int found_test_file                              = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read entry view with the default and buffered read
+	 */
+	for( read_buffer_size = 0;
+	     read_buffer_size <= 65536;
+	     read_buffer_size += 65536 )
+	{
+		result = libcdirectory_directory_set_read_buffer_size(
+		          directory,
+		          read_buffer_size,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdirectory_directory_open(
+		          directory,
+		          ".",
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		found_test_file = 0;
+
+		do
+		{
+			result = libcdirectory_directory_read_entry_view(
+			          directory,
+			          directory_entry,
+			          &error );
+
+			CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( result == 1 )
+			{
+				result = libcdirectory_directory_entry_get_name(
+				          directory_entry,
+				          &entry_name,
+				          &error );
+
+				CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+				 "entry_name",
+				 entry_name );
+
+				CDIRECTORY_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				if( ( entry_name[ 0 ] == 'T' )
+				 && ( memory_compare(
+				       entry_name,
+				       "TestFile",
+				       9 ) == 0 ) )
+				{
+					found_test_file = 1;
+				}
+			}
+		}
+		while( result == 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "found_test_file",
+		 found_test_file,
+		 1 );
+
+		result = libcdirectory_directory_close(
+		          directory,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_read_entry_view(
+	          NULL,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entry_view(
+	          directory,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entry_view(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_read_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_read_entries(
+     void )
+{
+	libcdirectory_directory_entry_t *directory_entries[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcdirectory_directory_t *directory                    = NULL;
+	libcerror_error_t *error                                = NULL;
+	uint64_t size                                           = 0;
+	int entry_index                                         = 0;
+	int number_of_entries                                   = 0;
+	int number_of_inode_order_entries                       = 0;
+	int number_of_read_entries                              = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libcdirectory_directory_entry_initialize(
+		          &( directory_entries[ entry_index ] ),
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "directory_entry",
+		 directory_entries[ entry_index ] );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read entries of directory
+	 */
+	do
+	{
+		result = libcdirectory_directory_read_entries(
+		          directory,
+		          directory_entries,
+		          4,
+		          &number_of_read_entries,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+			 "number_of_read_entries",
+			 number_of_read_entries,
+			 0 );
+
+			number_of_entries += number_of_read_entries;
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "number_of_read_entries",
+			 number_of_read_entries,
+			 0 );
+		}
+	}
+	while( result == 1 );
+
+	/* The directory contains at least ".", ".." and "TestFile"
+	 */
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	/* Test read entries of directory with the file statistics read in inode order
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          LIBCDIRECTORY_DIRECTORY_FLAG_INODE_ORDER_FILE_STATISTICS,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_inode_order_entries = 0;
+
+	do
+	{
+		result = libcdirectory_directory_read_entries(
+		          directory,
+		          directory_entries,
+		          4,
+		          &number_of_read_entries,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( entry_index = 0;
+		     entry_index < number_of_read_entries;
+		     entry_index++ )
+		{
+			result = libcdirectory_directory_entry_get_size(
+			          directory_entries[ entry_index ],
+			          &size,
+			          &error );
+
+			CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		number_of_inode_order_entries += number_of_read_entries;
+	}
+	while( number_of_read_entries > 0 );
+
+	/* The same entries should be read as without the flag
+	 */
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inode_order_entries",
+	 number_of_inode_order_entries,
+	 number_of_entries );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_read_entries(
+	          NULL,
+	          directory_entries,
+	          4,
+	          &number_of_read_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entries(
+	          directory,
+	          NULL,
+	          4,
+	          &number_of_read_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entries(
+	          directory,
+	          directory_entries,
+	          0,
+	          &number_of_read_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_read_entries(
+	          directory,
+	          directory_entries,
+	          4,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_read_entries(
+	          directory,
+	          directory_entries,
+	          4,
+	          &number_of_read_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libcdirectory_directory_entry_free(
+		          &( directory_entries[ entry_index ] ),
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "directory_entry",
+		 directory_entries[ entry_index ] );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		if( directory_entries[ entry_index ] != NULL )
+		{
+			libcdirectory_directory_entry_free(
+			 &( directory_entries[ entry_index ] ),
+			 NULL );
+		}
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_rewind function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_rewind(
+     size_t read_buffer_size )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	int number_of_entries                            = 0;
+	int number_of_rewound_entries                    = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          read_buffer_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test rewind after all entries were read
+	 */
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_entries += result;
+	}
+	while( result != 0 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	result = libcdirectory_directory_rewind(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_rewound_entries += result;
+	}
+	while( result != 0 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rewound_entries",
+	 number_of_rewound_entries,
+	 number_of_entries );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_rewind(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test rewind of a directory that is not open
+	 */
+	result = libcdirectory_directory_rewind(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_get_position and libcdirectory_directory_set_position functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_set_position(
+     size_t read_buffer_size )
+{
+	char entry_name[ 256 ];
+
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	char *name                                       = NULL;
+	uint64_t position                                = 0;
+	size_t name_length                               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_read_buffer_size(
+	          directory,
+	          read_buffer_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get position after the first entry and set position after reading the second entry
+	 */
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_get_position(
+	          directory,
+	          &position,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_get_name(
+	          directory_entry,
+	          &name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	name_length = narrow_string_length(
+	               name );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "name_length",
+	 (int) name_length,
+	 256 );
+
+	result = narrow_string_copy(
+	          entry_name,
+	          name,
+	          name_length + 1 ) != NULL;
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_position(
+	          directory,
+	          position,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_get_name(
+	          directory_entry,
+	          &name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          name,
+	          entry_name,
+	          name_length + 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_get_position(
+	          NULL,
+	          &position,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_get_position(
+	          directory,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_set_position(
+	          NULL,
+	          position,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get position of a directory that is not open
+	 */
+	result = libcdirectory_directory_get_position(
+	          directory,
+	          &position,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __linux__ ) && defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR )
+
+/* Tests the libcdirectory_directory_get_checkpoint and libcdirectory_directory_restore_checkpoint functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_checkpoint(
+     void )
+{
+	uint8_t checkpoint_data[ LIBCDIRECTORY_CHECKPOINT_DATA_SIZE ];
+	char entry_name[ 256 ];
+
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	char *name                                       = NULL;
+	size_t name_length                               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get checkpoint after the first entry
+	 */
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_get_checkpoint(
+	          directory,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_get_name(
+	          directory_entry,
+	          &name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	name_length = narrow_string_length(
+	               name );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "name_length",
+	 (int) name_length,
+	 256 );
+
+	result = narrow_string_copy(
+	          entry_name,
+	          name,
+	          name_length + 1 ) != NULL;
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test restore checkpoint after the directory was reopened
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_restore_checkpoint(
+	          directory,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          LIBCDIRECTORY_CHECKPOINT_FLAG_REQUIRE_UNCHANGED,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_read_entry(
+	          directory,
+	          directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_get_name(
+	          directory_entry,
+	          &name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          name,
+	          entry_name,
+	          name_length + 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_get_checkpoint(
+	          NULL,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_get_checkpoint(
+	          directory,
+	          NULL,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_get_checkpoint(
+	          directory,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_restore_checkpoint(
+	          NULL,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_restore_checkpoint(
+	          directory,
+	          NULL,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_restore_checkpoint(
+	          directory,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          0xff,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test restore checkpoint of another directory
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_restore_checkpoint(
+	          directory,
+	          checkpoint_data,
+	          LIBCDIRECTORY_CHECKPOINT_DATA_SIZE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __linux__ ) && defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR ) */
+
+/* Tests the libcdirectory_directory_has_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_has_entry(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI )
+
+	/* Test has entry match
+	 */
 /* TODO: remove the need for the explicit open/close */
 	result = libcdirectory_directory_open(
 	          directory,
 	          ".",
 	          &error );
 
-	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test has entry non-match
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TESTFILE",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test has entry non-match of type and of name with a path segment separator
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "./TestFile",
+	          10,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI ) */
+
+#if !defined( WINAPI ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT )
+
+	/* Test has entry with name index, which allows for repeated look ups
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          LIBCDIRECTORY_DIRECTORY_FLAG_INDEX_NAMES,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TESTFILE",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "bogus",
+	          5,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test has entry with Bloom filter, which rules out missing entries
+	 */
+	result = libcdirectory_directory_set_bloom_filter_bits_per_entry(
+	          directory,
+	          4,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          LIBCDIRECTORY_DIRECTORY_FLAG_BLOOM_FILTER,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "bogus",
+	          5,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The Bloom filter is not used while the directory modification time is within
+	 * the racy interval, in which case the look up reads the remaining entries
+	 */
+	result = libcdirectory_directory_rewind(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TESTFILE",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT ) */
+
+	/* Test has entry with caseless compare
+	 */
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TESTFILE",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_has_entry(
+	          NULL,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          NULL,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          NULL,
+	          11,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          (size_t) SSIZE_MAX + 1,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          123,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          80,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && defined( _DIRENT_HAVE_D_TYPE )
+
+/* Tests the libcdirectory_directory_has_entry function on a directory without search permission
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_has_entry_without_search_permission(
+     void )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	FILE *file_stream                                = NULL;
+	int result                                       = 0;
+
+	/* The permissions are not enforced for the super user
+	 */
+	if( geteuid() == 0 )
+	{
+		return( 1 );
+	}
+	/* Initialize test
+	 */
+	result = mkdir(
+	          "TestNoSearchDirectory",
+	          0755 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = file_stream_open(
+	               "TestNoSearchDirectory/TestFile",
+	               "w" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = chmod(
+	          "TestNoSearchDirectory",
+	          0644 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          "TestNoSearchDirectory",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that the entry is found by reading the directory when it cannot be looked up directly
+	 */
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	chmod(
+	 "TestNoSearchDirectory",
+	 0755 );
+	unlink(
+	 "TestNoSearchDirectory/TestFile" );
+	rmdir(
+	 "TestNoSearchDirectory" );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	chmod(
+	 "TestNoSearchDirectory",
+	 0755 );
+	unlink(
+	 "TestNoSearchDirectory/TestFile" );
+	rmdir(
+	 "TestNoSearchDirectory" );
+
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && defined( _DIRENT_HAVE_D_TYPE ) */
+
+#if !defined( WINAPI ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT ) && defined( HAVE_UNISTD_H )
+
+/* Tests the libcdirectory_directory_has_entry function with an entry that is created
+ * after the name index or Bloom filter, corresponding to the directory flags, was built
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_has_entry_racy(
+     uint8_t directory_flags )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcerror_error_t *error                         = NULL;
+	FILE *file_stream                                = NULL;
+	int result                                       = 0;
+
+#if defined( UTIME_OMIT ) && defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	struct timespec file_times[ 2 ];
+	struct stat file_statistics;
+#endif
+
+	/* Initialize test
+	 */
+	file_stream = file_stream_open(
+	               "TestRacyFile1",
+	               "w" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_directory_initialize(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_open(
+	          directory,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_set_flags(
+	          directory,
+	          directory_flags,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The name index or Bloom filter is built by the first look up
+	 */
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "testracyfile1",
+	          13,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an entry created right after the name index or Bloom filter was built
+	 * is found, when the directory modification time does not change due to its granularity
+	 */
+#if defined( UTIME_OMIT ) && defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	result = stat(
+	          ".",
+	          &file_statistics );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+	file_stream = file_stream_open(
+	               "TestRacyFile2",
+	               "w" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#if defined( UTIME_OMIT ) && defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	file_times[ 0 ].tv_sec  = 0;
+	file_times[ 0 ].tv_nsec = UTIME_OMIT;
+	file_times[ 1 ]         = file_statistics.st_mtim;
+
+	result = utimensat(
+	          AT_FDCWD,
+	          ".",
+	          file_times,
+	          0 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+	/* The directory is rewound since the entries of the directory are read
+	 * from the current position when the Bloom filter does not rule out the name
+	 */
+	result = libcdirectory_directory_rewind(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "testracyfile2",
+	          13,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_rewind(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_has_entry(
+	          directory,
+	          directory_entry,
+	          "TestRacyFile2",
+	          13,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_close(
+	          directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_directory_free(
+	          &directory,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	unlink(
+	 "TestRacyFile1" );
+	unlink(
+	 "TestRacyFile2" );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	unlink(
+	 "TestRacyFile1" );
+	unlink(
+	 "TestRacyFile2" );
+
+	return( 0 );
+}
+
+/* Tests the libcdirectory_directory_has_entry function with an entry that is created after the name index was built
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_has_entry_name_index_racy(
+     void )
+{
+	return( cdirectory_test_directory_has_entry_racy(
+	         LIBCDIRECTORY_DIRECTORY_FLAG_INDEX_NAMES ) );
+}
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+/* Tests the libcdirectory_directory_has_entry function with an entry that is created after the Bloom filter was built
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_has_entry_bloom_filter_racy(
+     void )
+{
+	return( cdirectory_test_directory_has_entry_racy(
+	         LIBCDIRECTORY_DIRECTORY_FLAG_BLOOM_FILTER ) );
+}
 
-	result = libcdirectory_directory_has_entry(
-	          directory,
-	          directory_entry,
-	          "TestFile",
-	          8,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          0,
+#endif /* !defined( WINAPI ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT ) && defined( HAVE_UNISTD_H ) */
+
+/* Tests the libcdirectory_directory_has_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_directory_has_entries(
+     void )
+{
+	const char *entry_names[ 5 ] = {
+		"TestFile",
+		"TESTFILE",
+		"TESTFILE",
+		"TestFile",
+		"bogus" };
+
+	size_t entry_name_lengths[ 5 ] = {
+		8, 8, 8, 8, 5 };
+
+	uint8_t entry_types[ 5 ] = {
+		LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+		LIBCDIRECTORY_ENTRY_TYPE_FILE };
+
+	uint8_t compare_flags[ 5 ] = {
+		0,
+		LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+		0,
+		0,
+		LIBCDIRECTORY_COMPARE_FLAG_NO_CASE };
+
+	uint8_t entries_found[ 5 ];
+
+	libcdirectory_directory_entry_t *directory_entries[ 5 ] = {
+		NULL, NULL, NULL, NULL, NULL };
+
+	libcdirectory_directory_t *directory = NULL;
+	libcerror_error_t *error             = NULL;
+	char *entry_name                     = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+#if !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI )
+	int test_iterator                    = 0;
+	int test_number_of_iterations        = 1;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcdirectory_directory_initialize(
+	          &directory,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -1037,25 +5616,35 @@ int cdirectory_test_directory_has_entry(
 	 result,
 	 1 );
 
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_close(
-	          directory,
-	          &error );
+	for( entry_index = 0;
+	     entry_index < 2;
+	     entry_index++ )
+	{
+		result = libcdirectory_directory_entry_initialize(
+		          &( directory_entries[ entry_index ] ),
+		          &error );
 
-	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "directory_entries[ entry_index ]",
+		 directory_entries[ entry_index ] );
 
-	/* Test has entry non-match
-	 */
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	result = libcdirectory_directory_open(
 	          directory,
 	          ".",
@@ -1070,44 +5659,105 @@ int cdirectory_test_directory_has_entry(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_has_entry(
-	          directory,
-	          directory_entry,
-	          "TESTFILE",
-	          8,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          0,
+#if !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI )
+
+	/* Test regular cases
+	 * When the directory can be opened relative to itself the read position
+	 * is retained and the look up can be repeated
+	 */
+#if defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT )
+	test_number_of_iterations = 2;
+#endif
+	for( test_iterator = 0;
+	     test_iterator < test_number_of_iterations;
+	     test_iterator++ )
+	{
+		result = libcdirectory_directory_has_entries(
+		          directory,
+		          entry_names,
+		          entry_name_lengths,
+		          entry_types,
+		          compare_flags,
+		          5,
+		          directory_entries,
+		          entries_found,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "entries_found[ 0 ]",
+		 entries_found[ 0 ],
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "entries_found[ 1 ]",
+		 entries_found[ 1 ],
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "entries_found[ 2 ]",
+		 entries_found[ 2 ],
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "entries_found[ 3 ]",
+		 entries_found[ 3 ],
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "entries_found[ 4 ]",
+		 entries_found[ 4 ],
+		 0 );
+	}
+	/* Test if the directory entry of a caseless match is copied
+	 */
+	result = libcdirectory_directory_entry_get_name(
+	          directory_entries[ 1 ],
+	          &entry_name,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "entry_name",
+	 entry_name );
 
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_close(
-	          directory,
-	          &error );
+	result = narrow_string_compare(
+	          entry_name,
+	          "TestFile",
+	          9 );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-#endif /* !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI ) */
-
-	/* Test has entry with caseless compare
+	/* Test without compare flags and directory entries
 	 */
-	result = libcdirectory_directory_open(
+	result = libcdirectory_directory_has_entries(
 	          directory,
-	          ".",
+	          entry_names,
+	          entry_name_lengths,
+	          entry_types,
+	          NULL,
+	          2,
+	          NULL,
+	          entries_found,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -1119,46 +5769,70 @@ int cdirectory_test_directory_has_entry(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_has_entry(
-	          directory,
-	          directory_entry,
-	          "TESTFILE",
-	          8,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+	 "entries_found[ 1 ]",
+	 entries_found[ 1 ],
+	 0 );
+
+#endif /* !defined( HAVE_CASE_INSENSITIVE_FILE_SYSTEM ) && !defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcdirectory_directory_has_entries(
+	          NULL,
+	          entry_names,
+	          entry_name_lengths,
+	          entry_types,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcdirectory_directory_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entries(
 	          directory,
+	          NULL,
+	          entry_name_lengths,
+	          entry_types,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdirectory_directory_has_entry(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_directory_has_entries(
+	          directory,
+	          entry_names,
 	          NULL,
-	          directory_entry,
-	          "TestFile",
-	          8,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          0,
+	          entry_types,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -1173,13 +5847,15 @@ int cdirectory_test_directory_has_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_has_entry(
+	result = libcdirectory_directory_has_entries(
 	          directory,
+	          entry_names,
+	          entry_name_lengths,
 	          NULL,
-	          "TestFile",
-	          8,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          0,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -1194,13 +5870,15 @@ int cdirectory_test_directory_has_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_has_entry(
+	result = libcdirectory_directory_has_entries(
 	          directory,
-	          directory_entry,
-	          NULL,
-	          11,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          0,
+	          entry_names,
+	          entry_name_lengths,
+	          entry_types,
+	          compare_flags,
+	          -1,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -1215,13 +5893,15 @@ int cdirectory_test_directory_has_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_has_entry(
+	result = libcdirectory_directory_has_entries(
 	          directory,
-	          directory_entry,
-	          "TestFile",
-	          (size_t) SSIZE_MAX + 1,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          0,
+	          entry_names,
+	          entry_name_lengths,
+	          entry_types,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          NULL,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
@@ -1236,15 +5916,21 @@ int cdirectory_test_directory_has_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_has_entry(
+	entry_types[ 4 ] = 0xff;
+
+	result = libcdirectory_directory_has_entries(
 	          directory,
-	          directory_entry,
-	          "TestFile",
-	          8,
-	          123,
-	          0,
+	          entry_names,
+	          entry_name_lengths,
+	          entry_types,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
+	entry_types[ 4 ] = LIBCDIRECTORY_ENTRY_TYPE_FILE;
+
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1257,15 +5943,21 @@ int cdirectory_test_directory_has_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdirectory_directory_has_entry(
+	compare_flags[ 4 ] = 0xff;
+
+	result = libcdirectory_directory_has_entries(
 	          directory,
-	          directory_entry,
-	          "TestFile",
-	          8,
-	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-	          80,
+	          entry_names,
+	          entry_name_lengths,
+	          entry_types,
+	          compare_flags,
+	          5,
+	          directory_entries,
+	          entries_found,
 	          &error );
 
+	compare_flags[ 4 ] = LIBCDIRECTORY_COMPARE_FLAG_NO_CASE;
+
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1280,23 +5972,36 @@ int cdirectory_test_directory_has_entry(
 
 	/* Clean up
 	 */
-	result = libcdirectory_directory_entry_free(
-	          &directory_entry,
+	result = libcdirectory_directory_close(
+	          directory,
 	          &error );
 
 	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CDIRECTORY_TEST_ASSERT_IS_NULL(
-	 "directory_entry",
-	 directory_entry );
+	 0 );
 
 	CDIRECTORY_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	for( entry_index = 0;
+	     entry_index < 2;
+	     entry_index++ )
+	{
+		result = libcdirectory_directory_entry_free(
+		          &( directory_entries[ entry_index ] ),
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	result = libcdirectory_directory_free(
 	          &directory,
 	          &error );
@@ -1322,11 +6027,16 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( directory_entry != NULL )
+	for( entry_index = 0;
+	     entry_index < 2;
+	     entry_index++ )
 	{
-		libcdirectory_directory_entry_free(
-		 &directory_entry,
-		 NULL );
+		if( directory_entries[ entry_index ] != NULL )
+		{
+			libcdirectory_directory_entry_free(
+			 &( directory_entries[ entry_index ] ),
+			 NULL );
+		}
 	}
 	if( directory != NULL )
 	{
@@ -1774,20 +6484,116 @@ int main(
 	 "libcdirectory_directory_open_wide",
 	 cdirectory_test_directory_open_wide );
 
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_open_at",
+	 cdirectory_test_directory_open_at );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_open_at_wide",
+	 cdirectory_test_directory_open_at_wide );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 	CDIRECTORY_TEST_RUN(
 	 "libcdirectory_directory_close",
 	 cdirectory_test_directory_close );
 
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_set_read_buffer_size",
+	 cdirectory_test_directory_set_read_buffer_size );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_set_flags",
+	 cdirectory_test_directory_set_flags );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_set_bloom_filter_bits_per_entry",
+	 cdirectory_test_directory_set_bloom_filter_bits_per_entry );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_set_filter",
+	 cdirectory_test_directory_set_filter );
+
 	CDIRECTORY_TEST_RUN(
 	 "libcdirectory_directory_read_entry",
 	 cdirectory_test_directory_read_entry );
 
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_read_entry_view",
+	 cdirectory_test_directory_read_entry_view );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_read_entries",
+	 cdirectory_test_directory_read_entries );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	CDIRECTORY_TEST_RUN_WITH_ARGS(
+	 "libcdirectory_directory_rewind",
+	 cdirectory_test_directory_rewind,
+	 0 );
+
+	CDIRECTORY_TEST_RUN_WITH_ARGS(
+	 "libcdirectory_directory_rewind",
+	 cdirectory_test_directory_rewind,
+	 65536 );
+
+#if defined( WINAPI ) || ( defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR ) )
+
+	CDIRECTORY_TEST_RUN_WITH_ARGS(
+	 "libcdirectory_directory_set_position",
+	 cdirectory_test_directory_set_position,
+	 0 );
+
+#endif /* defined( WINAPI ) || ( defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR ) ) */
+
+	CDIRECTORY_TEST_RUN_WITH_ARGS(
+	 "libcdirectory_directory_set_position",
+	 cdirectory_test_directory_set_position,
+	 65536 );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#if defined( __linux__ ) && defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_get_checkpoint",
+	 cdirectory_test_directory_checkpoint );
+
+#endif /* defined( __linux__ ) && defined( HAVE_SEEKDIR ) && defined( HAVE_TELLDIR ) */
+
 	CDIRECTORY_TEST_RUN(
 	 "libcdirectory_directory_has_entry",
 	 cdirectory_test_directory_has_entry );
 
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && defined( _DIRENT_HAVE_D_TYPE )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_has_entry_without_search_permission",
+	 cdirectory_test_directory_has_entry_without_search_permission );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && defined( _DIRENT_HAVE_D_TYPE ) */
+
+#if !defined( WINAPI ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT ) && defined( HAVE_UNISTD_H )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_has_entry_name_index_racy",
+	 cdirectory_test_directory_has_entry_name_index_racy );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_has_entry_bloom_filter_racy",
+	 cdirectory_test_directory_has_entry_bloom_filter_racy );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_FDOPENDIR ) && defined( HAVE_OPENAT ) && defined( HAVE_UNISTD_H ) */
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_directory_has_entries",
+	 cdirectory_test_directory_has_entries );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 	CDIRECTORY_TEST_RUN(
@@ -0,0 +1,1077 @@
+/*
+ * Library disk_usage type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_disk_usage.h"
+
+/* Tests the libcdirectory_disk_usage_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_disk_usage_initialize(
+     void )
+{
+	libcdirectory_disk_usage_t *disk_usage = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_disk_usage_initialize(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "disk_usage",
+	 disk_usage );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_disk_usage_free(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "disk_usage",
+	 disk_usage );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_disk_usage_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	disk_usage = (libcdirectory_disk_usage_t *) 0x12345678UL;
+
+	result = libcdirectory_disk_usage_initialize(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	disk_usage = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_disk_usage_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_disk_usage_initialize(
+		          &disk_usage,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( disk_usage != NULL )
+			{
+				libcdirectory_disk_usage_free(
+				 &disk_usage,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "disk_usage",
+			 disk_usage );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_disk_usage_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_disk_usage_initialize(
+		          &disk_usage,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( disk_usage != NULL )
+			{
+				libcdirectory_disk_usage_free(
+				 &disk_usage,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "disk_usage",
+			 disk_usage );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( disk_usage != NULL )
+	{
+		libcdirectory_disk_usage_free(
+		 &disk_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_disk_usage_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_disk_usage_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_disk_usage_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_disk_usage_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_disk_usage_calculate(
+     void )
+{
+	libcdirectory_disk_usage_t *disk_usage           = NULL;
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint64_t multi_threaded_allocated_size           = 0;
+	uint64_t multi_threaded_apparent_size            = 0;
+	uint64_t multi_threaded_number_of_directories    = 0;
+	uint64_t multi_threaded_number_of_files          = 0;
+	uint64_t single_threaded_allocated_size          = 0;
+	uint64_t single_threaded_apparent_size           = 0;
+	uint64_t single_threaded_number_of_directories   = 0;
+	uint64_t single_threaded_number_of_files         = 0;
+	int multi_threaded_number_of_records             = 0;
+	int result                                       = 0;
+	int single_threaded_number_of_records            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_disk_usage_initialize(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_parallel_walker_set_flags(
+	          parallel_walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_set_number_of_threads(
+	          parallel_walker,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_disk_usage_calculate(
+	          disk_usage,
+	          parallel_walker,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_disk_usage_get_number_of_directories(
+	          disk_usage,
+	          &single_threaded_number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "single_threaded_number_of_records",
+	 single_threaded_number_of_records,
+	 1 );
+
+	result = libcdirectory_disk_usage_get_directory_values(
+	          disk_usage,
+	          0,
+	          &single_threaded_apparent_size,
+	          &single_threaded_allocated_size,
+	          &single_threaded_number_of_files,
+	          &single_threaded_number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The walked directory contains the tests directory and all other directories
+	 */
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "single_threaded_number_of_directories",
+	 single_threaded_number_of_directories,
+	 (uint64_t) single_threaded_number_of_records - 1 );
+
+	CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "single_threaded_number_of_files",
+	 (int64_t) single_threaded_number_of_files,
+	 (int64_t) 0 );
+
+	/* Test calculate with multiple threads, which should result in the same values
+	 */
+	result = libcdirectory_parallel_walker_set_number_of_threads(
+	          parallel_walker,
+	          4,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_disk_usage_calculate(
+	          disk_usage,
+	          parallel_walker,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_disk_usage_get_number_of_directories(
+	          disk_usage,
+	          &multi_threaded_number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "multi_threaded_number_of_records",
+	 multi_threaded_number_of_records,
+	 single_threaded_number_of_records );
+
+	result = libcdirectory_disk_usage_get_directory_values(
+	          disk_usage,
+	          0,
+	          &multi_threaded_apparent_size,
+	          &multi_threaded_allocated_size,
+	          &multi_threaded_number_of_files,
+	          &multi_threaded_number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "multi_threaded_number_of_files",
+	 multi_threaded_number_of_files,
+	 single_threaded_number_of_files );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "multi_threaded_number_of_directories",
+	 multi_threaded_number_of_directories,
+	 single_threaded_number_of_directories );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_disk_usage_calculate(
+	          NULL,
+	          parallel_walker,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_calculate(
+	          disk_usage,
+	          NULL,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_calculate(
+	          disk_usage,
+	          parallel_walker,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test calculate of a file
+	 */
+	result = libcdirectory_disk_usage_calculate(
+	          disk_usage,
+	          parallel_walker,
+	          "TestFile",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_get_number_of_directories(
+	          disk_usage,
+	          &multi_threaded_number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "multi_threaded_number_of_records",
+	 multi_threaded_number_of_records,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_disk_usage_free(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "disk_usage",
+	 disk_usage );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	if( disk_usage != NULL )
+	{
+		libcdirectory_disk_usage_free(
+		 &disk_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_disk_usage_get_directory_path and libcdirectory_disk_usage_get_directory_values functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_disk_usage_get_directory_values(
+     void )
+{
+	libcdirectory_disk_usage_t *disk_usage           = NULL;
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	const char *path                                 = NULL;
+	size_t path_length                               = 0;
+	uint64_t allocated_size                          = 0;
+	uint64_t apparent_size                           = 0;
+	uint64_t number_of_directories                   = 0;
+	uint64_t number_of_files                         = 0;
+	uint64_t sub_directory_allocated_size            = 0;
+	uint64_t sub_directory_apparent_size             = 0;
+	uint64_t sub_directory_number_of_directories     = 0;
+	uint64_t sub_directory_number_of_files           = 0;
+	int directory_index                              = 0;
+	int number_of_records                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_disk_usage_initialize(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_parallel_walker_set_flags(
+	          parallel_walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_disk_usage_calculate(
+	          disk_usage,
+	          parallel_walker,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_disk_usage_get_number_of_directories(
+	          disk_usage,
+	          &number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_disk_usage_get_directory_path(
+	          disk_usage,
+	          0,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 (size_t) 0 );
+
+	result = libcdirectory_disk_usage_get_directory_values(
+	          disk_usage,
+	          0,
+	          &apparent_size,
+	          &allocated_size,
+	          &number_of_files,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values of every sub directory are contained in the values of the walked directory
+	 */
+	for( directory_index = 1;
+	     directory_index < number_of_records;
+	     directory_index++ )
+	{
+		result = libcdirectory_disk_usage_get_directory_path(
+		          disk_usage,
+		          directory_index,
+		          &path,
+		          &path_length,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+		 "path_length",
+		 path_length,
+		 narrow_string_length( path ) );
+
+		result = libcdirectory_disk_usage_get_directory_values(
+		          disk_usage,
+		          directory_index,
+		          &sub_directory_apparent_size,
+		          &sub_directory_allocated_size,
+		          &sub_directory_number_of_files,
+		          &sub_directory_number_of_directories,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_UINT64(
+		 "sub_directory_number_of_directories",
+		 sub_directory_number_of_directories,
+		 number_of_directories );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_UINT64(
+		 "sub_directory_number_of_files",
+		 sub_directory_number_of_files,
+		 number_of_files + 1 );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_UINT64(
+		 "sub_directory_apparent_size",
+		 sub_directory_apparent_size,
+		 apparent_size + 1 );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_disk_usage_get_directory_path(
+	          NULL,
+	          0,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_get_directory_path(
+	          disk_usage,
+	          number_of_records,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_get_directory_path(
+	          disk_usage,
+	          0,
+	          NULL,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_get_directory_values(
+	          NULL,
+	          0,
+	          &apparent_size,
+	          &allocated_size,
+	          &number_of_files,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_get_directory_values(
+	          disk_usage,
+	          -1,
+	          &apparent_size,
+	          &allocated_size,
+	          &number_of_files,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_disk_usage_get_directory_values(
+	          disk_usage,
+	          0,
+	          &apparent_size,
+	          &allocated_size,
+	          NULL,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_disk_usage_free(
+	          &disk_usage,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	if( disk_usage != NULL )
+	{
+		libcdirectory_disk_usage_free(
+		 &disk_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_disk_usage_record_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_disk_usage_record_compare(
+     void )
+{
+	libcdirectory_disk_usage_record_t first_record;
+	libcdirectory_disk_usage_record_t second_record;
+
+	libcdirectory_disk_usage_record_t *first_record_pointer  = &first_record;
+	libcdirectory_disk_usage_record_t *second_record_pointer = &second_record;
+	int result                                                = 0;
+
+	/* Test regular cases
+	 */
+	first_record.path         = "a";
+	first_record.path_length  = 1;
+	second_record.path        = "a/b";
+	second_record.path_length = 3;
+
+	result = libcdirectory_disk_usage_record_compare(
+	          &first_record_pointer,
+	          &second_record_pointer );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* The path separator sorts before any other character
+	 */
+	first_record.path         = "a/b";
+	first_record.path_length  = 3;
+	second_record.path        = "a-b";
+	second_record.path_length = 3;
+
+	result = libcdirectory_disk_usage_record_compare(
+	          &first_record_pointer,
+	          &second_record_pointer );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libcdirectory_disk_usage_record_compare(
+	          &second_record_pointer,
+	          &first_record_pointer );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	second_record.path        = "a/b";
+	second_record.path_length = 3;
+
+	result = libcdirectory_disk_usage_record_compare(
+	          &first_record_pointer,
+	          &second_record_pointer );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FILE *file_stream = NULL;
+	int result        = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+	file_stream = file_stream_open(
+	               "TestFile",
+	               "a" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = NULL;
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_disk_usage_initialize",
+	 cdirectory_test_disk_usage_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_disk_usage_free",
+	 cdirectory_test_disk_usage_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_disk_usage_calculate",
+	 cdirectory_test_disk_usage_calculate );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_disk_usage_get_directory_values",
+	 cdirectory_test_disk_usage_get_directory_values );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_disk_usage_record_compare",
+	 cdirectory_test_disk_usage_record_compare );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1012 @@
+/*
+ * Library inode set type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_inode_set.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_inode_set_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_inode_set_initialize(
+     void )
+{
+	libcdirectory_inode_set_t *inode_set = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_inode_set_initialize(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_inode_set_free(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_inode_set_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_set = (libcdirectory_inode_set_t *) 0x12345678UL;
+
+	result = libcdirectory_inode_set_initialize(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_set = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_inode_set_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_inode_set_initialize(
+		          &inode_set,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( inode_set != NULL )
+			{
+				libcdirectory_inode_set_free(
+				 &inode_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "inode_set",
+			 inode_set );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_inode_set_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_inode_set_initialize(
+		          &inode_set,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( inode_set != NULL )
+			{
+				libcdirectory_inode_set_free(
+				 &inode_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "inode_set",
+			 inode_set );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_set != NULL )
+	{
+		libcdirectory_inode_set_free(
+		 &inode_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_inode_set_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_inode_set_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_inode_set_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_inode_set_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_inode_set_empty(
+     void )
+{
+	libcdirectory_inode_set_t *inode_set = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_inode_set_initialize(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_inode_set_empty(
+	          inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          1,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_inode_set_empty(
+	          inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_values",
+	 inode_set->number_of_values,
+	 (uint64_t) 0 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_slots",
+	 inode_set->number_of_slots,
+	 (uint64_t) LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The emptied inode set should no longer contain the value
+	 */
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          1,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_inode_set_empty(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_inode_set_free(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_set != NULL )
+	{
+		libcdirectory_inode_set_free(
+		 &inode_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_inode_set_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_inode_set_calculate_hash(
+     void )
+{
+	uint64_t expected_hash = 0;
+	uint64_t hash          = 0;
+
+	/* Test regular cases
+	 */
+	expected_hash = libcdirectory_inode_set_calculate_hash(
+	                 1,
+	                 2 );
+
+	hash = libcdirectory_inode_set_calculate_hash(
+	        1,
+	        2 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* The device number should be part of the hash
+	 */
+	hash = libcdirectory_inode_set_calculate_hash(
+	        2,
+	        2 );
+
+	CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) hash,
+	 (int64_t) expected_hash );
+
+	hash = libcdirectory_inode_set_calculate_hash(
+	        1,
+	        3 );
+
+	CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) hash,
+	 (int64_t) expected_hash );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcdirectory_inode_set_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_inode_set_resize(
+     void )
+{
+	libcdirectory_inode_set_t *inode_set = NULL;
+	libcerror_error_t *error             = NULL;
+	uint64_t inode_number                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_inode_set_initialize(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_inode_set_resize(
+	          inode_set,
+	          LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_slots",
+	 inode_set->number_of_slots,
+	 (uint64_t) LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( inode_number = 1;
+	     inode_number <= 100;
+	     inode_number++ )
+	{
+		result = libcdirectory_inode_set_insert(
+		          inode_set,
+		          1,
+		          inode_number,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdirectory_inode_set_resize(
+	          inode_set,
+	          4 * LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_slots",
+	 inode_set->number_of_slots,
+	 (uint64_t) ( 4 * LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS ) );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_values",
+	 inode_set->number_of_values,
+	 (uint64_t) 100 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values should have been retained by the resize
+	 */
+	for( inode_number = 1;
+	     inode_number <= 100;
+	     inode_number++ )
+	{
+		result = libcdirectory_inode_set_insert(
+		          inode_set,
+		          1,
+		          inode_number,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_inode_set_resize(
+	          NULL,
+	          LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_inode_set_resize(
+	          inode_set,
+	          LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS / 2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_inode_set_resize(
+	          inode_set,
+	          LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS + 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_inode_set_resize(
+	          inode_set,
+	          (uint64_t) 1 << 63,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	/* Test libcdirectory_inode_set_resize with malloc failing
+	 */
+	cdirectory_test_malloc_attempts_before_fail = 0;
+
+	result = libcdirectory_inode_set_resize(
+	          inode_set,
+	          8 * LIBCDIRECTORY_INODE_SET_MINIMUM_NUMBER_OF_SLOTS,
+	          &error );
+
+	if( cdirectory_test_malloc_attempts_before_fail != -1 )
+	{
+		cdirectory_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* The failed resize should have retained the slots
+	 */
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_values",
+	 inode_set->number_of_values,
+	 (uint64_t) 100 );
+
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcdirectory_inode_set_free(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_set != NULL )
+	{
+		libcdirectory_inode_set_free(
+		 &inode_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_inode_set_insert function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_inode_set_insert(
+     void )
+{
+	libcdirectory_inode_set_t *inode_set = NULL;
+	libcerror_error_t *error             = NULL;
+	uint64_t inode_number                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_inode_set_initialize(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          1,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          1,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The same inode number on another device is a different value
+	 */
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          3,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An inode number of 0 is never contained
+	 */
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          1,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_inode_set_insert(
+	          inode_set,
+	          1,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_values",
+	 inode_set->number_of_values,
+	 (uint64_t) 2 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Inserting more values than half of the slots should resize the inode set
+	 */
+	for( inode_number = 1000;
+	     inode_number < 2000;
+	     inode_number++ )
+	{
+		result = libcdirectory_inode_set_insert(
+		          inode_set,
+		          1,
+		          inode_number,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_values",
+	 inode_set->number_of_values,
+	 (uint64_t) 1002 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_set->number_of_slots",
+	 inode_set->number_of_slots,
+	 (uint64_t) 2048 );
+
+	for( inode_number = 1000;
+	     inode_number < 2000;
+	     inode_number++ )
+	{
+		result = libcdirectory_inode_set_insert(
+		          inode_set,
+		          1,
+		          inode_number,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_inode_set_insert(
+	          NULL,
+	          1,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_inode_set_free(
+	          &inode_set,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "inode_set",
+	 inode_set );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_set != NULL )
+	{
+		libcdirectory_inode_set_free(
+		 &inode_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_inode_set_initialize",
+	 cdirectory_test_inode_set_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_inode_set_free",
+	 cdirectory_test_inode_set_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_inode_set_empty",
+	 cdirectory_test_inode_set_empty );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_inode_set_calculate_hash",
+	 cdirectory_test_inode_set_calculate_hash );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_inode_set_resize",
+	 cdirectory_test_inode_set_resize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_inode_set_insert",
+	 cdirectory_test_inode_set_insert );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
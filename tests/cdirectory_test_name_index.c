@@ -0,0 +1,908 @@
+/*
+ * Library name index type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_name_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_name_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_name_index_initialize(
+     void )
+{
+	libcdirectory_name_index_t *name_index = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_name_index_free(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_name_index_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = (libcdirectory_name_index_t *) 0x12345678UL;
+
+	result = libcdirectory_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_name_index_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_name_index_initialize(
+		          &name_index,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libcdirectory_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_name_index_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_name_index_initialize(
+		          &name_index,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libcdirectory_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libcdirectory_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_name_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_name_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_name_index_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_name_index_get_entry_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_name_index_get_entry_by_name(
+     void )
+{
+	char entry_name[ 16 ];
+
+	libcdirectory_name_index_entry_t *name_index_entry = NULL;
+	libcdirectory_name_index_t *name_index             = NULL;
+	libcerror_error_t *error                           = NULL;
+	const char *index_entry_name                       = NULL;
+	int entry_index                                    = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_name_index_append_entry(
+	          name_index,
+	          "TestFile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0x8000,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_name_index_append_entry(
+	          name_index,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0x8000,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add enough entries to require multiple allocations
+	 */
+	for( entry_index = 0;
+	     entry_index < 1000;
+	     entry_index++ )
+	{
+		entry_name[ 0 ] = 'd';
+		entry_name[ 1 ] = (char) ( '0' + ( ( entry_index / 100 ) % 10 ) );
+		entry_name[ 2 ] = (char) ( '0' + ( ( entry_index / 10 ) % 10 ) );
+		entry_name[ 3 ] = (char) ( '0' + ( entry_index % 10 ) );
+		entry_name[ 4 ] = 0;
+
+		result = libcdirectory_name_index_append_entry(
+		          name_index,
+		          entry_name,
+		          4,
+		          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+		          0x4000,
+		          (uint64_t) entry_index + 3,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdirectory_name_index_build(
+	          name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index_entry",
+	 name_index_entry );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "name_index_entry->inode_number",
+	 name_index_entry->inode_number,
+	 (uint64_t) 2 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the first caseless match is returned
+	 */
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "TESTFILE",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "name_index_entry->inode_number",
+	 name_index_entry->inode_number,
+	 (uint64_t) 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "d999",
+	          4,
+	          LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+	 "name_index_entry->inode_number",
+	 name_index_entry->inode_number,
+	 (uint64_t) 1002 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the type must match
+	 */
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "d999",
+	          4,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "TESTFILE",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_name_index_get_entry_by_name(
+	          NULL,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          NULL,
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0xff,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          NULL,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdirectory_name_index_get_entry_by_name without build
+	 */
+	result = libcdirectory_name_index_empty(
+	          name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "testfile",
+	          8,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_name_index_free(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libcdirectory_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_name_index_get_entry_by_name function with case folded names
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_name_index_get_entry_by_name_case_folded(
+     void )
+{
+	/* The names are UTF-8 encoded: "\xc3\x84" is U+00c4, "\xe2\x84\xaa" is the Kelvin sign
+	 * U+212a and "\xcf\x83" is U+03c3, the last name contains an invalid byte.
+	 */
+	const char *entry_names[ 4 ] = {
+		"\xc3\x84" "bc",
+		"\xe2\x84\xaa",
+		"\xcf\x83",
+		"bad\xff" };
+
+	const char *lookup_names[ 8 ] = {
+		"\xc3\xa4" "BC",
+		"k",
+		"K",
+		"\xce\xa3",
+		"\xcf\x82",
+		"BAD\xff",
+		"bad\xfe",
+		"bad\xef\xbf\xbd" };
+
+	uint64_t expected_inode_numbers[ 8 ] = {
+		1, 2, 2, 3, 3, 4, 0, 0 };
+
+	libcdirectory_name_index_entry_t *name_index_entry = NULL;
+	libcdirectory_name_index_t *name_index             = NULL;
+	libcerror_error_t *error                           = NULL;
+	const char *index_entry_name                       = NULL;
+	size_t name_length                                 = 0;
+	int entry_index                                    = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		name_length = narrow_string_length(
+		               entry_names[ entry_index ] );
+
+		result = libcdirectory_name_index_append_entry(
+		          name_index,
+		          entry_names[ entry_index ],
+		          name_length,
+		          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		          0x8000,
+		          (uint64_t) entry_index + 1,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdirectory_name_index_build(
+	          name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		name_length = narrow_string_length(
+		               lookup_names[ entry_index ] );
+
+		result = libcdirectory_name_index_get_entry_by_name(
+		          name_index,
+		          lookup_names[ entry_index ],
+		          name_length,
+		          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		          LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
+		          &name_index_entry,
+		          &index_entry_name,
+		          &error );
+
+		if( expected_inode_numbers[ entry_index ] == 0 )
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_UINT64(
+			 "name_index_entry->inode_number",
+			 name_index_entry->inode_number,
+			 expected_inode_numbers[ entry_index ] );
+		}
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that a case folded name does not match without the no case compare flag
+	 */
+	result = libcdirectory_name_index_get_entry_by_name(
+	          name_index,
+	          "k",
+	          1,
+	          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+	          0,
+	          &name_index_entry,
+	          &index_entry_name,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_name_index_free(
+	          &name_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libcdirectory_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_name_index_initialize",
+	 cdirectory_test_name_index_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_name_index_free",
+	 cdirectory_test_name_index_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_name_index_get_entry_by_name",
+	 cdirectory_test_name_index_get_entry_by_name );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_name_index_get_entry_by_name_case_folded",
+	 cdirectory_test_name_index_get_entry_by_name_case_folded );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1990 @@
+/*
+ * Library parallel_walker type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_parallel_walker.h"
+
+/* Tests the libcdirectory_parallel_walker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_initialize(
+     void )
+{
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parallel_walker = (libcdirectory_parallel_walker_t *) 0x12345678UL;
+
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parallel_walker = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_parallel_walker_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_parallel_walker_initialize(
+		          &parallel_walker,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( parallel_walker != NULL )
+			{
+				libcdirectory_parallel_walker_free(
+				 &parallel_walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "parallel_walker",
+			 parallel_walker );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_parallel_walker_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_parallel_walker_initialize(
+		          &parallel_walker,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( parallel_walker != NULL )
+			{
+				libcdirectory_parallel_walker_free(
+				 &parallel_walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "parallel_walker",
+			 parallel_walker );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_parallel_walker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_parallel_walker_set_read_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_set_read_buffer_size(
+     void )
+{
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_set_read_buffer_size(
+	          parallel_walker,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_parallel_walker_set_read_buffer_size(
+	          parallel_walker,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_set_read_buffer_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_set_read_buffer_size(
+	          parallel_walker,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_parallel_walker_set_maximum_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_set_maximum_depth(
+     void )
+{
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_set_maximum_depth(
+	          parallel_walker,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_set_maximum_depth(
+	          NULL,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_set_maximum_depth(
+	          parallel_walker,
+	          -1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_parallel_walker_set_maximum_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_set_maximum_buffer_size(
+     void )
+{
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_set_maximum_buffer_size(
+	          parallel_walker,
+	          4096,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_set_maximum_buffer_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_set_maximum_buffer_size(
+	          parallel_walker,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_parallel_walker_set_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_set_flags(
+     void )
+{
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_set_flags(
+	          parallel_walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_set_flags(
+	          NULL,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_set_flags(
+	          parallel_walker,
+	          0x80,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_parallel_walker_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_set_number_of_threads(
+     void )
+{
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_parallel_walker_set_number_of_threads(
+	          parallel_walker,
+	          8,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_set_number_of_threads(
+	          NULL,
+	          8,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_set_number_of_threads(
+	          parallel_walker,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_set_number_of_threads(
+	          parallel_walker,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The number of threads used by the walk tests
+ */
+#define CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS	4
+
+/* The values of the walk callback
+ */
+typedef struct cdirectory_test_parallel_walker_walk_values cdirectory_test_parallel_walker_walk_values_t;
+
+struct cdirectory_test_parallel_walker_walk_values
+{
+	/* The number of visits per thread
+	 */
+	int number_of_visits[ CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS ];
+
+	/* The maximum depth per thread
+	 */
+	int maximum_depth[ CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS ];
+
+	/* Value to indicate the callback should prune directories
+	 */
+	int prune_directories;
+
+	/* Value to indicate the callback should fail
+	 */
+	int fail;
+};
+
+/* The walk callback
+ * Every thread only updates the values of its own thread index
+ * Returns 1 to continue, 0 to prune or -1 on error
+ */
+int cdirectory_test_parallel_walker_walk_callback(
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *path,
+     size_t path_length,
+     int depth,
+     int thread_index,
+     void *callback_data,
+     libcerror_error_t **error CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+{
+	cdirectory_test_parallel_walker_walk_values_t *walk_values = NULL;
+	uint8_t entry_type                                         = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( error )
+
+	walk_values = (cdirectory_test_parallel_walker_walk_values_t *) callback_data;
+
+	if( ( walk_values->fail != 0 )
+	 || ( thread_index < 0 )
+	 || ( thread_index >= CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS ) )
+	{
+		return( -1 );
+	}
+	if( ( path == NULL )
+	 || ( path_length == 0 )
+	 || ( narrow_string_length( path ) != path_length ) )
+	{
+		return( -1 );
+	}
+	walk_values->number_of_visits[ thread_index ] += 1;
+
+	if( depth > walk_values->maximum_depth[ thread_index ] )
+	{
+		walk_values->maximum_depth[ thread_index ] = depth;
+	}
+	if( walk_values->prune_directories != 0 )
+	{
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &entry_type,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Walks a directory with a specific number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int cdirectory_test_parallel_walker_walk_with_number_of_threads(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     int number_of_threads,
+     cdirectory_test_parallel_walker_walk_values_t *walk_values,
+     int *number_of_visits,
+     int *maximum_depth,
+     libcerror_error_t **error )
+{
+	int thread_index = 0;
+
+	if( libcdirectory_parallel_walker_set_number_of_threads(
+	     parallel_walker,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdirectory_parallel_walker_walk(
+	     parallel_walker,
+	     "..",
+	     &cdirectory_test_parallel_walker_walk_callback,
+	     walk_values,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*number_of_visits = 0;
+	*maximum_depth    = 0;
+
+	for( thread_index = 0;
+	     thread_index < CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		*number_of_visits += walk_values->number_of_visits[ thread_index ];
+
+		if( walk_values->maximum_depth[ thread_index ] > *maximum_depth )
+		{
+			*maximum_depth = walk_values->maximum_depth[ thread_index ];
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libcdirectory_parallel_walker_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_walk(
+     void )
+{
+	cdirectory_test_parallel_walker_walk_values_t walk_values;
+
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcerror_error_t *error                         = NULL;
+	int maximum_depth                                = 0;
+	int multi_threaded_number_of_visits              = 0;
+	int pruned_number_of_visits                      = 0;
+	int result                                       = 0;
+	int single_threaded_number_of_visits             = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_parallel_walker_set_maximum_depth(
+	          parallel_walker,
+	          3,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_parallel_walker_set_flags(
+	          parallel_walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_values_t ) );
+
+	result = cdirectory_test_parallel_walker_walk_with_number_of_threads(
+	          parallel_walker,
+	          1,
+	          &walk_values,
+	          &single_threaded_number_of_visits,
+	          &maximum_depth,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "maximum_depth",
+	 maximum_depth,
+	 3 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.number_of_visits[ 0 ]",
+	 walk_values.number_of_visits[ 0 ],
+	 single_threaded_number_of_visits );
+
+	/* Test walk with multiple threads, which should visit the same entries
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_values_t ) );
+
+	result = cdirectory_test_parallel_walker_walk_with_number_of_threads(
+	          parallel_walker,
+	          CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS,
+	          &walk_values,
+	          &multi_threaded_number_of_visits,
+	          &maximum_depth,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "maximum_depth",
+	 maximum_depth,
+	 3 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "multi_threaded_number_of_visits",
+	 multi_threaded_number_of_visits,
+	 single_threaded_number_of_visits );
+
+	/* Test walk where the callback prunes every directory
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_values_t ) );
+
+	walk_values.prune_directories = 1;
+
+	result = cdirectory_test_parallel_walker_walk_with_number_of_threads(
+	          parallel_walker,
+	          CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS,
+	          &walk_values,
+	          &pruned_number_of_visits,
+	          &maximum_depth,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "maximum_depth",
+	 maximum_depth,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "pruned_number_of_visits",
+	 pruned_number_of_visits,
+	 single_threaded_number_of_visits );
+
+	/* Test walk without callback
+	 */
+	result = libcdirectory_parallel_walker_walk(
+	          parallel_walker,
+	          ".",
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_walk(
+	          NULL,
+	          ".",
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_walk(
+	          parallel_walker,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk where the callback fails
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_values_t ) );
+
+	walk_values.fail = 1;
+
+	result = libcdirectory_parallel_walker_walk(
+	          parallel_walker,
+	          "..",
+	          &cdirectory_test_parallel_walker_walk_callback,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk of a file
+	 */
+	result = libcdirectory_parallel_walker_walk(
+	          parallel_walker,
+	          "TestFile",
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The values of the ordered walk callback
+ */
+typedef struct cdirectory_test_parallel_walker_walk_ordered_values cdirectory_test_parallel_walker_walk_ordered_values_t;
+
+struct cdirectory_test_parallel_walker_walk_ordered_values
+{
+	/* The number of visits
+	 */
+	int number_of_visits;
+
+	/* The maximum depth
+	 */
+	int maximum_depth;
+
+	/* The hash of the depths and names in the order they were visited
+	 */
+	uint32_t hash;
+
+	/* Value to indicate the callback should prune directories
+	 */
+	int prune_directories;
+
+	/* Value to indicate the callback should fail
+	 */
+	int fail;
+};
+
+/* The ordered walk callback
+ * Returns 1 to continue, 0 to prune or -1 on error
+ */
+int cdirectory_test_parallel_walker_walk_ordered_callback(
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *path CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     size_t path_length CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     int depth,
+     void *callback_data,
+     libcerror_error_t **error CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+{
+	cdirectory_test_parallel_walker_walk_ordered_values_t *walk_values = NULL;
+	char *name                                                         = NULL;
+	uint8_t entry_type                                                 = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path_length )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( error )
+
+	walk_values = (cdirectory_test_parallel_walker_walk_ordered_values_t *) callback_data;
+
+	if( walk_values->fail != 0 )
+	{
+		return( -1 );
+	}
+	if( libcdirectory_directory_entry_get_name(
+	     directory_entry,
+	     &name,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdirectory_directory_entry_get_type(
+	     directory_entry,
+	     &entry_type,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	walk_values->number_of_visits += 1;
+
+	if( depth > walk_values->maximum_depth )
+	{
+		walk_values->maximum_depth = depth;
+	}
+	walk_values->hash = ( walk_values->hash * 31 ) + (uint32_t) depth;
+
+	while( *name != 0 )
+	{
+		walk_values->hash = ( walk_values->hash * 31 ) + (uint8_t) *name;
+
+		name++;
+	}
+	walk_values->hash = ( walk_values->hash * 31 ) + entry_type;
+
+	if( ( walk_values->prune_directories != 0 )
+	 && ( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Walks a directory with a specific number of threads and maximum buffer size in order
+ * Returns 1 if successful or -1 on error
+ */
+int cdirectory_test_parallel_walker_walk_ordered_with_number_of_threads(
+     libcdirectory_parallel_walker_t *parallel_walker,
+     int number_of_threads,
+     size_t maximum_buffer_size,
+     cdirectory_test_parallel_walker_walk_ordered_values_t *walk_values,
+     libcerror_error_t **error )
+{
+	if( libcdirectory_parallel_walker_set_number_of_threads(
+	     parallel_walker,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdirectory_parallel_walker_set_maximum_buffer_size(
+	     parallel_walker,
+	     maximum_buffer_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdirectory_parallel_walker_walk_ordered(
+	     parallel_walker,
+	     "..",
+	     &cdirectory_test_parallel_walker_walk_ordered_callback,
+	     walk_values,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libcdirectory_parallel_walker_walk_ordered function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_parallel_walker_walk_ordered(
+     void )
+{
+	cdirectory_test_parallel_walker_walk_ordered_values_t serial_walk_values;
+	cdirectory_test_parallel_walker_walk_ordered_values_t walk_values;
+
+	libcdirectory_parallel_walker_t *parallel_walker = NULL;
+	libcdirectory_walker_t *walker                   = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+	int walk_iteration                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_parallel_walker_initialize(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_parallel_walker_set_maximum_depth(
+	          parallel_walker,
+	          3,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_parallel_walker_set_flags(
+	          parallel_walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The order of a single-threaded depth-first walk is determined by the walker
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          3,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &serial_walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+	result = libcdirectory_walker_walk(
+	          walker,
+	          "..",
+	          &cdirectory_test_parallel_walker_walk_ordered_callback,
+	          NULL,
+	          &serial_walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "serial_walk_values.maximum_depth",
+	 serial_walk_values.maximum_depth,
+	 3 );
+
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+	result = cdirectory_test_parallel_walker_walk_ordered_with_number_of_threads(
+	          parallel_walker,
+	          1,
+	          4096,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.number_of_visits",
+	 walk_values.number_of_visits,
+	 serial_walk_values.number_of_visits );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_values.hash",
+	 walk_values.hash,
+	 serial_walk_values.hash );
+
+	/* Test walk with multiple threads and a small buffer, which should visit the same entries in the same order
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+	result = cdirectory_test_parallel_walker_walk_ordered_with_number_of_threads(
+	          parallel_walker,
+	          CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS,
+	          4096,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.number_of_visits",
+	 walk_values.number_of_visits,
+	 serial_walk_values.number_of_visits );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_values.hash",
+	 walk_values.hash,
+	 serial_walk_values.hash );
+
+	/* Test walk with multiple threads and a large buffer
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+	result = cdirectory_test_parallel_walker_walk_ordered_with_number_of_threads(
+	          parallel_walker,
+	          CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS,
+	          32 * 1024 * 1024,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_UINT32(
+	 "walk_values.hash",
+	 walk_values.hash,
+	 serial_walk_values.hash );
+
+	/* Test walk where the callback prunes every directory
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+	walk_values.prune_directories = 1;
+
+	result = cdirectory_test_parallel_walker_walk_ordered_with_number_of_threads(
+	          parallel_walker,
+	          CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS,
+	          4096,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.maximum_depth",
+	 walk_values.maximum_depth,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "walk_values.number_of_visits",
+	 walk_values.number_of_visits,
+	 serial_walk_values.number_of_visits );
+
+	/* Test walks where the callback prunes every directory, which releases listings
+	 * that can still be read by other threads, all buffered listings should be accounted for
+	 */
+	for( walk_iteration = 0;
+	     walk_iteration < 1000;
+	     walk_iteration++ )
+	{
+		memory_set(
+		 &walk_values,
+		 0,
+		 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+		walk_values.prune_directories = 1;
+
+		result = cdirectory_test_parallel_walker_walk_ordered_with_number_of_threads(
+		          parallel_walker,
+		          CDIRECTORY_TEST_PARALLEL_WALKER_NUMBER_OF_THREADS,
+		          32 * 1024 * 1024,
+		          &walk_values,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+		CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+		 "buffered_size",
+		 ( (libcdirectory_internal_parallel_walker_t *) parallel_walker )->buffered_size,
+		 (size_t) 0 );
+#endif
+	}
+	/* Test walk without callback
+	 */
+	result = libcdirectory_parallel_walker_walk_ordered(
+	          parallel_walker,
+	          ".",
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_parallel_walker_walk_ordered(
+	          NULL,
+	          ".",
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_parallel_walker_walk_ordered(
+	          parallel_walker,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk where the callback fails
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_parallel_walker_walk_ordered_values_t ) );
+
+	walk_values.fail = 1;
+
+	result = libcdirectory_parallel_walker_walk_ordered(
+	          parallel_walker,
+	          "..",
+	          &cdirectory_test_parallel_walker_walk_ordered_callback,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk of a file
+	 */
+	result = libcdirectory_parallel_walker_walk_ordered(
+	          parallel_walker,
+	          "TestFile",
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_parallel_walker_free(
+	          &parallel_walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "parallel_walker",
+	 parallel_walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	if( parallel_walker != NULL )
+	{
+		libcdirectory_parallel_walker_free(
+		 &parallel_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FILE *file_stream = NULL;
+	int result        = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+	file_stream = file_stream_open(
+	               "TestFile",
+	               "a" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = NULL;
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_initialize",
+	 cdirectory_test_parallel_walker_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_free",
+	 cdirectory_test_parallel_walker_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_set_number_of_threads",
+	 cdirectory_test_parallel_walker_set_number_of_threads );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_set_read_buffer_size",
+	 cdirectory_test_parallel_walker_set_read_buffer_size );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_set_maximum_depth",
+	 cdirectory_test_parallel_walker_set_maximum_depth );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_set_maximum_buffer_size",
+	 cdirectory_test_parallel_walker_set_maximum_buffer_size );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_set_flags",
+	 cdirectory_test_parallel_walker_set_flags );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_walk",
+	 cdirectory_test_parallel_walker_walk );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_parallel_walker_walk_ordered",
+	 cdirectory_test_parallel_walker_walk_ordered );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,574 @@
+/*
+ * Library pattern type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_pattern.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_pattern_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_pattern_initialize(
+     void )
+{
+	libcdirectory_pattern_t *pattern = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_pattern_initialize(
+	          &pattern,
+	          "*.txt",
+	          5,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "pattern",
+	 pattern );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_pattern_free(
+	          &pattern,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "pattern",
+	 pattern );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_pattern_initialize(
+	          NULL,
+	          "*.txt",
+	          5,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pattern = (libcdirectory_pattern_t *) 0x12345678UL;
+
+	result = libcdirectory_pattern_initialize(
+	          &pattern,
+	          "*.txt",
+	          5,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pattern = NULL;
+
+	result = libcdirectory_pattern_initialize(
+	          &pattern,
+	          NULL,
+	          5,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "pattern",
+	 pattern );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_pattern_initialize(
+	          &pattern,
+	          "*.txt",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "pattern",
+	 pattern );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a pattern that exceeds the maximum number of elements
+	 */
+	result = libcdirectory_pattern_initialize(
+	          &pattern,
+	          "0123456789012345678901234567890123456789012345678901234567890123",
+	          64,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "pattern",
+	 pattern );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_pattern_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_pattern_initialize(
+		          &pattern,
+		          "*.txt",
+		          5,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( pattern != NULL )
+			{
+				libcdirectory_pattern_free(
+				 &pattern,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "pattern",
+			 pattern );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_pattern_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_pattern_initialize(
+		          &pattern,
+		          "*.txt",
+		          5,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( pattern != NULL )
+			{
+				libcdirectory_pattern_free(
+				 &pattern,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "pattern",
+			 pattern );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern != NULL )
+	{
+		libcdirectory_pattern_free(
+		 &pattern,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_pattern_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_pattern_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_pattern_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libcdirectory_pattern_match function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_pattern_match(
+     void )
+{
+	/* The pattern, the name and if the name is expected to match
+	 */
+	const char *test_values[ 40 ][ 3 ] = {
+		{ "*", "", "1" },
+		{ "*", "name", "1" },
+		{ "**", "name", "1" },
+		{ "", "", "1" },
+		{ "", "name", "0" },
+		{ "name", "name", "1" },
+		{ "name", "Name", "0" },
+		{ "name", "names", "0" },
+		{ "*.txt", "file.txt", "1" },
+		{ "*.txt", ".txt", "1" },
+		{ "*.txt", "file.txt.gz", "0" },
+		{ "*.txt", "file.tx", "0" },
+		{ "file.*", "file.", "1" },
+		{ "f*e*.t?t", "filename.tat", "1" },
+		{ "f*e*.t?t", "filename.tt", "0" },
+		{ "*a*a*a*", "aaa", "1" },
+		{ "*a*a*a*", "abab", "0" },
+		{ "?", "a", "1" },
+		{ "?", "", "0" },
+		{ "??", "\xc3\xa4", "1" },
+		{ "[abc]", "b", "1" },
+		{ "[abc]", "d", "0" },
+		{ "[!abc]", "d", "1" },
+		{ "[!abc]", "a", "0" },
+		{ "[^abc]", "a", "0" },
+		{ "[a-c]x", "bx", "1" },
+		{ "[a-c]x", "dx", "0" },
+		{ "[]]", "]", "1" },
+		{ "[!]]", "]", "0" },
+		{ "[a-]", "-", "1" },
+		{ "[\\]]", "]", "1" },
+		{ "[abc", "[abc", "1" },
+		{ "[abc", "a", "0" },
+		{ "\\*", "*", "1" },
+		{ "\\*", "a", "0" },
+		{ "\\?", "?", "1" },
+		{ "a\\", "a\\", "1" },
+		{ "*[0-9][0-9].log", "app12.log", "1" },
+		{ "*[0-9][0-9].log", "app1.log", "0" },
+		{ "[\x80-\xff]*", "\xc3\xa4", "1" } };
+
+	libcdirectory_pattern_t *pattern = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t name_length               = 0;
+	size_t pattern_length            = 0;
+	int expected_result              = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	for( test_index = 0;
+	     test_index < 40;
+	     test_index++ )
+	{
+		pattern_length = narrow_string_length(
+		                  test_values[ test_index ][ 0 ] );
+
+		result = libcdirectory_pattern_initialize(
+		          &pattern,
+		          test_values[ test_index ][ 0 ],
+		          pattern_length,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "pattern",
+		 pattern );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		name_length = narrow_string_length(
+		               test_values[ test_index ][ 1 ] );
+
+		expected_result = (int) ( test_values[ test_index ][ 2 ][ 0 ] - '0' );
+
+		result = libcdirectory_pattern_match(
+		          pattern,
+		          test_values[ test_index ][ 1 ],
+		          name_length );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_result );
+
+		result = libcdirectory_pattern_free(
+		          &pattern,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a pattern with the maximum number of elements
+	 */
+	result = libcdirectory_pattern_initialize(
+	          &pattern,
+	          "a*b*c*d*e*f*g*h*i*j*k*l*m*n*o*p*q*r*s*t*u*v*w*x*y*z*0*1*2*3*456",
+	          63,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_pattern_match(
+	          pattern,
+	          "abcdefghijklmnopqrstuvwxyz0123456",
+	          33 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_pattern_match(
+	          pattern,
+	          "abcdefghijklmnopqrstuvwxyz012345",
+	          32 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_pattern_free(
+	          &pattern,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern != NULL )
+	{
+		libcdirectory_pattern_free(
+		 &pattern,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_pattern_initialize",
+	 cdirectory_test_pattern_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_pattern_free",
+	 cdirectory_test_pattern_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_pattern_match",
+	 cdirectory_test_pattern_match );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
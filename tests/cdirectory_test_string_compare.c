@@ -0,0 +1,528 @@
+/*
+ * Library caseless string compare functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_string_compare.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests a narrow string caseless compare function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_narrow_no_case_function(
+     int (*compare_function)(
+            const char *string1,
+            const char *string2,
+            size_t string_length ) )
+{
+	char string1[ 80 ];
+	char string2[ 80 ];
+
+	size_t string_index  = 0;
+	size_t string_length = 0;
+	int result           = 0;
+
+	for( string_length = 0;
+	     string_length < 80;
+	     string_length++ )
+	{
+		/* Test strings that only differ in case
+		 */
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			string1[ string_index ] = (char) ( 'A' + ( string_index % 26 ) );
+			string2[ string_index ] = (char) ( 'a' + ( string_index % 26 ) );
+		}
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( string_length == 0 )
+		{
+			continue;
+		}
+		/* Test strings that differ in the last character
+		 */
+		string2[ string_length - 1 ] = '0';
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test characters adjacent to the upper case range that must not match
+		 * their counterparts adjacent to the lower case range
+		 */
+		string1[ string_length - 1 ] = '@';
+		string2[ string_length - 1 ] = '`';
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "result",
+		 result,
+		 0 );
+
+		string1[ string_length - 1 ] = '[';
+		string2[ string_length - 1 ] = '{';
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test strings that contain the same non-ASCII character
+		 */
+		string1[ string_length - 1 ] = (char) 0xc4;
+		string2[ string_length - 1 ] = (char) 0xc4;
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test strings that differ in the first character after a non-ASCII character
+		 */
+		string1[ 0 ] = (char) 0xc4;
+		string2[ 0 ] = (char) 0xc4;
+
+		if( string_length > 1 )
+		{
+			string2[ string_length - 1 ] = (char) 0xc5;
+
+			result = compare_function(
+			          string1,
+			          string2,
+			          string_length );
+
+			CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcdirectory_string_compare_narrow_no_case function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_narrow_no_case(
+     void )
+{
+	return( cdirectory_test_string_compare_narrow_no_case_function(
+	         &libcdirectory_string_compare_narrow_no_case ) );
+}
+
+/* Tests the libcdirectory_string_compare_narrow_no_case_scalar function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_narrow_no_case_scalar(
+     void )
+{
+	return( cdirectory_test_string_compare_narrow_no_case_function(
+	         &libcdirectory_string_compare_narrow_no_case_scalar ) );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+/* Tests the libcdirectory_string_compare_narrow_no_case_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_narrow_no_case_sse2(
+     void )
+{
+	return( cdirectory_test_string_compare_narrow_no_case_function(
+	         &libcdirectory_string_compare_narrow_no_case_sse2 ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+/* Tests the libcdirectory_string_compare_narrow_no_case_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_narrow_no_case_avx2(
+     void )
+{
+	if( __builtin_cpu_supports( "avx2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( cdirectory_test_string_compare_narrow_no_case_function(
+	         &libcdirectory_string_compare_narrow_no_case_avx2 ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+/* Tests the libcdirectory_string_compare_narrow_no_case_neon function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_narrow_no_case_neon(
+     void )
+{
+	return( cdirectory_test_string_compare_narrow_no_case_function(
+	         &libcdirectory_string_compare_narrow_no_case_neon ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests a wide string caseless compare function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_wide_no_case_function(
+     int (*compare_function)(
+            const wchar_t *string1,
+            const wchar_t *string2,
+            size_t string_length ) )
+{
+	wchar_t string1[ 80 ];
+	wchar_t string2[ 80 ];
+
+	size_t string_index  = 0;
+	size_t string_length = 0;
+	int result           = 0;
+
+	for( string_length = 0;
+	     string_length < 80;
+	     string_length++ )
+	{
+		/* Test strings that only differ in case
+		 */
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			string1[ string_index ] = (wchar_t) ( 'A' + ( string_index % 26 ) );
+			string2[ string_index ] = (wchar_t) ( 'a' + ( string_index % 26 ) );
+		}
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( string_length == 0 )
+		{
+			continue;
+		}
+		/* Test strings that differ in the last character
+		 */
+		string2[ string_length - 1 ] = (wchar_t) '0';
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test characters adjacent to the upper case range that must not match
+		 * their counterparts adjacent to the lower case range
+		 */
+		string1[ string_length - 1 ] = (wchar_t) '@';
+		string2[ string_length - 1 ] = (wchar_t) '`';
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test characters that only match when the upper bits are ignored
+		 */
+		string1[ string_length - 1 ] = (wchar_t) 0x0141;
+		string2[ string_length - 1 ] = (wchar_t) 'A';
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test strings that contain the same non-ASCII character
+		 */
+		string1[ string_length - 1 ] = (wchar_t) 0x00c4;
+		string2[ string_length - 1 ] = (wchar_t) 0x00c4;
+
+		result = compare_function(
+		          string1,
+		          string2,
+		          string_length );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test strings that differ in the first character after a non-ASCII character
+		 */
+		string1[ 0 ] = (wchar_t) 0x00c4;
+		string2[ 0 ] = (wchar_t) 0x00c4;
+
+		if( string_length > 1 )
+		{
+			string2[ string_length - 1 ] = (wchar_t) '0';
+
+			result = compare_function(
+			          string1,
+			          string2,
+			          string_length );
+
+			CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcdirectory_string_compare_wide_no_case function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_wide_no_case(
+     void )
+{
+	return( cdirectory_test_string_compare_wide_no_case_function(
+	         &libcdirectory_string_compare_wide_no_case ) );
+}
+
+/* Tests the libcdirectory_string_compare_wide_no_case_scalar function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_wide_no_case_scalar(
+     void )
+{
+	return( cdirectory_test_string_compare_wide_no_case_function(
+	         &libcdirectory_string_compare_wide_no_case_scalar ) );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+/* Tests the libcdirectory_string_compare_wide_no_case_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_wide_no_case_sse2(
+     void )
+{
+	return( cdirectory_test_string_compare_wide_no_case_function(
+	         &libcdirectory_string_compare_wide_no_case_sse2 ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+/* Tests the libcdirectory_string_compare_wide_no_case_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_wide_no_case_avx2(
+     void )
+{
+	if( __builtin_cpu_supports( "avx2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( cdirectory_test_string_compare_wide_no_case_function(
+	         &libcdirectory_string_compare_wide_no_case_avx2 ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+/* Tests the libcdirectory_string_compare_wide_no_case_neon function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_string_compare_wide_no_case_neon(
+     void )
+{
+	return( cdirectory_test_string_compare_wide_no_case_function(
+	         &libcdirectory_string_compare_wide_no_case_neon ) );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_narrow_no_case",
+	 cdirectory_test_string_compare_narrow_no_case );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_narrow_no_case_scalar",
+	 cdirectory_test_string_compare_narrow_no_case_scalar );
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_narrow_no_case_sse2",
+	 cdirectory_test_string_compare_narrow_no_case_sse2 );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_narrow_no_case_avx2",
+	 cdirectory_test_string_compare_narrow_no_case_avx2 );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_narrow_no_case_neon",
+	 cdirectory_test_string_compare_narrow_no_case_neon );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_wide_no_case",
+	 cdirectory_test_string_compare_wide_no_case );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_wide_no_case_scalar",
+	 cdirectory_test_string_compare_wide_no_case_scalar );
+
+#if defined( LIBCDIRECTORY_HAVE_SSE2 )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_wide_no_case_sse2",
+	 cdirectory_test_string_compare_wide_no_case_sse2 );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_SSE2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_AVX2 )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_wide_no_case_avx2",
+	 cdirectory_test_string_compare_wide_no_case_avx2 );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_AVX2 ) */
+
+#if defined( LIBCDIRECTORY_HAVE_NEON )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_string_compare_wide_no_case_neon",
+	 cdirectory_test_string_compare_wide_no_case_neon );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_NEON ) */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+}
+
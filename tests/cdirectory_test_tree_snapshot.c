@@ -0,0 +1,1634 @@
+/*
+ * Library tree_snapshot type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_tree_snapshot.h"
+
+/* Tests the libcdirectory_tree_snapshot_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_snapshot_initialize(
+     void )
+{
+	libcdirectory_tree_snapshot_t *tree_snapshot = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_snapshot_initialize(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "tree_snapshot",
+	 tree_snapshot );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_snapshot_free(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "tree_snapshot",
+	 tree_snapshot );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_snapshot_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	tree_snapshot = (libcdirectory_tree_snapshot_t *) 0x12345678UL;
+
+	result = libcdirectory_tree_snapshot_initialize(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	tree_snapshot = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_tree_snapshot_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_tree_snapshot_initialize(
+		          &tree_snapshot,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( tree_snapshot != NULL )
+			{
+				libcdirectory_tree_snapshot_free(
+				 &tree_snapshot,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "tree_snapshot",
+			 tree_snapshot );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_tree_snapshot_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_tree_snapshot_initialize(
+		          &tree_snapshot,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( tree_snapshot != NULL )
+			{
+				libcdirectory_tree_snapshot_free(
+				 &tree_snapshot,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "tree_snapshot",
+			 tree_snapshot );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_snapshot != NULL )
+	{
+		libcdirectory_tree_snapshot_free(
+		 &tree_snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_tree_snapshot_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_snapshot_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_snapshot_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_tree_snapshot_build function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_snapshot_build(
+     void )
+{
+	char path[ 4096 ];
+	char parent_path[ 4096 ];
+
+	libcdirectory_tree_snapshot_t *tree_snapshot = NULL;
+	libcerror_error_t *error                     = NULL;
+	size_t maximum_path_size                     = 0;
+	size_t parent_path_length                    = 0;
+	size_t path_length                           = 0;
+	uint64_t inode_number                        = 0;
+	uint64_t size                                = 0;
+	int64_t modification_time                    = 0;
+	uint8_t type                                 = 0;
+	int directory_index                          = 0;
+	int first_entry_record_index                 = 0;
+	int number_of_directories                    = 0;
+	int number_of_entries                        = 0;
+	int number_of_records                        = 0;
+	int parent_index                             = 0;
+	int parent_record_index                      = 0;
+	int record_index                             = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_tree_snapshot_initialize(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_snapshot_build(
+	          tree_snapshot,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_snapshot_get_number_of_records(
+	          tree_snapshot,
+	          &number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_get_number_of_directories(
+	          tree_snapshot,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_get_maximum_path_size(
+	          tree_snapshot,
+	          &maximum_path_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_path_size",
+	 (int) maximum_path_size,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "maximum_path_size",
+	 (int) maximum_path_size,
+	 4097 );
+
+	/* The first record is the directory of the tree
+	 */
+	result = libcdirectory_tree_snapshot_get_record(
+	          tree_snapshot,
+	          0,
+	          &type,
+	          &size,
+	          &modification_time,
+	          &inode_number,
+	          &parent_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "type",
+	 (int) type,
+	 LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "parent_index",
+	 parent_index,
+	 -1 );
+
+	result = libcdirectory_tree_snapshot_get_record_path(
+	          tree_snapshot,
+	          0,
+	          path,
+	          4096,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "path[ 0 ]",
+	 (int) path[ 0 ],
+	 0 );
+
+	result = libcdirectory_tree_snapshot_get_directory(
+	          tree_snapshot,
+	          0,
+	          &record_index,
+	          &first_entry_record_index,
+	          &number_of_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "first_entry_record_index",
+	 first_entry_record_index,
+	 1 );
+
+	/* The path of every record starts with the path of its parent directory
+	 * and the record is an entry of its parent directory
+	 */
+	for( record_index = 1;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libcdirectory_tree_snapshot_get_record(
+		          tree_snapshot,
+		          record_index,
+		          &type,
+		          &size,
+		          &modification_time,
+		          &inode_number,
+		          &parent_index,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdirectory_tree_snapshot_get_directory(
+		          tree_snapshot,
+		          parent_index,
+		          &parent_record_index,
+		          &first_entry_record_index,
+		          &number_of_entries,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "parent_record_index",
+		 parent_record_index,
+		 record_index );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "first_entry_record_index",
+		 first_entry_record_index,
+		 record_index + 1 );
+
+		CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+		 "first_entry_record_index",
+		 first_entry_record_index + number_of_entries,
+		 record_index );
+
+		result = libcdirectory_tree_snapshot_get_directory_index(
+		          tree_snapshot,
+		          parent_record_index,
+		          &directory_index,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "directory_index",
+		 directory_index,
+		 parent_index );
+
+		result = libcdirectory_tree_snapshot_get_record_path(
+		          tree_snapshot,
+		          parent_record_index,
+		          parent_path,
+		          4096,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdirectory_tree_snapshot_get_record_path(
+		          tree_snapshot,
+		          record_index,
+		          path,
+		          4096,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		parent_path_length = narrow_string_length(
+		                      parent_path );
+
+		path_length = narrow_string_length(
+		               path );
+
+		CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+		 "path_length",
+		 (int) path_length,
+		 (int) parent_path_length );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "path_length",
+		 (int) path_length,
+		 (int) maximum_path_size );
+
+		result = memory_compare(
+		          path,
+		          parent_path,
+		          parent_path_length );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_snapshot_build(
+	          NULL,
+	          "..",
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_build(
+	          tree_snapshot,
+	          NULL,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_build(
+	          tree_snapshot,
+	          "..",
+	          0xff,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_get_record(
+	          tree_snapshot,
+	          number_of_records,
+	          &type,
+	          &size,
+	          &modification_time,
+	          &inode_number,
+	          &parent_index,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_get_directory(
+	          tree_snapshot,
+	          number_of_directories,
+	          &record_index,
+	          &first_entry_record_index,
+	          &number_of_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The path of the second record is not empty and does not fit in a single character
+	 */
+	result = libcdirectory_tree_snapshot_get_record_path(
+	          tree_snapshot,
+	          1,
+	          path,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_get_record_path(
+	          tree_snapshot,
+	          -1,
+	          path,
+	          4096,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_tree_snapshot_free(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "tree_snapshot",
+	 tree_snapshot );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_snapshot != NULL )
+	{
+		libcdirectory_tree_snapshot_free(
+		 &tree_snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_tree_snapshot_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_snapshot_set_data(
+     void )
+{
+	char path[ 4096 ];
+	char set_path[ 4096 ];
+
+	libcdirectory_tree_snapshot_t *set_tree_snapshot = NULL;
+	libcdirectory_tree_snapshot_t *tree_snapshot     = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint8_t *data                                    = NULL;
+	size_t data_size                                 = 0;
+	size_t set_data_size                             = 0;
+	int number_of_records                            = 0;
+	int record_index                                 = 0;
+	int result                                       = 0;
+	int set_number_of_records                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_tree_snapshot_initialize(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_initialize(
+	          &set_tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_build(
+	          tree_snapshot,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_get_number_of_records(
+	          tree_snapshot,
+	          &number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_get_data_size(
+	          tree_snapshot,
+	          &data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "data_size",
+	 (int) data_size,
+	 32 );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdirectory_tree_snapshot_write_data(
+	          tree_snapshot,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_snapshot_set_data(
+	          set_tree_snapshot,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_snapshot_get_number_of_records(
+	          set_tree_snapshot,
+	          &set_number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "set_number_of_records",
+	 set_number_of_records,
+	 number_of_records );
+
+	result = libcdirectory_tree_snapshot_get_data_size(
+	          set_tree_snapshot,
+	          &set_data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+	 "set_data_size",
+	 set_data_size,
+	 data_size );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libcdirectory_tree_snapshot_get_record_path(
+		          tree_snapshot,
+		          record_index,
+		          path,
+		          4096,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdirectory_tree_snapshot_get_record_path(
+		          set_tree_snapshot,
+		          record_index,
+		          set_path,
+		          4096,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = narrow_string_compare(
+		          path,
+		          set_path,
+		          narrow_string_length( path ) + 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcdirectory_tree_snapshot_close(
+	          set_tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_tree_snapshot_get_number_of_records(
+	          set_tree_snapshot,
+	          &set_number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "set_number_of_records",
+	 set_number_of_records,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_snapshot_set_data(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_set_data(
+	          set_tree_snapshot,
+	          NULL,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_set_data(
+	          set_tree_snapshot,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported signature
+	 */
+	data[ 0 ] = 'x';
+
+	result = libcdirectory_tree_snapshot_set_data(
+	          set_tree_snapshot,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ 0 ] = 'c';
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported format version
+	 */
+	data[ 4 ] = 0xff;
+
+	result = libcdirectory_tree_snapshot_set_data(
+	          set_tree_snapshot,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ 4 ] = 1;
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of directories that exceeds the number of records
+	 */
+	data[ 15 ] = 0x7f;
+
+	result = libcdirectory_tree_snapshot_set_data(
+	          set_tree_snapshot,
+	          data,
+	          data_size,
+	          &error );
+
+	data[ 15 ] = 0;
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_get_data_size(
+	          set_tree_snapshot,
+	          &set_data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_write_data(
+	          tree_snapshot,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_tree_snapshot_free(
+	          &set_tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_free(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( set_tree_snapshot != NULL )
+	{
+		libcdirectory_tree_snapshot_free(
+		 &set_tree_snapshot,
+		 NULL );
+	}
+	if( tree_snapshot != NULL )
+	{
+		libcdirectory_tree_snapshot_free(
+		 &tree_snapshot,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#if defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+
+/* Tests the libcdirectory_tree_snapshot_open function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_snapshot_open(
+     void )
+{
+	char path[ 4096 ];
+	char open_path[ 4096 ];
+
+	libcdirectory_tree_snapshot_t *open_tree_snapshot = NULL;
+	libcdirectory_tree_snapshot_t *tree_snapshot      = NULL;
+	libcerror_error_t *error                          = NULL;
+	FILE *file_stream                                 = NULL;
+	uint8_t *data                                     = NULL;
+	size_t data_size                                  = 0;
+	size_t write_count                                = 0;
+	int number_of_records                             = 0;
+	int open_number_of_records                        = 0;
+	int record_index                                  = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_tree_snapshot_initialize(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_initialize(
+	          &open_tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_build(
+	          tree_snapshot,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_get_number_of_records(
+	          tree_snapshot,
+	          &number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_get_data_size(
+	          tree_snapshot,
+	          &data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdirectory_tree_snapshot_write_data(
+	          tree_snapshot,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_stream = file_stream_open(
+	               "TestSnapshot",
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+	 "write_count",
+	 write_count,
+	 data_size );
+
+	result = file_stream_close(
+	          file_stream );
+
+	file_stream = NULL;
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_snapshot_open(
+	          open_tree_snapshot,
+	          "TestSnapshot",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_snapshot_get_number_of_records(
+	          open_tree_snapshot,
+	          &open_number_of_records,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "open_number_of_records",
+	 open_number_of_records,
+	 number_of_records );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libcdirectory_tree_snapshot_get_record_path(
+		          tree_snapshot,
+		          record_index,
+		          path,
+		          4096,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdirectory_tree_snapshot_get_record_path(
+		          open_tree_snapshot,
+		          record_index,
+		          open_path,
+		          4096,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = narrow_string_compare(
+		          path,
+		          open_path,
+		          narrow_string_length( path ) + 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcdirectory_tree_snapshot_close(
+	          open_tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_snapshot_open(
+	          NULL,
+	          "TestSnapshot",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_open(
+	          open_tree_snapshot,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a file that is not a tree snapshot
+	 */
+	result = libcdirectory_tree_snapshot_open(
+	          open_tree_snapshot,
+	          "TestFile",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_open(
+	          open_tree_snapshot,
+	          "TestSnapshotMissing",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_snapshot_close(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_tree_snapshot_free(
+	          &open_tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_snapshot_free(
+	          &tree_snapshot,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( open_tree_snapshot != NULL )
+	{
+		libcdirectory_tree_snapshot_free(
+		 &open_tree_snapshot,
+		 NULL );
+	}
+	if( tree_snapshot != NULL )
+	{
+		libcdirectory_tree_snapshot_free(
+		 &tree_snapshot,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_tree_snapshot_entry_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_snapshot_entry_compare(
+     void )
+{
+	libcdirectory_tree_snapshot_entry_t first_entry;
+	libcdirectory_tree_snapshot_entry_t second_entry;
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	first_entry.name         = "a";
+	first_entry.name_length  = 1;
+	second_entry.name        = "ab";
+	second_entry.name_length = 2;
+
+	result = libcdirectory_tree_snapshot_entry_compare(
+	          &first_entry,
+	          &second_entry );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libcdirectory_tree_snapshot_entry_compare(
+	          &second_entry,
+	          &first_entry );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	second_entry.name        = "a";
+	second_entry.name_length = 1;
+
+	result = libcdirectory_tree_snapshot_entry_compare(
+	          &first_entry,
+	          &second_entry );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FILE *file_stream = NULL;
+	int result        = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+	file_stream = file_stream_open(
+	               "TestFile",
+	               "a" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = NULL;
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_snapshot_initialize",
+	 cdirectory_test_tree_snapshot_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_snapshot_free",
+	 cdirectory_test_tree_snapshot_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_snapshot_build",
+	 cdirectory_test_tree_snapshot_build );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_snapshot_set_data",
+	 cdirectory_test_tree_snapshot_set_data );
+
+#if defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_snapshot_open",
+	 cdirectory_test_tree_snapshot_open );
+
+#endif /* defined( LIBCDIRECTORY_HAVE_TREE_SNAPSHOT_MAPPING ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_snapshot_entry_compare",
+	 cdirectory_test_tree_snapshot_entry_compare );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1305 @@
+/*
+ * Library tree_state type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+#include "../libcdirectory/libcdirectory_tree_state.h"
+
+/* Tests the libcdirectory_tree_state_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_state_initialize(
+     void )
+{
+	libcdirectory_tree_state_t *tree_state = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_state_initialize(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "tree_state",
+	 tree_state );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_state_free(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "tree_state",
+	 tree_state );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_state_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	tree_state = (libcdirectory_tree_state_t *) 0x12345678UL;
+
+	result = libcdirectory_tree_state_initialize(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	tree_state = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_tree_state_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_tree_state_initialize(
+		          &tree_state,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( tree_state != NULL )
+			{
+				libcdirectory_tree_state_free(
+				 &tree_state,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "tree_state",
+			 tree_state );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_tree_state_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_tree_state_initialize(
+		          &tree_state,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( tree_state != NULL )
+			{
+				libcdirectory_tree_state_free(
+				 &tree_state,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "tree_state",
+			 tree_state );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_state != NULL )
+	{
+		libcdirectory_tree_state_free(
+		 &tree_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_tree_state_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_state_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_state_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libcdirectory_tree_state_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_state_scan(
+     void )
+{
+	libcdirectory_tree_state_t *tree_state = NULL;
+	libcerror_error_t *error               = NULL;
+	const char *path                       = NULL;
+	size_t path_length                     = 0;
+	int number_of_directories              = 0;
+	int number_of_read_directories         = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_tree_state_initialize(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_state_scan(
+	          tree_state,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_state_get_number_of_directories(
+	          tree_state,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 1 );
+
+	/* Without a previous scan the entries of every directory are read
+	 */
+	result = libcdirectory_tree_state_get_number_of_read_directories(
+	          tree_state,
+	          &number_of_read_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_directories",
+	 number_of_read_directories,
+	 number_of_directories );
+
+	result = libcdirectory_tree_state_directory_was_read(
+	          tree_state,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_get_directory_path(
+	          tree_state,
+	          0,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 (size_t) 0 );
+
+	result = libcdirectory_tree_state_get_directory_path(
+	          tree_state,
+	          1,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "path_length",
+	 (int) path_length,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_state_scan(
+	          NULL,
+	          "..",
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_scan(
+	          tree_state,
+	          NULL,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_scan(
+	          tree_state,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_POST_ORDER,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_get_directory_path(
+	          tree_state,
+	          number_of_directories,
+	          &path,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_directory_was_read(
+	          tree_state,
+	          -1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan of a file, which clears the tree state
+	 */
+	result = libcdirectory_tree_state_scan(
+	          tree_state,
+	          "TestFile",
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_get_number_of_directories(
+	          tree_state,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libcdirectory_tree_state_free(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "tree_state",
+	 tree_state );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_state != NULL )
+	{
+		libcdirectory_tree_state_free(
+		 &tree_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_tree_state_get_number_of_entries and libcdirectory_tree_state_get_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_state_get_entry(
+     void )
+{
+	libcdirectory_tree_state_t *tree_state = NULL;
+	libcerror_error_t *error               = NULL;
+	const char *name                       = NULL;
+	size_t name_length                     = 0;
+	uint64_t inode_number                  = 0;
+	uint8_t type                           = 0;
+	int entry_index                        = 0;
+	int number_of_entries                  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_tree_state_initialize(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_scan(
+	          tree_state,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_state_get_number_of_entries(
+	          tree_state,
+	          0,
+	          &number_of_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libcdirectory_tree_state_get_entry(
+		          tree_state,
+		          0,
+		          entry_index,
+		          &name,
+		          &name_length,
+		          &type,
+		          &inode_number,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "name",
+		 name );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+		 "name_length",
+		 name_length,
+		 narrow_string_length( name ) );
+	}
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_state_get_number_of_entries(
+	          NULL,
+	          0,
+	          &number_of_entries,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_get_number_of_entries(
+	          tree_state,
+	          0,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_get_entry(
+	          tree_state,
+	          0,
+	          number_of_entries,
+	          &name,
+	          &name_length,
+	          &type,
+	          &inode_number,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_get_entry(
+	          tree_state,
+	          0,
+	          0,
+	          NULL,
+	          &name_length,
+	          &type,
+	          &inode_number,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_tree_state_free(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_state != NULL )
+	{
+		libcdirectory_tree_state_free(
+		 &tree_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_tree_state_write_data and libcdirectory_tree_state_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_state_read_data(
+     void )
+{
+	libcdirectory_tree_state_t *read_tree_state = NULL;
+	libcdirectory_tree_state_t *tree_state      = NULL;
+	libcerror_error_t *error                    = NULL;
+	uint8_t *data                               = NULL;
+	const char *path                            = NULL;
+	const char *read_path                       = NULL;
+	size_t data_size                            = 0;
+	size_t path_length                          = 0;
+	size_t read_path_length                     = 0;
+	int directory_index                         = 0;
+	int number_of_directories                   = 0;
+	int number_of_read_directories              = 0;
+	int read_number_of_directories              = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_tree_state_initialize(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_initialize(
+	          &read_tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_scan(
+	          tree_state,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_get_number_of_directories(
+	          tree_state,
+	          &number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_get_data_size(
+	          tree_state,
+	          &data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "data_size",
+	 (int) data_size,
+	 20 );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_tree_state_write_data(
+	          tree_state,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_state_read_data(
+	          read_tree_state,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_tree_state_get_number_of_directories(
+	          read_tree_state,
+	          &read_number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "read_number_of_directories",
+	 read_number_of_directories,
+	 number_of_directories );
+
+	for( directory_index = 0;
+	     directory_index < number_of_directories;
+	     directory_index++ )
+	{
+		result = libcdirectory_tree_state_get_directory_path(
+		          tree_state,
+		          directory_index,
+		          &path,
+		          &path_length,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdirectory_tree_state_get_directory_path(
+		          read_tree_state,
+		          directory_index,
+		          &read_path,
+		          &read_path_length,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_SIZE(
+		 "read_path_length",
+		 read_path_length,
+		 path_length );
+
+		result = narrow_string_compare(
+		          read_path,
+		          path,
+		          path_length + 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test a scan with the tree state that was read, where the scan time is set
+	 * in the future so that no directory is considered to have changed shortly
+	 * before the scan. Only the directories that changed since the previous
+	 * scan are read, such as the directory that contains the test log files
+	 */
+	data[ 8 ]  = 0;
+	data[ 9 ]  = 0;
+	data[ 10 ] = 0;
+	data[ 11 ] = 0;
+	data[ 12 ] = 0;
+	data[ 13 ] = 0;
+	data[ 14 ] = 0;
+	data[ 15 ] = 0x1f;
+
+	result = libcdirectory_tree_state_read_data(
+	          read_tree_state,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_scan(
+	          read_tree_state,
+	          "..",
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_get_number_of_directories(
+	          read_tree_state,
+	          &read_number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_get_number_of_read_directories(
+	          read_tree_state,
+	          &number_of_read_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_read_directories",
+	 number_of_read_directories,
+	 read_number_of_directories );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_tree_state_write_data(
+	          tree_state,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_read_data(
+	          read_tree_state,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_get_number_of_directories(
+	          read_tree_state,
+	          &read_number_of_directories,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "read_number_of_directories",
+	 read_number_of_directories,
+	 0 );
+
+	result = libcdirectory_tree_state_read_data(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_tree_state_read_data(
+	          read_tree_state,
+	          NULL,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with an unsupported format version
+	 */
+	data[ 4 ] = 0xff;
+
+	result = libcdirectory_tree_state_read_data(
+	          read_tree_state,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with an unsupported signature
+	 */
+	data[ 0 ] = 0xff;
+
+	result = libcdirectory_tree_state_read_data(
+	          read_tree_state,
+	          data,
+	          data_size,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libcdirectory_tree_state_free(
+	          &read_tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdirectory_tree_state_free(
+	          &tree_state,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( read_tree_state != NULL )
+	{
+		libcdirectory_tree_state_free(
+		 &read_tree_state,
+		 NULL );
+	}
+	if( tree_state != NULL )
+	{
+		libcdirectory_tree_state_free(
+		 &tree_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+/* Tests the libcdirectory_tree_state_named_listing_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_tree_state_named_listing_compare(
+     void )
+{
+	libcdirectory_tree_state_named_listing_t first_named_listing;
+	libcdirectory_tree_state_named_listing_t second_named_listing;
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	first_named_listing.name         = "a";
+	first_named_listing.name_length  = 1;
+	second_named_listing.name        = "ab";
+	second_named_listing.name_length = 2;
+
+	result = libcdirectory_tree_state_named_listing_compare(
+	          &first_named_listing,
+	          &second_named_listing );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libcdirectory_tree_state_named_listing_compare(
+	          &second_named_listing,
+	          &first_named_listing );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	second_named_listing.name        = "a";
+	second_named_listing.name_length = 1;
+
+	result = libcdirectory_tree_state_named_listing_compare(
+	          &first_named_listing,
+	          &second_named_listing );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FILE *file_stream = NULL;
+	int result        = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+	file_stream = file_stream_open(
+	               "TestFile",
+	               "a" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = NULL;
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_state_initialize",
+	 cdirectory_test_tree_state_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_state_free",
+	 cdirectory_test_tree_state_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_state_scan",
+	 cdirectory_test_tree_state_scan );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_state_get_entry",
+	 cdirectory_test_tree_state_get_entry );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_state_read_data",
+	 cdirectory_test_tree_state_read_data );
+
+#if defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_tree_state_named_listing_compare",
+	 cdirectory_test_tree_state_named_listing_compare );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDIRECTORY_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
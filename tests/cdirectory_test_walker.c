@@ -0,0 +1,2294 @@
+/*
+ * Library walker type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "cdirectory_test_libcdirectory.h"
+#include "cdirectory_test_libcerror.h"
+#include "cdirectory_test_macros.h"
+#include "cdirectory_test_memory.h"
+#include "cdirectory_test_unused.h"
+
+/* Tests the libcdirectory_walker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_initialize(
+     void )
+{
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_initialize(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	walker = (libcdirectory_walker_t *) 0x12345678UL;
+
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	walker = NULL;
+
+#if defined( HAVE_CDIRECTORY_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_walker_initialize with malloc failing
+		 */
+		cdirectory_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdirectory_walker_initialize(
+		          &walker,
+		          &error );
+
+		if( cdirectory_test_malloc_attempts_before_fail != -1 )
+		{
+			cdirectory_test_malloc_attempts_before_fail = -1;
+
+			if( walker != NULL )
+			{
+				libcdirectory_walker_free(
+				 &walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "walker",
+			 walker );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdirectory_walker_initialize with memset failing
+		 */
+		cdirectory_test_memset_attempts_before_fail = test_number;
+
+		result = libcdirectory_walker_initialize(
+		          &walker,
+		          &error );
+
+		if( cdirectory_test_memset_attempts_before_fail != -1 )
+		{
+			cdirectory_test_memset_attempts_before_fail = -1;
+
+			if( walker != NULL )
+			{
+				libcdirectory_walker_free(
+				 &walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDIRECTORY_TEST_ASSERT_IS_NULL(
+			 "walker",
+			 walker );
+
+			CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDIRECTORY_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_walker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_free(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_walker_set_read_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_set_read_buffer_size(
+     void )
+{
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_walker_set_read_buffer_size(
+	          walker,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_read_buffer_size(
+	          walker,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_set_read_buffer_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_set_read_buffer_size(
+	          walker,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_walker_set_maximum_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_set_maximum_depth(
+     void )
+{
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_set_maximum_depth(
+	          NULL,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          -1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_walker_set_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_set_flags(
+     void )
+{
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_POST_ORDER | LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_FOLLOW_SYMBOLIC_LINKS,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( WINAPI )
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_DETECT_CYCLES | LIBCDIRECTORY_WALKER_FLAG_DETECT_HARD_LINKS | LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_set_flags(
+	          NULL,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          0x80,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_walker_open and libcdirectory_walker_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_open(
+     void )
+{
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdirectory_walker_open(
+	          walker,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_open(
+	          NULL,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open of a walker that is already open
+	 */
+	result = libcdirectory_walker_open(
+	          walker,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set flags of a walker that is open
+	 */
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_close(
+	          walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_close(
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test close of a walker that is not open
+	 */
+	result = libcdirectory_walker_close(
+	          walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open of a file
+	 */
+	result = libcdirectory_walker_open(
+	          walker,
+	          "TestFile",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdirectory_walker_read_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_read_entry(
+     void )
+{
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	libcdirectory_walker_t *walker                   = NULL;
+	libcerror_error_t *error                         = NULL;
+	const char *path                                 = NULL;
+	size_t path_length                               = 0;
+	uint8_t entry_type                               = 0;
+	uint8_t visit_type                               = 0;
+	int depth                                        = 0;
+	int found_test_file                              = 0;
+	int number_of_directories                        = 0;
+	int number_of_post_order_visits                  = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of the current directory with a maximum depth of 1
+	 */
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          1,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_open(
+	          walker,
+	          ".",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libcdirectory_walker_read_entry(
+		          walker,
+		          directory_entry,
+		          &visit_type,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "visit_type",
+		 visit_type,
+		 LIBCDIRECTORY_WALKER_VISIT_TYPE_PRE_ORDER );
+
+		result = libcdirectory_walker_get_depth(
+		          walker,
+		          &depth,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "depth",
+		 depth,
+		 1 );
+
+		result = libcdirectory_walker_get_path(
+		          walker,
+		          &path,
+		          &path_length,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+		 "path",
+		 path );
+
+		if( ( path_length == 8 )
+		 && ( narrow_string_compare(
+		       path,
+		       "TestFile",
+		       8 ) == 0 ) )
+		{
+			found_test_file = 1;
+		}
+	}
+	while( result != 0 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "found_test_file",
+	 found_test_file,
+	 1 );
+
+	/* Test read after the last entry
+	 */
+	result = libcdirectory_walker_read_entry(
+	          walker,
+	          directory_entry,
+	          &visit_type,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_close(
+	          walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of the parent directory with a maximum depth of 2 and post-order visits
+	 * The current directory is a subdirectory of the parent directory and contains TestFile
+	 */
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_POST_ORDER | LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_open(
+	          walker,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	found_test_file = 0;
+
+	do
+	{
+		result = libcdirectory_walker_read_entry(
+		          walker,
+		          directory_entry,
+		          &visit_type,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		result = libcdirectory_walker_get_depth(
+		          walker,
+		          &depth,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+		 "depth",
+		 depth,
+		 0 );
+
+		CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+		 "depth",
+		 depth,
+		 3 );
+
+		result = libcdirectory_walker_get_path(
+		          walker,
+		          &path,
+		          &path_length,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdirectory_directory_entry_get_type(
+		          directory_entry,
+		          &entry_type,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( visit_type == LIBCDIRECTORY_WALKER_VISIT_TYPE_POST_ORDER )
+		{
+			CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+			 "entry_type",
+			 entry_type,
+			 LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY );
+
+			CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+			 "depth",
+			 depth,
+			 1 );
+
+			number_of_post_order_visits++;
+		}
+		else
+		{
+			if( ( depth == 1 )
+			 && ( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY ) )
+			{
+				number_of_directories++;
+			}
+			if( ( depth == 2 )
+			 && ( path_length > 9 )
+			 && ( narrow_string_compare(
+			       &( path[ path_length - 9 ] ),
+			       "/TestFile",
+			       9 ) == 0 ) )
+			{
+				found_test_file = 1;
+			}
+		}
+	}
+	while( result != 0 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "found_test_file",
+	 found_test_file,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_post_order_visits",
+	 number_of_post_order_visits,
+	 number_of_directories + 1 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_post_order_visits",
+	 number_of_post_order_visits,
+	 0 );
+
+	result = libcdirectory_walker_close(
+	          walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of the parent directory where every directory is pruned
+	 */
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          0,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_open(
+	          walker,
+	          "..",
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libcdirectory_walker_read_entry(
+		          walker,
+		          directory_entry,
+		          &visit_type,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		CDIRECTORY_TEST_ASSERT_EQUAL_UINT8(
+		 "visit_type",
+		 visit_type,
+		 LIBCDIRECTORY_WALKER_VISIT_TYPE_PRE_ORDER );
+
+		result = libcdirectory_walker_get_depth(
+		          walker,
+		          &depth,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "depth",
+		 depth,
+		 1 );
+
+		result = libcdirectory_walker_prune(
+		          walker,
+		          &error );
+
+		CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDIRECTORY_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( result != 0 );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_read_entry(
+	          NULL,
+	          directory_entry,
+	          &visit_type,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_read_entry(
+	          walker,
+	          NULL,
+	          &visit_type,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_read_entry(
+	          walker,
+	          directory_entry,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_get_path(
+	          walker,
+	          NULL,
+	          &path_length,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_get_depth(
+	          walker,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_close(
+	          walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read and prune of a walker that is not open
+	 */
+	result = libcdirectory_walker_read_entry(
+	          walker,
+	          directory_entry,
+	          &visit_type,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdirectory_walker_prune(
+	          walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The values of the walk callbacks
+ */
+typedef struct cdirectory_test_walker_walk_values cdirectory_test_walker_walk_values_t;
+
+struct cdirectory_test_walker_walk_values
+{
+	/* The number of pre-order visits
+	 */
+	int number_of_pre_order_visits;
+
+	/* The number of post-order visits
+	 */
+	int number_of_post_order_visits;
+
+	/* The maximum depth
+	 */
+	int maximum_depth;
+
+	/* Value to indicate the callback should prune directories
+	 */
+	int prune_directories;
+
+	/* Value to indicate the callback should fail
+	 */
+	int fail;
+};
+
+/* The walk pre-order callback
+ * Returns 1 to continue, 0 to prune or -1 on error
+ */
+int cdirectory_test_walker_walk_pre_order_callback(
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *path CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     size_t path_length CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     int depth,
+     void *callback_data,
+     libcerror_error_t **error CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+{
+	cdirectory_test_walker_walk_values_t *walk_values = NULL;
+	uint8_t entry_type                                = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path_length )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( error )
+
+	walk_values = (cdirectory_test_walker_walk_values_t *) callback_data;
+
+	if( walk_values->fail != 0 )
+	{
+		return( -1 );
+	}
+	walk_values->number_of_pre_order_visits += 1;
+
+	if( depth > walk_values->maximum_depth )
+	{
+		walk_values->maximum_depth = depth;
+	}
+	if( walk_values->prune_directories != 0 )
+	{
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &entry_type,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( entry_type == LIBCDIRECTORY_ENTRY_TYPE_DIRECTORY )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* The walk post-order callback
+ * Returns 1 to continue or -1 on error
+ */
+int cdirectory_test_walker_walk_post_order_callback(
+     libcdirectory_directory_entry_t *directory_entry CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     const char *path CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     size_t path_length CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     int depth CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+{
+	cdirectory_test_walker_walk_values_t *walk_values = NULL;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( directory_entry )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path_length )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( depth )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( error )
+
+	walk_values = (cdirectory_test_walker_walk_values_t *) callback_data;
+
+	walk_values->number_of_post_order_visits += 1;
+
+	return( 1 );
+}
+
+/* Tests the libcdirectory_walker_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_walk(
+     void )
+{
+	cdirectory_test_walker_walk_values_t walk_values;
+
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_maximum_depth(
+	          walker,
+	          2,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_SKIP_INACCESSIBLE,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_walker_walk_values_t ) );
+
+	result = libcdirectory_walker_walk(
+	          walker,
+	          "..",
+	          &cdirectory_test_walker_walk_pre_order_callback,
+	          &cdirectory_test_walker_walk_post_order_callback,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.maximum_depth",
+	 walk_values.maximum_depth,
+	 2 );
+
+	CDIRECTORY_TEST_ASSERT_GREATER_THAN_INT(
+	 "walk_values.number_of_post_order_visits",
+	 walk_values.number_of_post_order_visits,
+	 0 );
+
+	CDIRECTORY_TEST_ASSERT_LESS_THAN_INT(
+	 "walk_values.number_of_post_order_visits",
+	 walk_values.number_of_post_order_visits,
+	 walk_values.number_of_pre_order_visits );
+
+	/* Test walk where the callback prunes every directory
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_walker_walk_values_t ) );
+
+	walk_values.prune_directories = 1;
+
+	result = libcdirectory_walker_walk(
+	          walker,
+	          "..",
+	          &cdirectory_test_walker_walk_pre_order_callback,
+	          &cdirectory_test_walker_walk_post_order_callback,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.maximum_depth",
+	 walk_values.maximum_depth,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "walk_values.number_of_post_order_visits",
+	 walk_values.number_of_post_order_visits,
+	 0 );
+
+	/* Test walk without callbacks
+	 */
+	result = libcdirectory_walker_walk(
+	          walker,
+	          ".",
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdirectory_walker_walk(
+	          NULL,
+	          ".",
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk where the callback fails
+	 */
+	memory_set(
+	 &walk_values,
+	 0,
+	 sizeof( cdirectory_test_walker_walk_values_t ) );
+
+	walk_values.fail = 1;
+
+	result = libcdirectory_walker_walk(
+	          walker,
+	          ".",
+	          &cdirectory_test_walker_walk_pre_order_callback,
+	          NULL,
+	          &walk_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk of a file
+	 */
+	result = libcdirectory_walker_walk(
+	          walker,
+	          "TestFile",
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H )
+
+/* The values of the walk fixture callback
+ */
+typedef struct cdirectory_test_walker_fixture_values cdirectory_test_walker_fixture_values_t;
+
+struct cdirectory_test_walker_fixture_values
+{
+	/* The number of visits
+	 */
+	int number_of_visits;
+
+	/* The number of visits of the symbolic link loop
+	 */
+	int number_of_loop_visits;
+
+	/* The number of visits of the hard linked file
+	 */
+	int number_of_file_visits;
+};
+
+/* The walk fixture callback
+ * Returns 1 to continue or -1 on error
+ */
+int cdirectory_test_walker_fixture_callback(
+     libcdirectory_directory_entry_t *directory_entry,
+     const char *path CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     size_t path_length CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     int depth CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+{
+	cdirectory_test_walker_fixture_values_t *fixture_values = NULL;
+	char *name                                              = NULL;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( path_length )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( depth )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( error )
+
+	fixture_values = (cdirectory_test_walker_fixture_values_t *) callback_data;
+
+	if( libcdirectory_directory_entry_get_name(
+	     directory_entry,
+	     &name,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	fixture_values->number_of_visits += 1;
+
+	if( narrow_string_compare(
+	     name,
+	     "loop",
+	     5 ) == 0 )
+	{
+		fixture_values->number_of_loop_visits += 1;
+	}
+	else if( ( narrow_string_compare(
+	           name,
+	           "file",
+	           5 ) == 0 )
+	      || ( narrow_string_compare(
+	           name,
+	           "link",
+	           5 ) == 0 ) )
+	{
+		fixture_values->number_of_file_visits += 1;
+	}
+	return( 1 );
+}
+
+/* Removes the walk fixture
+ */
+void cdirectory_test_walker_remove_fixture(
+      void )
+{
+	unlink(
+	 "TestWalkerDirectory/directory/loop" );
+	rmdir(
+	 "TestWalkerDirectory/directory" );
+	unlink(
+	 "TestWalkerDirectory/link" );
+	unlink(
+	 "TestWalkerDirectory/file" );
+	rmdir(
+	 "TestWalkerDirectory" );
+}
+
+/* Tests the libcdirectory_walker_walk function on a directory that contains
+ * a symbolic link loop and a file with 2 hard links
+ * Returns 1 if successful or 0 if not
+ */
+int cdirectory_test_walker_walk_with_cycles_and_hard_links(
+     void )
+{
+	cdirectory_test_walker_fixture_values_t fixture_values;
+
+	libcdirectory_walker_t *walker = NULL;
+	libcerror_error_t *error       = NULL;
+	FILE *file_stream              = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 * TestWalkerDirectory/directory/loop is a symbolic link to TestWalkerDirectory
+	 * and TestWalkerDirectory/link a hard link to TestWalkerDirectory/file
+	 */
+	cdirectory_test_walker_remove_fixture();
+
+	result = mkdir(
+	          "TestWalkerDirectory",
+	          0755 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mkdir(
+	          "TestWalkerDirectory/directory",
+	          0755 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = symlink(
+	          "..",
+	          "TestWalkerDirectory/directory/loop" );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = file_stream_open(
+	               "TestWalkerDirectory/file",
+	               "w" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = link(
+	          "TestWalkerDirectory/file",
+	          "TestWalkerDirectory/link" );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdirectory_walker_initialize(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test walk that follows symbolic links and detects cycles
+	 * the symbolic link loop is visited but not entered, otherwise
+	 * the walk would descend into TestWalkerDirectory again
+	 */
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_FOLLOW_SYMBOLIC_LINKS | LIBCDIRECTORY_WALKER_FLAG_DETECT_CYCLES,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &fixture_values,
+	 0,
+	 sizeof( cdirectory_test_walker_fixture_values_t ) );
+
+	result = libcdirectory_walker_walk(
+	          walker,
+	          "TestWalkerDirectory",
+	          &cdirectory_test_walker_fixture_callback,
+	          NULL,
+	          &fixture_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "fixture_values.number_of_loop_visits",
+	 fixture_values.number_of_loop_visits,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "fixture_values.number_of_file_visits",
+	 fixture_values.number_of_file_visits,
+	 2 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "fixture_values.number_of_visits",
+	 fixture_values.number_of_visits,
+	 4 );
+
+	/* Test walk that detects hard links
+	 * only the first of the 2 hard links to the file is visited
+	 */
+	result = libcdirectory_walker_set_flags(
+	          walker,
+	          LIBCDIRECTORY_WALKER_FLAG_DETECT_HARD_LINKS | LIBCDIRECTORY_WALKER_FLAG_ONE_FILE_SYSTEM,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &fixture_values,
+	 0,
+	 sizeof( cdirectory_test_walker_fixture_values_t ) );
+
+	result = libcdirectory_walker_walk(
+	          walker,
+	          "TestWalkerDirectory",
+	          &cdirectory_test_walker_fixture_callback,
+	          NULL,
+	          &fixture_values,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "fixture_values.number_of_loop_visits",
+	 fixture_values.number_of_loop_visits,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "fixture_values.number_of_file_visits",
+	 fixture_values.number_of_file_visits,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "fixture_values.number_of_visits",
+	 fixture_values.number_of_visits,
+	 3 );
+
+	/* Clean up
+	 */
+	result = libcdirectory_walker_free(
+	          &walker,
+	          &error );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	CDIRECTORY_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cdirectory_test_walker_remove_fixture();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libcdirectory_walker_free(
+		 &walker,
+		 NULL );
+	}
+	cdirectory_test_walker_remove_fixture();
+
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDIRECTORY_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDIRECTORY_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FILE *file_stream = NULL;
+	int result        = 0;
+
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argc )
+	CDIRECTORY_TEST_UNREFERENCED_PARAMETER( argv )
+
+	file_stream = file_stream_open(
+	               "TestFile",
+	               "a" );
+
+	CDIRECTORY_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	CDIRECTORY_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream = NULL;
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_initialize",
+	 cdirectory_test_walker_initialize );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_free",
+	 cdirectory_test_walker_free );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_set_read_buffer_size",
+	 cdirectory_test_walker_set_read_buffer_size );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_set_maximum_depth",
+	 cdirectory_test_walker_set_maximum_depth );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_set_flags",
+	 cdirectory_test_walker_set_flags );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_open",
+	 cdirectory_test_walker_open );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_read_entry",
+	 cdirectory_test_walker_read_entry );
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_walk",
+	 cdirectory_test_walker_walk );
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H )
+
+	CDIRECTORY_TEST_RUN(
+	 "libcdirectory_walker_walk_with_cycles_and_hard_links",
+	 cdirectory_test_walker_walk_with_cycles_and_hard_links );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "directory directory_entry error support system_string"
+$LibraryTests = "bloom_filter case_folding checkpoint directory directory_entry disk_usage error inode_set name_index parallel_walker pattern string_compare support system_string tree_snapshot tree_state walker"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 